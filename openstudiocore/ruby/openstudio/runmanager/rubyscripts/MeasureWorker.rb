@@ -0,0 +1,245 @@
+########################################################################################################################
+#  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+#  following conditions are met:
+#
+#  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+#  disclaimer.
+#
+#  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+#  following disclaimer in the documentation and/or other materials provided with the distribution.
+#
+#  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+#  products derived from this software without specific prior written permission from the respective party.
+#
+#  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+#  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+#  specific prior written permission from Alliance for Sustainable Energy, LLC.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+#  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+#  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+#  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+#  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+########################################################################################################################
+
+######################################################################
+# == Synopsis
+#
+#   Long lived ruby process used by the RunManager ruby worker pool. The
+#   OpenStudio bindings are loaded once, then each job received over a local
+#   socket is run in a forked child so that it sees a fresh interpreter in its
+#   own working directory, exactly as if `ruby <args>` had been launched there.
+#   The worker is started detached, given --parentPid it exits, killing any
+#   running job, once that process is gone.
+#
+# == Usage
+#
+#  ruby MeasureWorker.rb --portFile=filePath [--maxJobs=N] [--parentPid=PID]
+#
+# == Protocol
+#
+#   The port file, created readable only by the current user, holds the
+#   listening port and a random token on separate lines.
+#
+#   Token, one line: the token from the port file. Connections that do not
+#     start with it are closed without running anything.
+#   Request, one line of JSON: {"dir": workdir, "path": PATH, "args": [ruby arguments]}
+#   Response, a sequence of frames:
+#     "O <n>\n" followed by n bytes written by the job to stdout
+#     "E <n>\n" followed by n bytes written by the job to stderr
+#     "X <exitcode>\n" once the job has finished
+#   Closing the connection before "X" kills the job.
+#
+######################################################################
+
+require 'openstudio'
+require 'optparse'
+require 'socket'
+require 'json'
+require 'securerandom'
+
+options = Hash.new
+options[:maxJobs] = 0
+
+optparse = OptionParser.new do|opts|
+
+  opts.on('-p','--portFile PORTFILE', String, "File to write the listening port and token to once the worker is ready." ) do |portFile|
+    options[:portFile] = portFile
+  end
+
+  opts.on('-j','--maxJobs MAXJOBS', Integer, "Exit after running this many jobs, 0 for no limit." ) do |maxJobs|
+    options[:maxJobs] = maxJobs
+  end
+
+  opts.on('-P','--parentPid PARENTPID', Integer, "Exit once the process with this id is no longer running." ) do |parentPid|
+    options[:parentPid] = parentPid
+  end
+
+end
+
+optparse.parse!
+
+if not options[:portFile]
+  puts optparse
+  exit 1
+end
+
+# true while the process with id pid exists
+def processAlive(pid)
+  Process.kill(0, pid)
+  return true
+rescue Errno::EPERM
+  return true
+rescue Errno::ESRCH
+  return false
+end
+
+# runs args the way the ruby executable would, only -I options are understood
+def runJob(args)
+  args = args.dup
+  while args.first and args.first.start_with?("-I")
+    arg = args.shift
+    dir = (arg == "-I") ? args.shift : arg[2..-1]
+    $LOAD_PATH.unshift(File.expand_path(dir))
+  end
+
+  script = args.shift
+  raise "No script given" if not script
+  script = File.join(".", script) if not File.absolute_path(script) == script
+
+  $0 = script
+  ARGV.replace(args)
+  load script
+end
+
+def sendFrame(client, type, data)
+  client.write("#{type} #{data.bytesize}\n")
+  client.write(data)
+end
+
+# compares in time independent of where the strings differ
+def secureCompare(a, b)
+  return false if a.bytesize != b.bytesize
+  result = 0
+  a.bytes.zip(b.bytes) { |x, y| result |= x ^ y }
+  return result == 0
+end
+
+def serve(client, token)
+  # anyone on this machine can connect to the port, only run jobs for the RunManager that started us
+  line = client.gets
+  if not line or not secureCompare(line.chomp, token)
+    $stderr.puts "Rejected a connection that did not present the worker token"
+    return false
+  end
+
+  line = client.gets
+  return false if not line
+  request = JSON.parse(line)
+
+  outRead, outWrite = IO.pipe
+  errRead, errWrite = IO.pipe
+
+  pid = fork do
+    $jobPid = nil
+    outRead.close
+    errRead.close
+    client.close
+    $stdin.reopen(File::NULL)
+    $stdout.reopen(outWrite)
+    $stderr.reopen(errWrite)
+    $stdout.sync = true
+    $stderr.sync = true
+    ENV["PATH"] = request["path"] if request["path"]
+    Dir.chdir(request["dir"])
+    begin
+      runJob(request["args"])
+    rescue SystemExit => e
+      exit(e.status)
+    rescue Exception => e
+      $stderr.puts "#{e.backtrace.first}: #{e.message} (#{e.class})"
+      e.backtrace.drop(1).each { |line| $stderr.puts "\tfrom #{line}" }
+      exit(1)
+    end
+    exit(0)
+  end
+
+  $jobPid = pid
+  outWrite.close
+  errWrite.close
+
+  streams = { outRead => "O", errRead => "E" }
+  begin
+    while not streams.empty?
+      ready = IO.select(streams.keys + [client])[0]
+      if ready.include?(client) and client.eof?
+        # the RunManager went away or the job was stopped
+        Process.kill("KILL", pid)
+        Process.wait(pid)
+        return
+      end
+      (ready & streams.keys).each do |io|
+        begin
+          sendFrame(client, streams[io], io.readpartial(65536))
+        rescue EOFError
+          io.close
+          streams.delete(io)
+        end
+      end
+    end
+
+    Process.wait(pid)
+    client.write("X #{$?.exitstatus || 1}\n")
+  rescue Errno::EPIPE, Errno::ECONNRESET
+    Process.kill("KILL", pid) rescue nil
+    Process.wait(pid) rescue nil
+  end
+  return true
+ensure
+  $jobPid = nil
+end
+
+if options[:parentPid]
+  # the RunManager may be killed without getting a chance to stop us, don't outlive it
+  Thread.new do
+    loop do
+      sleep 2
+      if not processAlive(options[:parentPid])
+        if $jobPid
+          Process.kill("KILL", $jobPid) rescue nil
+        end
+        File.delete(options[:portFile]) rescue nil
+        exit!(0)
+      end
+    end
+  end
+end
+
+token = SecureRandom.hex(32)
+server = TCPServer.new("127.0.0.1", 0)
+File.open(options[:portFile] + ".tmp", File::WRONLY | File::CREAT | File::EXCL, 0600) do |f|
+  f.puts server.addr[1]
+  f.puts token
+end
+File.rename(options[:portFile] + ".tmp", options[:portFile])
+
+jobs = 0
+loop do
+  client = server.accept
+  served = false
+  begin
+    served = serve(client, token)
+  rescue JSON::ParserError => e
+    $stderr.puts "Rejected a malformed request: #{e.message}"
+  ensure
+    client.close rescue nil
+  end
+  next if not served
+
+  jobs += 1
+  break if options[:maxJobs] > 0 and jobs >= options[:maxJobs]
+end
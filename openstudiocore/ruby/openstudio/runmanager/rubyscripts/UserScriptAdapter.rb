@@ -46,6 +46,7 @@ puts "Script executing from: " + scriptfolder
 
 options = Hash.new
 options[:arguments] = []
+options[:saveIntermediateModel] = false
 
 optparse = OptionParser.new do|opts|
 
@@ -86,6 +87,10 @@ optparse = OptionParser.new do|opts|
     argValPair = [options[:tempName].to_s,argumentValue]
     options[:arguments].push(argValPair)
   end
+
+  opts.on('--saveIntermediateModel', "Save the model produced by this script to its merged job directory for inspection." ) do
+    options[:saveIntermediateModel] = true
+  end
      
 end
 
@@ -268,6 +273,7 @@ while (scriptindex == 0 || File.directory?(scriptfolder + "/mergedjob-" + script
     end
 
     options[:arguments] = []
+    options[:saveIntermediateModel] = false
 
     paramspath = OpenStudio::Path.new("#{scriptfolder}/mergedjob-#{scriptindex}/params.json")
     Dir.chdir("#{scriptfolder}/mergedjob-#{scriptindex}")
@@ -403,6 +409,15 @@ while (scriptindex == 0 || File.directory?(scriptfolder + "/mergedjob-" + script
   # SAVE SCRIPT RESULT
 
   runner.result.save(OpenStudio::Path.new("result.ossr"),true)
+
+  # merged scripts hand the in memory model to the next script, only write it out here if asked to
+  if result and options[:saveIntermediateModel] and Dir.pwd() != originalwd
+    if type == "model"
+      model.save(OpenStudio::Path.new("out.osm"),true)
+    elsif type == "workspace"
+      workspace.save(OpenStudio::Path.new("out.idf"),true)
+    end
+  end
   
   # stop executing scripts once an error is encountered
   puts "result = #{result}"
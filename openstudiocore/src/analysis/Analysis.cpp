@@ -45,6 +45,15 @@
 #include "../utilities/core/Json.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 
+#include <QHash>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
 namespace openstudio {
 namespace analysis {
 
@@ -204,6 +213,7 @@ namespace detail {
         }
       }
       connectChild(dataPoint,false);
+      indexDataPoint(dataPoint);
     }
   }
 
@@ -226,6 +236,7 @@ namespace detail {
       m_dataPoints.push_back(dataPoint.clone().cast<DataPoint>());
       m_dataPoints.back().setProblem(m_problem);
       connectChild(m_dataPoints.back(),false);
+      indexDataPoint(m_dataPoints.back());
     }
   }
 
@@ -322,6 +333,42 @@ namespace detail {
       const std::vector<QVariant>& variableValues) const
   {
     DataPointVector result;
+
+    // a fully specified query can only match data points with the same key, unless some data
+    // point has more variable values than the query (matches compares prefixes)
+    bool useIndex = true;
+    for (const QVariant& value : variableValues) {
+      if (value.isNull()) {
+        useIndex = false;
+        break;
+      }
+    }
+    if (useIndex && !m_variableValuesSizeCounts.empty() &&
+        (m_variableValuesSizeCounts.rbegin()->first > variableValues.size()))
+    {
+      useIndex = false;
+    }
+
+    std::vector< std::vector<long long> > keys;
+    if (useIndex) {
+      // values sitting on cell boundaries in many continuous dimensions need many probes
+      keys = variableValuesProbeKeys(variableValues,64u);
+    }
+
+    if (!keys.empty()) {
+      for (const std::vector<long long>& key : keys) {
+        auto it = m_dataPointsByVariableValues.find(key);
+        if (it != m_dataPointsByVariableValues.end()) {
+          for (const DataPoint& dataPoint : it->second) {
+            if (dataPoint.matches(variableValues)) {
+              result.push_back(dataPoint);
+            }
+          }
+        }
+      }
+      return result;
+    }
+
     for (const DataPoint& dataPoint : m_dataPoints) {
       if (dataPoint.matches(variableValues)) {
         result.push_back(dataPoint);
@@ -370,24 +417,15 @@ namespace detail {
 
   boost::optional<DataPoint> Analysis_Impl::getDataPointByUUID(const UUID& uuid) const {
     OptionalDataPoint result;
-    for (const DataPoint& myDataPoint : dataPoints()) {
-      if (myDataPoint.uuid() == uuid) {
-        result = myDataPoint;
-        break;
-      }
+    auto it = m_dataPointsByUUID.find(uuid);
+    if (it != m_dataPointsByUUID.end()) {
+      result = it->second;
     }
     return result;
   }
 
   boost::optional<DataPoint> Analysis_Impl::getDataPointByUUID(const DataPoint& dataPoint) const {
-    OptionalDataPoint result;
-    for (const DataPoint& myDataPoint : dataPoints()) {
-      if (dataPoint.uuidEqual(myDataPoint)) {
-        result = myDataPoint;
-        break;
-      }
-    }
-    return result;
+    return getDataPointByUUID(dataPoint.uuid());
   }
 
   bool Analysis_Impl::resultsAreInvalid() const {
@@ -511,6 +549,7 @@ namespace detail {
     }
     m_dataPoints.push_back(dataPoint);
     connectChild(m_dataPoints.back(),true);
+    indexDataPoint(m_dataPoints.back());
     onChange(AnalysisObject_Impl::Benign);
     return true;
   }
@@ -542,6 +581,7 @@ namespace detail {
       auto it = std::find(m_dataPoints.begin(),m_dataPoints.end(),*exactDataPoint);
       OS_ASSERT(it != m_dataPoints.end());
       disconnectChild(*it);
+      unindexDataPoint(*it);
       m_dataPoints.erase(it);
       // TODO: It may be that the algorithm should be reset, or at least marked not-complete.
       if (m_dataPoints.empty()) {
@@ -560,6 +600,7 @@ namespace detail {
       disconnectChild(dataPoint);
     }
     m_dataPoints.clear();
+    clearDataPointIndexes();
     if (m_algorithm) {
       m_algorithm->reset();
     }
@@ -852,6 +893,128 @@ namespace detail {
     }
   }
 
+  size_t Analysis_Impl::UUIDHash::operator()(const UUID& uuid) const {
+    return qHash(uuid);
+  }
+
+  size_t Analysis_Impl::VariableValuesKeyHash::operator()(const std::vector<long long>& key) const {
+    size_t result = key.size();
+    for (long long value : key) {
+      result ^= std::hash<long long>()(value) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+    return result;
+  }
+
+  namespace {
+
+    const long long nonNumericValueKey = LLONG_MIN;
+
+    // Monotone map from double to cell index. Below 1 in magnitude cells are 2^-51 wide, above
+    // they are 64 ulps wide; both exceed the default tolerance of openstudio::equal (2^-52 absolute
+    // or relative), so values that are equal are at most one cell apart.
+    long long continuousValueCell(double value) {
+      double magnitude = std::fabs(value);
+      if (magnitude < 1.0) {
+        return static_cast<long long>(std::floor(std::ldexp(value,51)));
+      }
+      double one(1.0);
+      std::uint64_t bits, oneBits;
+      std::memcpy(&bits,&magnitude,sizeof(bits));
+      std::memcpy(&oneBits,&one,sizeof(oneBits));
+      long long result = (1LL << 51) + static_cast<long long>((bits - oneBits) >> 6);
+      return (value < 0.0) ? -result : result;
+    }
+
+    bool isDiscreteValue(const QVariant& value) {
+      return (value.type() == QVariant::Int) || (value.type() == QVariant::UInt);
+    }
+
+  }
+
+  std::vector<long long> Analysis_Impl::variableValuesKey(const std::vector<QVariant>& variableValues) {
+    std::vector<long long> result;
+    result.reserve(variableValues.size());
+    for (const QVariant& value : variableValues) {
+      if (isDiscreteValue(value)) {
+        result.push_back(value.toInt());
+      }
+      else if (value.type() == QVariant::Double) {
+        result.push_back(continuousValueCell(value.toDouble()));
+      }
+      else {
+        result.push_back(nonNumericValueKey);
+      }
+    }
+    return result;
+  }
+
+  std::vector< std::vector<long long> > Analysis_Impl::variableValuesProbeKeys(
+      const std::vector<QVariant>& variableValues,
+      unsigned maxKeys)
+  {
+    std::vector< std::vector<long long> > result(1u,variableValuesKey(variableValues));
+    for (unsigned i = 0, n = variableValues.size(); i < n; ++i) {
+      if (variableValues[i].type() != QVariant::Double) {
+        continue;
+      }
+      // twice the tolerance of openstudio::equal, to cover rounding in value +/- tolerance
+      double value = variableValues[i].toDouble();
+      double tolerance = 2.0 * std::numeric_limits<double>::epsilon() * std::max(1.0,std::fabs(value));
+      long long first = continuousValueCell(value - tolerance);
+      long long last = continuousValueCell(value + tolerance);
+      if (first == last) {
+        continue;
+      }
+      if (result.size() * static_cast<unsigned long long>(last - first + 1) > maxKeys) {
+        return std::vector< std::vector<long long> >();
+      }
+      std::vector< std::vector<long long> > expanded;
+      expanded.reserve(result.size() * static_cast<size_t>(last - first + 1));
+      for (const std::vector<long long>& key : result) {
+        for (long long cell = first; cell <= last; ++cell) {
+          expanded.push_back(key);
+          expanded.back()[i] = cell;
+        }
+      }
+      result.swap(expanded);
+    }
+    return result;
+  }
+
+  void Analysis_Impl::indexDataPoint(const DataPoint& dataPoint) {
+    m_dataPointsByUUID.insert(std::make_pair(dataPoint.uuid(),dataPoint));
+    std::vector<QVariant> variableValues = dataPoint.variableValues();
+    m_dataPointsByVariableValues[variableValuesKey(variableValues)].push_back(dataPoint);
+    ++m_variableValuesSizeCounts[variableValues.size()];
+  }
+
+  void Analysis_Impl::unindexDataPoint(const DataPoint& dataPoint) {
+    m_dataPointsByUUID.erase(dataPoint.uuid());
+    std::vector<QVariant> variableValues = dataPoint.variableValues();
+    auto it = m_dataPointsByVariableValues.find(variableValuesKey(variableValues));
+    if (it != m_dataPointsByVariableValues.end()) {
+      auto jt = std::find(it->second.begin(),it->second.end(),dataPoint);
+      if (jt != it->second.end()) {
+        it->second.erase(jt);
+      }
+      if (it->second.empty()) {
+        m_dataPointsByVariableValues.erase(it);
+      }
+    }
+    auto kt = m_variableValuesSizeCounts.find(variableValues.size());
+    if (kt != m_variableValuesSizeCounts.end()) {
+      if (--kt->second == 0u) {
+        m_variableValuesSizeCounts.erase(kt);
+      }
+    }
+  }
+
+  void Analysis_Impl::clearDataPointIndexes() {
+    m_dataPointsByUUID.clear();
+    m_dataPointsByVariableValues.clear();
+    m_variableValuesSizeCounts.clear();
+  }
+
 } // detail
 
 AnalysisSerializationOptions::AnalysisSerializationOptions(
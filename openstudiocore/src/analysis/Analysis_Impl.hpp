@@ -38,6 +38,8 @@
 
 #include "../utilities/core/FileReference.hpp"
 
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -303,6 +305,38 @@ namespace detail {
 
    private:
     REGISTER_LOGGER("openstudio.analysis.Analysis");
+
+    struct UUIDHash {
+      size_t operator()(const UUID& uuid) const;
+    };
+
+    struct VariableValuesKeyHash {
+      size_t operator()(const std::vector<long long>& key) const;
+    };
+
+    /** Discrete values are kept, continuous values are replaced by the cell they fall into, other
+     *  values are replaced by a sentinel. Cells are wider than the tolerance used by
+     *  DataPoint::matches, so matching continuous values are in the same or neighbouring cells. */
+    static std::vector<long long> variableValuesKey(const std::vector<QVariant>& variableValues);
+
+    /** Returns every key a DataPoint matching the fully specified variableValues can have, that is,
+     *  variableValuesKey with each continuous value replaced by the cells within tolerance of it.
+     *  Returns an empty vector if there are more than maxKeys such keys. */
+    static std::vector< std::vector<long long> > variableValuesProbeKeys(
+        const std::vector<QVariant>& variableValues,
+        unsigned maxKeys);
+
+    void indexDataPoint(const DataPoint& dataPoint);
+
+    void unindexDataPoint(const DataPoint& dataPoint);
+
+    void clearDataPointIndexes();
+
+    // indexes of m_dataPoints, kept consistent with it on add and remove
+    std::unordered_map<UUID, DataPoint, UUIDHash> m_dataPointsByUUID;
+    std::unordered_map<std::vector<long long>, std::vector<DataPoint>, VariableValuesKeyHash> m_dataPointsByVariableValues;
+    // number of data points for each size of variableValues
+    std::map<unsigned, unsigned> m_variableValuesSizeCounts;
   };
 
 } // detail
@@ -35,12 +35,40 @@
 #include "Analysis.hpp"
 #include "Problem.hpp"
 #include "DataPoint.hpp"
+#include "ContinuousVariable.hpp"
+#include "InputVariable.hpp"
 #include "DiscreteVariable.hpp"
 #include "DiscreteVariable_Impl.hpp"
+#include "UncertaintyDescription.hpp"
+#include "BetaDistribution.hpp"
+#include "ExponentialDistribution.hpp"
+#include "FrechetDistribution.hpp"
+#include "GammaDistribution.hpp"
+#include "GumbelDistribution.hpp"
+#include "LognormalDistribution.hpp"
+#include "LoguniformDistribution.hpp"
+#include "NormalDistribution.hpp"
+#include "TriangularDistribution.hpp"
+#include "UniformDistribution.hpp"
+#include "WeibullDistribution.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Optional.hpp"
 #include "../utilities/core/Containers.hpp"
+#include "../utilities/math/Primes.hpp"
+
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/lognormal.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
 
 namespace openstudio {
 namespace analysis {
@@ -80,9 +108,27 @@ namespace detail {
   }
 
   bool DesignOfExperiments_Impl::isCompatibleProblemType(const Problem& problem) const {
-    if (!problem.allVariablesAreDiscrete()) {
-      LOG(Info,"DesignOfExperiments only operates on Problems composed of DiscreteVariables.");
-      return false;
+    if (designOfExperimentsOptions().designType() == DesignOfExperimentsType::FullFactorial) {
+      if (!problem.allVariablesAreDiscrete()) {
+        LOG(Info,"Full factorial DesignOfExperiments only operates on Problems composed of DiscreteVariables.");
+        return false;
+      }
+      return true;
+    }
+    for (const InputVariable& variable : problem.variables()) {
+      if (variable.optionalCast<DiscreteVariable>()) {
+        continue;
+      }
+      OptionalContinuousVariable continuousVariable = variable.optionalCast<ContinuousVariable>();
+      if (!continuousVariable) {
+        LOG(Info,"Sampling DesignOfExperiments only operates on DiscreteVariables and ContinuousVariables.");
+        return false;
+      }
+      if (!inverseCDF(*continuousVariable,0.5)) {
+        LOG(Info,"ContinuousVariable '" << variable.name() << "' cannot be sampled by DesignOfExperiments, "
+            << "because it has neither a supported UncertaintyDescription nor both a minimum and a maximum.");
+        return false;
+      }
     }
     return true;
   }
@@ -92,9 +138,7 @@ namespace detail {
 
     // to make sure problem type check has already occurred. this is stated usage in header.
     OS_ASSERT(analysis.algorithm().get() == getPublicObject<DesignOfExperiments>());
-    // nothing else is supported yet
     DesignOfExperimentsOptions options = designOfExperimentsOptions();
-    OS_ASSERT(options.designType() == DesignOfExperimentsType::FullFactorial);
 
     if (isComplete()) {
       LOG(Info,"Algorithm is already marked as complete. Returning without creating new points.");
@@ -122,9 +166,60 @@ namespace detail {
 
     m_iter = 1;
 
+    std::vector< std::vector<QVariant> > variableValues;
+    if (options.designType() == DesignOfExperimentsType::FullFactorial) {
+      variableValues = fullFactorialValues(analysis.problem());
+    }
+    else {
+      OptionalInt samples = options.samples();
+      if (!samples) {
+        LOG(Error,"The number of samples must be set to use a " << options.designType().valueDescription()
+            << " DesignOfExperiments. No DataPoints will be added to Analysis '" << analysis.name() << "'.");
+        return result;
+      }
+      if (!options.seed()) {
+        // fix the seed so the same samples are regenerated on restart
+        std::random_device device;
+        options.setSeed(std::uniform_int_distribution<int>(1,std::numeric_limits<int>::max())(device));
+        onChange(AnalysisObject_Impl::Benign);
+      }
+      variableValues = sampledValues(analysis.problem(),
+                                     DesignOfExperiments::unitSamples(options.designType(),
+                                                                      *samples,
+                                                                      analysis.problem().numVariables(),
+                                                                      *options.seed()));
+    }
+
+    // create data points and add to analysis
+    for (const std::vector<QVariant>& value : variableValues) {
+      OptionalDataPoint dataPoint = analysis.problem().createDataPoint(value);
+      if (!dataPoint) {
+        LOG(Warn,"Unable to create a DataPoint from the generated variable values.");
+        continue;
+      }
+      dataPoint->addTag("DOE");
+      bool added = analysis.addDataPoint(*dataPoint);
+      if (added) {
+        ++result;
+        ++totPoints;
+        if (mxSim && (totPoints == mxSim.get())) {
+          break;
+        }
+      }
+    }
+
+    if (result == 0) {
+      LOG(Trace,"No new points were added, so marking this DesignOfExperiments complete.");
+      markComplete();
+    }
+
+    return result;
+  }
+
+  std::vector< std::vector<QVariant> > DesignOfExperiments_Impl::fullFactorialValues(const Problem& problem) const {
     // determine all combinations
     std::vector< std::vector<QVariant> > variableValues;
-    for (const Variable& variable : analysis.problem().variables()) {
+    for (const Variable& variable : problem.variables()) {
       // variable must be DiscreteVariable, otherwise !isCompatibleProblemType(analysis.problem())
       DiscreteVariable discreteVariable = variable.cast<DiscreteVariable>();
       IntVector dvValues = discreteVariable.validValues(true);
@@ -149,24 +244,213 @@ namespace detail {
         }
       }
     }
+    return variableValues;
+  }
 
-    // create data points and add to analysis
-    for (const std::vector<QVariant>& value : variableValues) {
-      DataPoint dataPoint = analysis.problem().createDataPoint(value).get();
-      dataPoint.addTag("DOE");
-      bool added = analysis.addDataPoint(dataPoint);
-      if (added) {
-        ++result;
-        ++totPoints;
-        if (mxSim && (totPoints == mxSim.get())) {
+  std::vector< std::vector<QVariant> > DesignOfExperiments_Impl::sampledValues(
+      const Problem& problem,
+      const std::vector< std::vector<double> >& unitSamples) const
+  {
+    std::vector< std::vector<QVariant> > result;
+    InputVariableVector variables = problem.variables();
+    unsigned n = variables.size();
+
+    // look up the discrete values once
+    std::vector<IntVector> discreteValues(n);
+    for (unsigned j = 0; j < n; ++j) {
+      if (OptionalDiscreteVariable discreteVariable = variables[j].optionalCast<DiscreteVariable>()) {
+        discreteValues[j] = discreteVariable->validValues(true);
+        if (discreteValues[j].empty()) {
+          LOG(Error,"DiscreteVariable '" << variables[j].name() << "' has no selected values to sample.");
+          return result;
+        }
+      }
+    }
+
+    for (const std::vector<double>& unitSample : unitSamples) {
+      OS_ASSERT(unitSample.size() == n);
+      std::vector<QVariant> values;
+      for (unsigned j = 0; j < n; ++j) {
+        if (!discreteValues[j].empty()) {
+          // equal probability for each selected value
+          unsigned nv = discreteValues[j].size();
+          unsigned index = std::min<unsigned>(unsigned(unitSample[j] * nv),nv - 1u);
+          values.push_back(QVariant(discreteValues[j][index]));
+        }
+        else {
+          ContinuousVariable continuousVariable = variables[j].cast<ContinuousVariable>();
+          OptionalDouble value = inverseCDF(continuousVariable,unitSample[j]);
+          if (!value) {
+            LOG(Error,"Unable to sample ContinuousVariable '" << variables[j].name() << "'.");
+            return std::vector< std::vector<QVariant> >();
+          }
+          values.push_back(QVariant(*value));
+        }
+      }
+      result.push_back(values);
+    }
+
+    return result;
+  }
+
+  boost::optional<double> DesignOfExperiments_Impl::inverseCDF(const ContinuousVariable& variable,
+                                                               double p)
+  {
+    OptionalDouble result;
+    OptionalDouble lb = variable.minimum();
+    OptionalDouble ub = variable.maximum();
+
+    if (OptionalUncertaintyDescription udesc = variable.uncertaintyDescription()) {
+      switch (udesc->type().value()) {
+        case UncertaintyDescriptionType::normal_uncertain :
+        {
+          NormalDistribution d = udesc->cast<NormalDistribution>();
+          boost::math::normal_distribution<> dist(d.mean(),d.standardDeviation());
+          OptionalDouble dlb = d.lowerBound();
+          OptionalDouble dub = d.upperBound();
+          // truncated distribution
+          double plb = dlb ? boost::math::cdf(dist,*dlb) : 0.0;
+          double pub = dub ? boost::math::cdf(dist,*dub) : 1.0;
+          double q = plb + p * (pub - plb);
+          if ((q > 0.0) && (q < 1.0)) {
+            result = boost::math::quantile(dist,q);
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::lognormal_uncertain :
+        {
+          LognormalDistribution d = udesc->cast<LognormalDistribution>();
+          OptionalDouble lambda = d.lambda();
+          OptionalDouble zeta = d.zeta();
+          if (!(lambda && zeta) && d.mean()) {
+            if (d.standardDeviation()) {
+              double cv = d.standardDeviation().get() / d.mean().get();
+              zeta = std::sqrt(std::log(1.0 + cv * cv));
+            }
+            else if (d.errorFactor()) {
+              zeta = std::log(d.errorFactor().get()) / 1.645;
+            }
+            if (zeta) {
+              lambda = std::log(d.mean().get()) - 0.5 * zeta.get() * zeta.get();
+            }
+          }
+          if (lambda && zeta) {
+            boost::math::lognormal_distribution<> dist(*lambda,*zeta);
+            OptionalDouble dlb = d.lowerBound();
+            OptionalDouble dub = d.upperBound();
+            double plb = (dlb && (*dlb > 0.0)) ? boost::math::cdf(dist,*dlb) : 0.0;
+            double pub = dub ? boost::math::cdf(dist,*dub) : 1.0;
+            double q = plb + p * (pub - plb);
+            if ((q > 0.0) && (q < 1.0)) {
+              result = boost::math::quantile(dist,q);
+            }
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::uniform_uncertain :
+        {
+          UniformDistribution d = udesc->cast<UniformDistribution>();
+          result = d.lowerBound() + p * (d.upperBound() - d.lowerBound());
           break;
         }
+        case UncertaintyDescriptionType::loguniform_uncertain :
+        {
+          LoguniformDistribution d = udesc->cast<LoguniformDistribution>();
+          double a = std::log(d.lowerBound());
+          double b = std::log(d.upperBound());
+          result = std::exp(a + p * (b - a));
+          break;
+        }
+        case UncertaintyDescriptionType::triangular_uncertain :
+        {
+          TriangularDistribution d = udesc->cast<TriangularDistribution>();
+          double a = d.lowerBound();
+          double b = d.upperBound();
+          double c = d.mode();
+          double range = b - a;
+          if (range > 0.0) {
+            double pc = (c - a) / range;
+            if (p < pc) {
+              result = a + std::sqrt(p * range * (c - a));
+            }
+            else {
+              result = b - std::sqrt((1.0 - p) * range * (b - c));
+            }
+          }
+          else {
+            result = a;
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::exponential_uncertain :
+        {
+          // beta is the mean
+          ExponentialDistribution d = udesc->cast<ExponentialDistribution>();
+          if (p < 1.0) {
+            result = -d.beta() * std::log(1.0 - p);
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::beta_uncertain :
+        {
+          BetaDistribution d = udesc->cast<BetaDistribution>();
+          boost::math::beta_distribution<> dist(d.alpha(),d.beta());
+          result = d.lowerBound() + boost::math::quantile(dist,p) * (d.upperBound() - d.lowerBound());
+          break;
+        }
+        case UncertaintyDescriptionType::gamma_uncertain :
+        {
+          GammaDistribution d = udesc->cast<GammaDistribution>();
+          if (p < 1.0) {
+            boost::math::gamma_distribution<> dist(d.alpha(),d.beta());
+            result = boost::math::quantile(dist,p);
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::gumbel_uncertain :
+        {
+          // F(x) = exp(-exp(-alpha * (x - beta)))
+          GumbelDistribution d = udesc->cast<GumbelDistribution>();
+          if ((p > 0.0) && (p < 1.0)) {
+            result = d.beta() - std::log(-std::log(p)) / d.alpha();
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::frechet_uncertain :
+        {
+          // F(x) = exp(-(beta / x)^alpha)
+          FrechetDistribution d = udesc->cast<FrechetDistribution>();
+          if ((p > 0.0) && (p < 1.0)) {
+            result = d.beta() * std::pow(-std::log(p),-1.0 / d.alpha());
+          }
+          break;
+        }
+        case UncertaintyDescriptionType::weibull_uncertain :
+        {
+          // F(x) = 1 - exp(-(x / beta)^alpha)
+          WeibullDistribution d = udesc->cast<WeibullDistribution>();
+          if (p < 1.0) {
+            result = d.beta() * std::pow(-std::log(1.0 - p),1.0 / d.alpha());
+          }
+          break;
+        }
+        default:
+          break;
       }
     }
 
-    if (result == 0) {
-      LOG(Trace,"No new points were added, so marking this DesignOfExperiments complete.");
-      markComplete();
+    if (!result && lb && ub && (*lb <= *ub)) {
+      result = *lb + p * (*ub - *lb);
+    }
+
+    if (result) {
+      // keep the sample feasible for the variable
+      if (lb) {
+        result = std::max(*result,*lb);
+      }
+      if (ub) {
+        result = std::min(*result,*ub);
+      }
     }
 
     return result;
@@ -235,6 +519,87 @@ DesignOfExperimentsOptions DesignOfExperiments::designOfExperimentsOptions() con
   return getImpl<detail::DesignOfExperiments_Impl>()->designOfExperimentsOptions();
 }
 
+std::vector< std::vector<double> > DesignOfExperiments::unitSamples(const DesignOfExperimentsType& designType,
+                                                                    int samples,
+                                                                    int dimensions,
+                                                                    int seed)
+{
+  std::vector< std::vector<double> > result;
+  if ((samples < 1) || (dimensions < 0)) {
+    return result;
+  }
+  result.resize(samples,std::vector<double>(dimensions,0.0));
+
+  boost::mt19937 mt(static_cast<unsigned>(seed));
+  boost::uniform_real<> dist(0.0,1.0);
+  boost::variate_generator<boost::mt19937&,boost::uniform_real<> > halfOpenUniform(mt,dist);
+  // draws from (0,1), since inverse cdfs are undefined at 0
+  auto uniform = [&halfOpenUniform]() {
+    double result = halfOpenUniform();
+    while (result <= 0.0) {
+      result = halfOpenUniform();
+    }
+    return result;
+  };
+
+  switch (designType.value()) {
+    case DesignOfExperimentsType::LatinHypercube :
+    {
+      // one sample in each of samples equal-probability strata, randomly paired across dimensions
+      std::vector<int> strata(samples);
+      for (int j = 0; j < dimensions; ++j) {
+        for (int i = 0; i < samples; ++i) {
+          strata[i] = i;
+        }
+        for (int i = samples - 1; i > 0; --i) {
+          int k = std::min<int>(int(uniform() * (i + 1)),i);
+          std::swap(strata[i],strata[k]);
+        }
+        for (int i = 0; i < samples; ++i) {
+          // the division can round up to 1 in the top stratum
+          result[i][j] = std::min((strata[i] + uniform()) / samples,std::nextafter(1.0,0.0));
+        }
+      }
+      break;
+    }
+    case DesignOfExperimentsType::MonteCarlo :
+    {
+      for (int i = 0; i < samples; ++i) {
+        for (int j = 0; j < dimensions; ++j) {
+          result[i][j] = uniform();
+        }
+      }
+      break;
+    }
+    case DesignOfExperimentsType::Halton :
+    {
+      // radical inverse in the j-th prime base, skipping the origin
+      int base = 1;
+      for (int j = 0; j < dimensions; ++j) {
+        do {
+          ++base;
+        } while (!isPrime(base));
+        for (int i = 0; i < samples; ++i) {
+          double f = 1.0;
+          double value = 0.0;
+          for (int k = i + 1; k > 0; k /= base) {
+            f /= base;
+            value += f * (k % base);
+          }
+          result[i][j] = value;
+        }
+      }
+      break;
+    }
+    default:
+      // FullFactorial is not a sampling design
+      result.clear();
+      break;
+  }
+
+  return result;
+}
+
 /// @cond
 DesignOfExperiments::DesignOfExperiments(std::shared_ptr<detail::DesignOfExperiments_Impl> impl)
   : OpenStudioAlgorithm(impl)
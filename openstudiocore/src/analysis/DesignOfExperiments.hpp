@@ -36,6 +36,7 @@ namespace openstudio {
 namespace analysis {
 
 class DesignOfExperimentsOptions;
+class DesignOfExperimentsType;
 
 namespace detail {
 
@@ -43,10 +44,14 @@ namespace detail {
 
 } // detail
 
-/** DesignOfExperiments is an OpenStudioAlgorithm. Currently, DesignOfExperiments may be used to 
- *  perform full mesh parametric analyses on \link Problem Problems \endlink for which 
- *  Problem::allVariablesAreDiscrete. DesignOfExperiments::createNextIteration adds all \link 
- *  DataPoint DataPoints \endlink at once, in one batch. */
+/** DesignOfExperiments is an OpenStudioAlgorithm. DesignOfExperiments may be used to perform
+ *  full mesh parametric analyses on \link Problem Problems \endlink for which 
+ *  Problem::allVariablesAreDiscrete. The LatinHypercube, MonteCarlo and Halton designs sample
+ *  \link DiscreteVariable DiscreteVariables\endlink and \link ContinuousVariable 
+ *  ContinuousVariables\endlink in process, without a round-trip through DAKOTA. Continuous
+ *  values are drawn from the variable's UncertaintyDescription where supported, and otherwise
+ *  uniformly between its minimum and maximum. DesignOfExperiments::createNextIteration adds all
+ *  \link DataPoint DataPoints \endlink at once, in one batch. */
 class ANALYSIS_API DesignOfExperiments : public OpenStudioAlgorithm {
  public:
   /** @name Constructors and Destructors */
@@ -69,6 +74,15 @@ class ANALYSIS_API DesignOfExperiments : public OpenStudioAlgorithm {
   //@}
 
   static std::string standardName();
+
+  /** Returns samples points in the unit hypercube of the given dimension, generated by the 
+   *  designType sampling design. Coordinates are in the open interval (0,1), so they can be
+   *  passed to inverse cumulative distribution functions. Random designs are repeatable for a
+   *  given seed. Returns an empty vector for DesignOfExperimentsType::FullFactorial. */
+  static std::vector< std::vector<double> > unitSamples(const DesignOfExperimentsType& designType,
+                                                        int samples,
+                                                        int dimensions,
+                                                        int seed);
   
   /** @name Getters and Queries */
   //@{
@@ -30,6 +30,7 @@
 #include "DesignOfExperimentsOptions_Impl.hpp"
 
 #include "../utilities/core/Json.hpp"
+#include "../utilities/core/Optional.hpp"
 
 namespace openstudio {
 namespace analysis {
@@ -56,10 +57,61 @@ namespace detail {
     return m_designType;
   }
 
+  boost::optional<int> DesignOfExperimentsOptions_Impl::seed() const {
+    OptionalInt result;
+    if (OptionalAttribute option = getOption("seed")) {
+      result = option->valueAsInteger();
+    }
+    return result;
+  }
+
+  boost::optional<int> DesignOfExperimentsOptions_Impl::samples() const {
+    OptionalInt result;
+    if (OptionalAttribute option = getOption("samples")) {
+      result = option->valueAsInteger();
+    }
+    return result;
+  }
+
   void DesignOfExperimentsOptions_Impl::setDesignType(const DesignOfExperimentsType& designType) {
     m_designType = designType;
   }
 
+  void DesignOfExperimentsOptions_Impl::setSeed(int value) {
+    OptionalAttribute option;
+    if ((option = getOption("seed"))) {
+      option->setValue(value);
+    }
+    else {
+      option = Attribute("seed",value);
+      saveOption(*option);
+    }
+  }
+
+  void DesignOfExperimentsOptions_Impl::clearSeed() {
+    clearOption("seed");
+  }
+
+  bool DesignOfExperimentsOptions_Impl::setSamples(int value) {
+    if (value < 1) {
+      LOG(Warn,"Cannot set DesignOfExperimentsOptions samples to a value less than one.");
+      return false;
+    }
+    OptionalAttribute option;
+    if ((option = getOption("samples"))) {
+      option->setValue(value);
+    }
+    else {
+      option = Attribute("samples",value);
+      saveOption(*option);
+    }
+    return true;
+  }
+
+  void DesignOfExperimentsOptions_Impl::clearSamples() {
+    clearOption("samples");
+  }
+
   QVariant DesignOfExperimentsOptions_Impl::toVariant() const {
     QVariantMap map = AlgorithmOptions_Impl::toVariant().toMap();
 
@@ -96,10 +148,34 @@ DesignOfExperimentsType DesignOfExperimentsOptions::designType() const {
   return getImpl<detail::DesignOfExperimentsOptions_Impl>()->designType();
 }
 
+boost::optional<int> DesignOfExperimentsOptions::seed() const {
+  return getImpl<detail::DesignOfExperimentsOptions_Impl>()->seed();
+}
+
+boost::optional<int> DesignOfExperimentsOptions::samples() const {
+  return getImpl<detail::DesignOfExperimentsOptions_Impl>()->samples();
+}
+
 void DesignOfExperimentsOptions::setDesignType(const DesignOfExperimentsType& designType) {
   getImpl<detail::DesignOfExperimentsOptions_Impl>()->setDesignType(designType);
 }
 
+void DesignOfExperimentsOptions::setSeed(int value) {
+  getImpl<detail::DesignOfExperimentsOptions_Impl>()->setSeed(value);
+}
+
+void DesignOfExperimentsOptions::clearSeed() {
+  getImpl<detail::DesignOfExperimentsOptions_Impl>()->clearSeed();
+}
+
+bool DesignOfExperimentsOptions::setSamples(int value) {
+  return getImpl<detail::DesignOfExperimentsOptions_Impl>()->setSamples(value);
+}
+
+void DesignOfExperimentsOptions::clearSamples() {
+  getImpl<detail::DesignOfExperimentsOptions_Impl>()->clearSamples();
+}
+
 /// @cond
 DesignOfExperimentsOptions::DesignOfExperimentsOptions(std::shared_ptr<detail::DesignOfExperimentsOptions_Impl> impl)
   : AlgorithmOptions(impl)
@@ -44,10 +44,27 @@ namespace detail {
 } // detail
 
 /** \class DesignOfExperimentsType 
+ *  \brief Lists the sampling designs that DesignOfExperiments generates in process.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual
+ *  macro call is:
+ *  \code
+OPENSTUDIO_ENUM( DesignOfExperimentsType,
+  ((FullFactorial)(full factorial))
+  ((LatinHypercube)(latin hypercube))
+  ((MonteCarlo)(monte carlo))
+  ((Halton)(halton))
+);
+ *  \endcode
+ *  FullFactorial is the grid over all selected values of \link DiscreteVariable
+ *  DiscreteVariables\endlink. The other designs draw DesignOfExperimentsOptions::samples points
+ *  and also accept \link ContinuousVariable ContinuousVariables\endlink.
  *
  *  \relates DesignOfExperimentsOptions */
 OPENSTUDIO_ENUM( DesignOfExperimentsType,
   ((FullFactorial)(full factorial))
+  ((LatinHypercube)(latin hypercube))
+  ((MonteCarlo)(monte carlo))
+  ((Halton)(halton))
 );
 
 /** DesignOfExperimentsOptions is an AlgorithmOptions class for use with DesignOfExperiments.
@@ -71,12 +88,29 @@ class ANALYSIS_API DesignOfExperimentsOptions : public AlgorithmOptions {
 
   DesignOfExperimentsType designType() const;
 
+  /** Returns the pseudo-random number generator seed if it exists, evaluates to false otherwise.
+   *  LatinHypercube and MonteCarlo designs set the seed on first use if it is not specified, so
+   *  that the same samples are regenerated on restart. */
+  boost::optional<int> seed() const;
+
+  /** Returns the number of samples to be drawn by the LatinHypercube, MonteCarlo and Halton
+   *  designs, if set; evaluates to false otherwise. Not used by FullFactorial. */
+  boost::optional<int> samples() const;
+
   //@}
   /** @name Setters */
   //@{
 
   void setDesignType(const DesignOfExperimentsType& designType);
 
+  void setSeed(int value);
+
+  void clearSeed();
+
+  bool setSamples(int value);
+
+  void clearSamples();
+
   //@}
  protected:
   /// @cond
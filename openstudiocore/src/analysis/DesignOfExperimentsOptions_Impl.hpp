@@ -59,12 +59,24 @@ namespace detail {
 
     DesignOfExperimentsType designType() const;
 
+    boost::optional<int> seed() const;
+
+    boost::optional<int> samples() const;
+
     //@}
     /** @name Setters */
     //@{
 
     void setDesignType(const DesignOfExperimentsType& designType);
 
+    void setSeed(int value);
+
+    void clearSeed();
+
+    bool setSamples(int value);
+
+    void clearSamples();
+
     //@}
     /** @name Absent or Protected in Public Class */
     //@{
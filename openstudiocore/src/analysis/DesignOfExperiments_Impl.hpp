@@ -37,6 +37,7 @@
 namespace openstudio {
 namespace analysis {
 
+class ContinuousVariable;
 class DesignOfExperimentsOptions;
 
 namespace detail {
@@ -96,6 +97,17 @@ namespace detail {
     //@}
    private:
     REGISTER_LOGGER("openstudio.analysis.DesignOfExperiments");
+
+    std::vector< std::vector<QVariant> > fullFactorialValues(const Problem& problem) const;
+
+    /** Maps points in the unit hypercube to variable values, one dimension per variable. */
+    std::vector< std::vector<QVariant> > sampledValues(
+        const Problem& problem,
+        const std::vector< std::vector<double> >& unitSamples) const;
+
+    /** Returns the value of variable at cumulative probability p, using its UncertaintyDescription
+     *  if supported, and otherwise a uniform distribution between its minimum and maximum. */
+    static boost::optional<double> inverseCDF(const ContinuousVariable& variable, double p);
   };
 
 } // detail
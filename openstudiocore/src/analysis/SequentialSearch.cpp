@@ -50,8 +50,112 @@ namespace analysis {
 
 namespace detail {
 
+  namespace {
+
+    /** OptimizationDataPoint with its two objective values extracted once. */
+    struct ObjectivePoint {
+      OptimizationDataPoint point;
+      double values[2];
+
+      ObjectivePoint(const OptimizationDataPoint& t_point, const DoubleVector& t_values)
+        : point(t_point)
+      {
+        values[0] = t_values[0];
+        values[1] = t_values[1];
+      }
+    };
+
+    std::vector<ObjectivePoint> getObjectivePoints(const DataPointVector& dataPoints) {
+      std::vector<ObjectivePoint> result;
+      result.reserve(dataPoints.size());
+      for (const DataPoint& dataPoint : dataPoints) {
+        OptimizationDataPoint point = dataPoint.cast<OptimizationDataPoint>();
+        DoubleVector values = point.objectiveValues();
+        if (values.size() == 2u) {
+          result.push_back(ObjectivePoint(point,values));
+        }
+      }
+      return result;
+    }
+
+    /** Records the objective values of points not yet in folded, and flags them in isNew. Returns false if
+     *  a point in folded was removed or its objective values changed, in which case nothing can be reused. */
+    bool foldObjectivePoints(const std::vector<ObjectivePoint>& points,
+                             std::map<UUID, std::pair<double,double> >& folded,
+                             std::vector<bool>& isNew)
+    {
+      isNew.assign(points.size(),false);
+      unsigned numFolded(0);
+      unsigned numNew(0);
+      for (unsigned k = 0, n = points.size(); k < n; ++k) {
+        const ObjectivePoint& p = points[k];
+        auto it = folded.find(p.point.uuid());
+        if (it == folded.end()) {
+          folded.insert(std::make_pair(p.point.uuid(),std::make_pair(p.values[0],p.values[1])));
+          isNew[k] = true;
+          ++numNew;
+          continue;
+        }
+        ++numFolded;
+        if ((it->second.first != p.values[0]) || (it->second.second != p.values[1])) {
+          // results were replaced
+          return false;
+        }
+      }
+      // otherwise points were removed or their results were cleared
+      return (numFolded + numNew == folded.size());
+    }
+
+    /** Returns the index of the point with the maximum slope down from currentValues on graph i vs.
+     *  otherIndex, or -1 if there is none. Ties go to the first such point. */
+    int steepestCandidate(const std::vector<const ObjectivePoint*>& points,
+                          const DoubleVector& currentValues,
+                          bool isBaseline,
+                          unsigned i,
+                          unsigned otherIndex)
+    {
+      int candidate(-1);
+      // candidates have objective function at otherIndex < current's
+      OptionalDouble candidateSlope;
+      for (unsigned n = 0, N = points.size(); n < N; ++n) {
+        const double* values = points[n]->values;
+        if (!lessThanOrEqual(values[otherIndex],currentValues[otherIndex])) {
+          continue;
+        }
+        // take maximum slope as calculated on graph i vs. otherIndex
+        double slope = (values[i] - currentValues[i])/
+                       (values[otherIndex] - currentValues[otherIndex]);
+        // infinite slope exception for start of algorithm
+        bool infiniteSlopeException =
+            isBaseline &&
+            equal(values[otherIndex],currentValues[otherIndex]) &&
+            (values[i] < currentValues[i]);
+        if (infiniteSlopeException && candidateSlope) {
+          const double* candidateValues = points[candidate]->values;
+          infiniteSlopeException = infiniteSlopeException &&
+              ((candidateValues[otherIndex] < values[otherIndex]) ||
+               (values[i] < candidateValues[i]));
+        }
+        if (infiniteSlopeException ||
+            (!equal(values[otherIndex],currentValues[otherIndex]) &&
+             ((!candidateSlope) || (slope > *candidateSlope) ||
+              (equal(slope,*candidateSlope) && (values[i] < points[candidate]->values[i])))))
+        {
+          candidate = n;
+          candidateSlope = slope;
+          if (infiniteSlopeException) {
+            candidateSlope = std::numeric_limits<double>::max();
+          }
+        }
+      }
+      return candidate;
+    }
+
+  }
+
   SequentialSearch_Impl::SequentialSearch_Impl(const SequentialSearchOptions& options)
-    : OpenStudioAlgorithm_Impl(SequentialSearch::standardName(),options)
+    : OpenStudioAlgorithm_Impl(SequentialSearch::standardName(),options),
+      m_paretoObjective(-1)
   {}
 
   SequentialSearch_Impl::SequentialSearch_Impl(const UUID& uuid,
@@ -70,11 +174,13 @@ namespace detail {
                                complete,
                                failed,
                                iter,
-                               options)
+                               options),
+      m_paretoObjective(-1)
   {}
 
   SequentialSearch_Impl::SequentialSearch_Impl(const SequentialSearch_Impl& other)
-    : OpenStudioAlgorithm_Impl(other)
+    : OpenStudioAlgorithm_Impl(other),
+      m_paretoObjective(-1)
   {}
 
   AnalysisObject SequentialSearch_Impl::clone() const {
@@ -179,6 +285,10 @@ namespace detail {
         ss << "iter" << m_iter;
         std::string iterTag(ss.str()); ss.str("");
         for (const std::vector<QVariant>& candidate : candidateVariableValues) {
+          // neighbors explored from earlier points are already in the analysis
+          if (!analysis.getDataPoints(candidate).empty()) {
+            continue;
+          }
           DataPoint newDataPoint = analysis.problem().createDataPoint(candidate).get();
           OS_ASSERT(newDataPoint.optionalCast<OptimizationDataPoint>());
           newDataPoint.addTag("ss");
@@ -221,86 +331,100 @@ namespace detail {
     OptimizationDataPointVector result = castVector<OptimizationDataPoint>(
         analysis.getDataPoints("iter0")); // baseline point
     OS_ASSERT(result.size() < 2);
-    OptimizationDataPointVector successfulPoints = castVector<OptimizationDataPoint>(
-        analysis.successfulDataPoints());
+    std::vector<ObjectivePoint> successfulPoints = getObjectivePoints(analysis.successfulDataPoints());
+
+    int otherIndex(0);
+    if (i == 0) {
+      otherIndex = 1;
+    }
+    else {
+      OS_ASSERT(i == 1);
+    }
+
+    // each step of the last curve picked the best of the points seen then, so a step only needs to
+    // compare its last pick against the points that have completed since
+    MinimumCurveCache& cache = m_minimumCurves[i];
+    std::vector<bool> isNew;
+    if (!foldObjectivePoints(successfulPoints,cache.foldedValues,isNew)) {
+      LOG(Debug,"Rebuilding minimum curve " << i << " from all successful points.");
+      cache = MinimumCurveCache();
+      foldObjectivePoints(successfulPoints,cache.foldedValues,isNew);
+    }
+    std::map<UUID,const ObjectivePoint*> pointsByUUID;
+    std::vector<const ObjectivePoint*> newPoints;
+    for (unsigned k = 0, n = successfulPoints.size(); k < n; ++k) {
+      pointsByUUID.insert(std::make_pair(successfulPoints[k].point.uuid(),&successfulPoints[k]));
+      if (isNew[k]) {
+        newPoints.push_back(&successfulPoints[k]);
+      }
+    }
 
     // construct curve
     OptionalOptimizationDataPoint current;
+    DoubleVector currentValues;
+    std::set<UUID> onCurve;
     if (!result.empty()) {
       current = result.back();
+      currentValues = current->objectiveValues();
       if (!current->isTag(curveTag)) {
         current->addTag(curveTag);
       }
-      auto it = std::find(successfulPoints.begin(),
-                          successfulPoints.end(),
-                          result.back());
-      successfulPoints.erase(it);
-    }
-    int otherIndex(0);
-    if (i == 0) {
-      otherIndex = 1;
-    }
-    else {
-      OS_ASSERT(i == 1);
+      onCurve.insert(current->uuid());
     }
+    bool cached = current && !cache.curve.empty() && (cache.curve[0] == current->uuid());
+    unsigned numSearched(0);
     while (current) {
-      OptionalOptimizationDataPoint candidate;
+      const ObjectivePoint* next(nullptr);
       if (current->isTag("explored") && current->isComplete() && !current->failed()) {
-        // candidates have objective function at otherIndex < current's
-        DoubleVector currentValues = current->objectiveValues();
-        OptionalDouble candidateSlope;
-        DoubleVector candidateValues;
-        for (auto it = successfulPoints.begin();
-             it != successfulPoints.end(); )
-        {
-          DoubleVector values = it->objectiveValues();
-          if (lessThanOrEqual(values[otherIndex],currentValues[otherIndex])) {
-            // take maximum slope as calculated on graph i vs. otherIndex
-            double slope = (values[i] - currentValues[i])/
-                           (values[otherIndex] - currentValues[otherIndex]);
-            // infinite slope exception for start of algorithm
-            bool infiniteSlopeException =
-                current->isTag("iter0") &&
-                equal(values[otherIndex],currentValues[otherIndex]) &&
-                (values[i] < currentValues[i]);
-            if (infiniteSlopeException && candidateSlope) {
-              infiniteSlopeException = infiniteSlopeException &&
-                  ((candidateValues[otherIndex] < values[otherIndex]) ||
-                   (values[i] < candidateValues[i]));
-            }
-            if (infiniteSlopeException ||
-                (!equal(values[otherIndex],currentValues[otherIndex]) &&
-                 ((!candidateSlope) || (slope > *candidateSlope) ||
-                  (equal(slope,*candidateSlope) && (values[i] < candidateValues[i])))))
-            {
-              candidate = *it;
-              candidateSlope = slope;
-              candidateValues = values;
-              if (infiniteSlopeException) {
-                candidateSlope = std::numeric_limits<double>::max();
-              }
+        bool isBaseline = current->isTag("iter0");
+        std::vector<const ObjectivePoint*> points;
+        if (cached && (numSearched < cache.numSearched) && !isBaseline) {
+          if (numSearched + 1 < cache.curve.size()) {
+            auto it = pointsByUUID.find(cache.curve[numSearched + 1]);
+            OS_ASSERT(it != pointsByUUID.end());
+            points.push_back(it->second);
+          }
+          for (const ObjectivePoint* p : newPoints) {
+            if (onCurve.find(p->point.uuid()) == onCurve.end()) {
+              points.push_back(p);
             }
-            ++it;
           }
-          else {
-            // erase it from consideration--with other objective function > current,
-            // will never be candidate.
-            it = successfulPoints.erase(it);
+        }
+        else {
+          // the infinite slope exception depends on the order points are seen in, so the
+          // baseline step always searches all points
+          for (const ObjectivePoint& p : successfulPoints) {
+            if (onCurve.find(p.point.uuid()) == onCurve.end()) {
+              points.push_back(&p);
+            }
           }
         }
+        int candidate = steepestCandidate(points,currentValues,isBaseline,i,otherIndex);
+        if (candidate >= 0) {
+          next = points[candidate];
+        }
+        ++numSearched;
       }
-      if (candidate) {
-        result.push_back(*candidate);
+      cached = cached && next && (numSearched < cache.curve.size()) &&
+               (next->point.uuid() == cache.curve[numSearched]);
+      if (next) {
+        result.push_back(next->point);
+        currentValues.assign(next->values,next->values + 2);
         if (!result.back().isTag(curveTag)) {
           result.back().addTag(curveTag);
         }
-        auto it = std::find(successfulPoints.begin(),
-                            successfulPoints.end(),
-                            result.back());
-        successfulPoints.erase(it);
+        onCurve.insert(next->point.uuid());
+        current = result.back();
       }
-      current = candidate;
+      else {
+        current.reset();
+      }
+    }
+    cache.curve.clear();
+    for (const OptimizationDataPoint& point : result) {
+      cache.curve.push_back(point.uuid());
     }
+    cache.numSearched = numSearched;
 
     // remove outdated tags
     for (OptimizationDataPoint& point : lastCurve) {
@@ -330,8 +454,7 @@ namespace detail {
     DataPointVector temp = analysis.getDataPoints("pareto");
     OptimizationDataPointVector lastParetoFront = castVector<OptimizationDataPoint>(temp);
     OptimizationDataPointVector result;
-    temp = analysis.successfulDataPoints();
-    OptimizationDataPointVector successfulPoints = castVector<OptimizationDataPoint>(temp);
+    std::vector<ObjectivePoint> successfulPoints = getObjectivePoints(analysis.successfulDataPoints());
 
     // sort by objective function options().objectiveToMinimizeFirst()
     int i = sequentialSearchOptions().objectiveToMinimizeFirst();
@@ -342,48 +465,65 @@ namespace detail {
     else {
       OS_ASSERT(i == 1);
     }
-    OptimizationDataPointObjectiveFunctionLess predicate(i);
-    std::sort(successfulPoints.begin(),successfulPoints.end(),predicate);
+
+    // a point dominated by the last front stays dominated, so only the last front and the points
+    // that have completed since need to be considered
+    if (i != m_paretoObjective) {
+      clearParetoFront();
+      m_paretoObjective = i;
+    }
+    std::vector<ObjectivePoint> candidates;
+    std::vector<bool> isNew;
+    if (foldObjectivePoints(successfulPoints,m_paretoFoldedValues,isNew)) {
+      for (unsigned k = 0, n = successfulPoints.size(); k < n; ++k) {
+        if (isNew[k] || (m_paretoFront.find(successfulPoints[k].point.uuid()) != m_paretoFront.end())) {
+          candidates.push_back(successfulPoints[k]);
+        }
+      }
+    }
+    else {
+      LOG(Debug,"Rebuilding the Pareto front from all successful points.");
+      clearParetoFront();
+      m_paretoObjective = i;
+      foldObjectivePoints(successfulPoints,m_paretoFoldedValues,isNew);
+      candidates = successfulPoints;
+    }
+
+    std::sort(candidates.begin(),candidates.end(),
+              [i,otherIndex](const ObjectivePoint& left, const ObjectivePoint& right) {
+                return (left.values[i] < right.values[i]) ||
+                       ((left.values[i] == right.values[i]) && (left.values[otherIndex] < right.values[otherIndex]));
+              });
 
     // non-dominated means that you cannot improve one objective without harming the other
-    auto it = successfulPoints.begin();
-    DoubleVector currentValues;
-    while (it != successfulPoints.end()) {
-      // it has next-worst objective i
-      DoubleVector candidateValues = it->objectiveValues();
-      if (!currentValues.empty()) {
+    m_paretoFront.clear();
+    const double* currentValues = nullptr;
+    for (unsigned k = 0, n = candidates.size(); k < n; ++k) {
+      // k has next-worst objective i
+      const double* candidateValues = candidates[k].values;
+      if (currentValues) {
         OS_ASSERT(greaterThanOrEqual(candidateValues[i],currentValues[i]));
       }
       // is Pareto if improves objective otherIndex, and
-      if (!currentValues.empty() &&
+      if (currentValues &&
           greaterThanOrEqual(candidateValues[otherIndex],currentValues[otherIndex]))
       {
-        it = successfulPoints.erase(it);
         continue;
       }
       // is Pareto if there is no other point with same objective i and better objective otherIndex
-      OptimizationDataPointVector::const_iterator jt = it; ++jt;
-      bool erasedIt(false);
-      while (jt != successfulPoints.end()) {
-        DoubleVector nextValues = jt->objectiveValues();
-        if (equal(candidateValues[i],nextValues[i])) {
-          if (nextValues[otherIndex] < candidateValues[otherIndex]) {
-            it = successfulPoints.erase(it);
-            erasedIt = true;
-            break;
-          }
-          ++jt;
-        }
-        else {
+      bool dominated(false);
+      for (unsigned m = k + 1; (m < n) && equal(candidateValues[i],candidates[m].values[i]); ++m) {
+        if (candidates[m].values[otherIndex] < candidateValues[otherIndex]) {
+          dominated = true;
           break;
         }
       }
-      if (erasedIt) {
+      if (dominated) {
         continue;
       }
-      result.push_back(*it);
-      it = successfulPoints.erase(it);
-      currentValues = result.back().objectiveValues();
+      result.push_back(candidates[k].point);
+      currentValues = candidateValues;
+      m_paretoFront.insert(result.back().uuid());
       if (!result.back().isTag("pareto")) {
         result.back().addTag("pareto");
       }
@@ -400,6 +540,12 @@ namespace detail {
     return result;
   }
 
+  void SequentialSearch_Impl::clearParetoFront() const {
+    m_paretoObjective = -1;
+    m_paretoFoldedValues.clear();
+    m_paretoFront.clear();
+  }
+
   std::vector< std::vector<QVariant> > SequentialSearch_Impl::getCandidateCombinations(
       const DataPoint& dataPoint) const
   {
@@ -32,6 +32,9 @@
 #include "AnalysisAPI.hpp"
 #include "OpenStudioAlgorithm_Impl.hpp"
 
+#include <map>
+#include <set>
+
 namespace openstudio {
 
 namespace analysis {
@@ -92,12 +95,18 @@ namespace detail {
     //@{
 
     /** Get the "swoosh" curve relative to objective function i, i == 0, or i == 1. Throws an
-     *  openstudio::Exception if i is not equal to 0 or 1, or if analysis.algorithm() != *this. */
+     *  openstudio::Exception if i is not equal to 0 or 1, or if analysis.algorithm() != *this. The
+     *  curve is maintained across calls: each step after the baseline compares its last pick against
+     *  the points that have completed since, and only steps past the first change search all points.
+     *  The curve is rebuilt from scratch if a point it has seen is removed or its objective values
+     *  change. */
     std::vector<OptimizationDataPoint> getMinimumCurve(unsigned i,
                                                        Analysis& analysis) const;
 
     /** Get the Pareto front (set of non-dominated points). Throws an openstudio::Exception if
-     *  analysis.algorithm() != *this. */
+     *  analysis.algorithm() != *this. The front is maintained across calls: each successful point
+     *  is compared against the last front once, and the front is only rebuilt from scratch if a
+     *  point it has seen is removed or its objective values change. */
     std::vector<OptimizationDataPoint> getParetoFront(Analysis& analysis) const;
 
     std::vector< std::vector<QVariant> > getCandidateCombinations(const DataPoint& dataPoint) const;
@@ -113,6 +122,27 @@ namespace detail {
     //@}
    private:
     REGISTER_LOGGER("openstudio.analysis.SequentialSearch");
+
+    // objectiveToMinimizeFirst the cached Pareto front was built for, -1 if there is none
+    mutable int m_paretoObjective;
+    // objective values of every successful point folded into the cached Pareto front
+    mutable std::map<UUID, std::pair<double,double> > m_paretoFoldedValues;
+    mutable std::set<UUID> m_paretoFront;
+
+    struct MinimumCurveCache {
+      // objective values of every successful point the curve was built from
+      std::map<UUID, std::pair<double,double> > foldedValues;
+      // the curve, starting from the baseline point
+      std::vector<UUID> curve;
+      // number of points on the curve whose successor was searched for
+      unsigned numSearched;
+
+      MinimumCurveCache() : numSearched(0) {}
+    };
+    // indexed by the objective the curve minimizes first
+    mutable MinimumCurveCache m_minimumCurves[2];
+
+    void clearParetoFront() const;
   };
 
 } // detail
@@ -57,6 +57,10 @@
 #include "../../utilities/bcl/BCLMeasure.hpp"
 #include "../../utilities/data/Tag.hpp"
 
+#include <boost/timer.hpp>
+
+#include <cmath>
+
 #include <resources.hxx>
 #include <OpenStudio.hxx>
 #include <runmanager/Test/ToolBin.hxx>
@@ -260,6 +264,172 @@ TEST_F(AnalysisFixture, Analysis_DataPointsAreInvalid) {
   EXPECT_TRUE(analysis.dataPointsAreInvalid());
 }
 
+TEST_F(AnalysisFixture, Analysis_DataPointLookup) {
+  Analysis analysis("Analysis",
+                    Problem("Problem",VariableVector(),runmanager::Workflow()),
+                    FileReferenceType::OSM);
+
+  // three discrete variables with 50 measures each
+  unsigned numMeasures = 50;
+  RubyMeasure measure(toPath("myMeasure.rb"),
+                      FileReferenceType::OSM,
+                      FileReferenceType::OSM,
+                      true);
+  for (unsigned i = 0; i < 3; ++i) {
+    MeasureVector measures;
+    for (unsigned j = 0; j < numMeasures; ++j) {
+      measures.push_back(measure.clone().cast<RubyMeasure>());
+    }
+    EXPECT_TRUE(analysis.problem().push(MeasureGroup("Variable " + QString::number(i).toStdString(),measures)));
+  }
+
+  unsigned numDataPoints = 100000;
+  std::vector< std::vector<QVariant> > allValues;
+  for (unsigned i = 0; i < numMeasures && allValues.size() < numDataPoints; ++i) {
+    for (unsigned j = 0; j < numMeasures && allValues.size() < numDataPoints; ++j) {
+      for (unsigned k = 0; k < numMeasures && allValues.size() < numDataPoints; ++k) {
+        std::vector<QVariant> values;
+        values.push_back(QVariant(int(i)));
+        values.push_back(QVariant(int(j)));
+        values.push_back(QVariant(int(k)));
+        allValues.push_back(values);
+      }
+    }
+  }
+  ASSERT_EQ(numDataPoints,allValues.size());
+
+  boost::timer t;
+  for (const std::vector<QVariant>& values : allValues) {
+    OptionalDataPoint dataPoint = analysis.problem().createDataPoint(values);
+    ASSERT_TRUE(dataPoint);
+    EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+  }
+  LOG(Info,"Time to add " << numDataPoints << " data points: " << t.elapsed());
+  DataPointVector dataPoints = analysis.dataPoints();
+  ASSERT_EQ(numDataPoints,dataPoints.size());
+
+  // duplicates are rejected
+  OptionalDataPoint duplicate = analysis.problem().createDataPoint(allValues[1234]);
+  ASSERT_TRUE(duplicate);
+  EXPECT_FALSE(analysis.addDataPoint(*duplicate));
+
+  t.restart();
+  for (unsigned i = 0; i < numDataPoints; i += 10) {
+    DataPointVector found = analysis.getDataPoints(allValues[i]);
+    ASSERT_EQ(1u,found.size());
+    EXPECT_TRUE(found[0] == dataPoints[i]);
+  }
+  LOG(Info,"Time to look up " << numDataPoints / 10 << " data points by value: " << t.elapsed());
+
+  t.restart();
+  for (unsigned i = 0; i < numDataPoints; i += 10) {
+    OptionalDataPoint found = analysis.getDataPointByUUID(dataPoints[i].uuid());
+    ASSERT_TRUE(found);
+    EXPECT_TRUE(*found == dataPoints[i]);
+  }
+  LOG(Info,"Time to look up " << numDataPoints / 10 << " data points by UUID: " << t.elapsed());
+
+  // partially specified queries fall back to a scan
+  std::vector<QVariant> partial = allValues[0];
+  partial[2] = QVariant();
+  EXPECT_EQ(numMeasures,analysis.getDataPoints(partial).size());
+  partial.pop_back();
+  EXPECT_EQ(numMeasures,analysis.getDataPoints(partial).size());
+
+  // removal keeps the indexes consistent
+  EXPECT_TRUE(analysis.removeDataPoint(dataPoints[10]));
+  EXPECT_TRUE(analysis.getDataPoints(allValues[10]).empty());
+  EXPECT_FALSE(analysis.getDataPointByUUID(dataPoints[10].uuid()));
+  EXPECT_EQ(1u,analysis.getDataPoints(allValues[11]).size());
+
+  // clearing results does not change the keys
+  EXPECT_TRUE(analysis.clearResults(dataPoints[20]));
+  EXPECT_TRUE(analysis.getDataPointByUUID(dataPoints[20].uuid()));
+  EXPECT_EQ(1u,analysis.getDataPoints(allValues[20]).size());
+
+  analysis.removeAllDataPoints();
+  EXPECT_TRUE(analysis.getDataPoints(allValues[20]).empty());
+  EXPECT_FALSE(analysis.getDataPointByUUID(dataPoints[20].uuid()));
+  OptionalDataPoint dataPoint = analysis.problem().createDataPoint(allValues[20]);
+  ASSERT_TRUE(dataPoint);
+  EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+  EXPECT_EQ(1u,analysis.getDataPoints(allValues[20]).size());
+}
+
+TEST_F(AnalysisFixture, Analysis_DataPointLookup_Continuous) {
+  Analysis analysis("Analysis",
+                    Problem("Problem",VariableVector(),runmanager::Workflow()),
+                    FileReferenceType::OSM);
+
+  // three continuous variables on [0,1]
+  RubyMeasure measure(toPath("myMeasure.rb"),
+                      FileReferenceType::OSM,
+                      FileReferenceType::OSM,
+                      true);
+  for (unsigned i = 0; i < 3; ++i) {
+    std::string name = "x" + QString::number(i).toStdString();
+    RubyContinuousVariable variable(name,OSArgument::makeDoubleArgument(name),measure);
+    variable.setMinimum(0.0);
+    variable.setMaximum(1.0);
+    EXPECT_TRUE(analysis.problem().push(variable));
+  }
+
+  unsigned numSteps = 30;
+  unsigned numDataPoints = numSteps * numSteps * numSteps;
+  std::vector< std::vector<QVariant> > allValues;
+  for (unsigned i = 0; i < numSteps; ++i) {
+    for (unsigned j = 0; j < numSteps; ++j) {
+      for (unsigned k = 0; k < numSteps; ++k) {
+        std::vector<QVariant> values;
+        values.push_back(QVariant(double(i) / double(numSteps)));
+        values.push_back(QVariant(double(j) / double(numSteps)));
+        values.push_back(QVariant(double(k) / double(numSteps)));
+        allValues.push_back(values);
+      }
+    }
+  }
+  ASSERT_EQ(numDataPoints,allValues.size());
+
+  boost::timer t;
+  for (const std::vector<QVariant>& values : allValues) {
+    OptionalDataPoint dataPoint = analysis.problem().createDataPoint(values);
+    ASSERT_TRUE(dataPoint);
+    EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+  }
+  LOG(Info,"Time to add " << numDataPoints << " continuous data points: " << t.elapsed());
+  DataPointVector dataPoints = analysis.dataPoints();
+  ASSERT_EQ(numDataPoints,dataPoints.size());
+
+  t.restart();
+  for (unsigned i = 0; i < numDataPoints; i += 10) {
+    DataPointVector found = analysis.getDataPoints(allValues[i]);
+    ASSERT_EQ(1u,found.size());
+    EXPECT_TRUE(found[0] == dataPoints[i]);
+  }
+  LOG(Info,"Time to look up " << numDataPoints / 10 << " continuous data points by value: " << t.elapsed());
+
+  // values within tolerance are found, whichever side of a cell boundary they land on
+  for (unsigned i = 0; i < numDataPoints; i += 10) {
+    std::vector<QVariant> nearby;
+    for (const QVariant& value : allValues[i]) {
+      nearby.push_back(QVariant(std::nextafter(value.toDouble(),(i % 20 == 0) ? 2.0 : -1.0)));
+    }
+    DataPointVector found = analysis.getDataPoints(nearby);
+    ASSERT_EQ(1u,found.size());
+    EXPECT_TRUE(found[0] == dataPoints[i]);
+  }
+
+  // values outside tolerance are not
+  std::vector<QVariant> offset = allValues[100];
+  offset[1] = QVariant(offset[1].toDouble() + 1.0e-6);
+  EXPECT_TRUE(analysis.getDataPoints(offset).empty());
+
+  // removal keeps the indexes consistent
+  EXPECT_TRUE(analysis.removeDataPoint(dataPoints[10]));
+  EXPECT_TRUE(analysis.getDataPoints(allValues[10]).empty());
+  EXPECT_EQ(1u,analysis.getDataPoints(allValues[11]).size());
+}
+
 TEST_F(AnalysisFixture, Analysis_ClearAllResults) {
   // create dummy problem
   BCLMeasure bclMeasure(resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade"));
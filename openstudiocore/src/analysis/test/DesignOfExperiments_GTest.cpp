@@ -29,8 +29,24 @@
 #include <gtest/gtest.h>
 #include "AnalysisFixture.hpp"
 
+#include "../Analysis.hpp"
+#include "../DataPoint.hpp"
 #include "../DesignOfExperiments.hpp"
 #include "../DesignOfExperimentsOptions.hpp"
+#include "../MeasureGroup.hpp"
+#include "../NullMeasure.hpp"
+#include "../Problem.hpp"
+#include "../RubyContinuousVariable.hpp"
+#include "../RubyMeasure.hpp"
+#include "../TriangularDistribution.hpp"
+
+#include "../../runmanager/lib/Workflow.hpp"
+
+#include "../../ruleset/OSArgument.hpp"
+
+#include "../../utilities/bcl/BCLMeasure.hpp"
+
+#include <resources.hxx>
 
 using namespace openstudio;
 using namespace openstudio::analysis;
@@ -42,3 +58,107 @@ TEST_F(AnalysisFixture, DesignOfExperiments_Construction) {
   EXPECT_EQ(DesignOfExperimentsType(DesignOfExperimentsType::FullFactorial),
             algorithm.designOfExperimentsOptions().designType());
 }
+
+TEST_F(AnalysisFixture, DesignOfExperiments_UnitSamples) {
+  int n = 20;
+  int d = 3;
+
+  // latin hypercube has one sample in each stratum of each dimension
+  std::vector< std::vector<double> > samples = DesignOfExperiments::unitSamples(
+      DesignOfExperimentsType::LatinHypercube,n,d,42);
+  ASSERT_EQ(20u,samples.size());
+  for (int j = 0; j < d; ++j) {
+    std::vector<int> counts(n,0);
+    for (const std::vector<double>& sample : samples) {
+      ASSERT_EQ(3u,sample.size());
+      EXPECT_GT(sample[j],0.0);
+      EXPECT_LT(sample[j],1.0);
+      ++counts[int(sample[j] * n)];
+    }
+    for (int count : counts) {
+      EXPECT_EQ(1,count);
+    }
+  }
+
+  // repeatable for a fixed seed
+  EXPECT_TRUE(samples == DesignOfExperiments::unitSamples(DesignOfExperimentsType::LatinHypercube,n,d,42));
+  EXPECT_FALSE(samples == DesignOfExperiments::unitSamples(DesignOfExperimentsType::LatinHypercube,n,d,43));
+
+  samples = DesignOfExperiments::unitSamples(DesignOfExperimentsType::MonteCarlo,n,d,42);
+  ASSERT_EQ(20u,samples.size());
+  EXPECT_TRUE(samples == DesignOfExperiments::unitSamples(DesignOfExperimentsType::MonteCarlo,n,d,42));
+  for (const std::vector<double>& sample : samples) {
+    for (double value : sample) {
+      EXPECT_GT(value,0.0);
+      EXPECT_LT(value,1.0);
+    }
+  }
+
+  // halton uses bases 2, 3, 5
+  samples = DesignOfExperiments::unitSamples(DesignOfExperimentsType::Halton,n,d,42);
+  ASSERT_EQ(20u,samples.size());
+  EXPECT_DOUBLE_EQ(0.5,samples[0][0]);
+  EXPECT_DOUBLE_EQ(0.25,samples[1][0]);
+  EXPECT_DOUBLE_EQ(0.75,samples[2][0]);
+  EXPECT_DOUBLE_EQ(1.0/3.0,samples[0][1]);
+  EXPECT_DOUBLE_EQ(2.0/3.0,samples[1][1]);
+  EXPECT_DOUBLE_EQ(1.0/9.0,samples[2][1]);
+  EXPECT_DOUBLE_EQ(0.2,samples[0][2]);
+
+  EXPECT_TRUE(DesignOfExperiments::unitSamples(DesignOfExperimentsType::FullFactorial,n,d,42).empty());
+}
+
+TEST_F(AnalysisFixture, DesignOfExperiments_LatinHypercube) {
+  BCLMeasure bclMeasure(resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade"));
+  RubyMeasure measure(bclMeasure);
+
+  Problem problem("Problem",VariableVector(),runmanager::Workflow());
+  ruleset::OSArgument wwr = ruleset::OSArgument::makeDoubleArgument("wwr");
+  RubyContinuousVariable wwrCV("Window to Wall Ratio",wwr,measure);
+  wwrCV.setMinimum(0.0);
+  wwrCV.setMaximum(1.0);
+  wwrCV.setUncertaintyDescription(TriangularDistribution(0.2,0.0,0.5));
+  problem.push(wwrCV);
+  MeasureVector measures(1u,NullMeasure());
+  measures.push_back(measure.clone().cast<Measure>());
+  problem.push(MeasureGroup("Optional Measure",measures));
+
+  DesignOfExperimentsOptions options(DesignOfExperimentsType::LatinHypercube);
+  DesignOfExperiments algorithm(options);
+  EXPECT_TRUE(algorithm.isCompatibleProblemType(problem));
+
+  // number of samples is required
+  Analysis analysis("Analysis",problem,algorithm,FileReference(toPath("./in.osm")));
+  EXPECT_EQ(0,algorithm.createNextIteration(analysis));
+  EXPECT_TRUE(analysis.dataPoints().empty());
+
+  EXPECT_TRUE(algorithm.designOfExperimentsOptions().setSamples(25));
+  EXPECT_FALSE(algorithm.designOfExperimentsOptions().seed());
+  EXPECT_EQ(25,algorithm.createNextIteration(analysis));
+  EXPECT_TRUE(algorithm.designOfExperimentsOptions().seed());
+
+  DataPointVector dataPoints = analysis.dataPoints();
+  ASSERT_EQ(25u,dataPoints.size());
+  int numNull(0);
+  for (const DataPoint& dataPoint : dataPoints) {
+    std::vector<QVariant> values = dataPoint.variableValues();
+    ASSERT_EQ(2u,values.size());
+    EXPECT_EQ(QVariant::Double,values[0].type());
+    EXPECT_GE(values[0].toDouble(),0.0);
+    EXPECT_LE(values[0].toDouble(),0.5);
+    EXPECT_TRUE(dataPoint.isTag("DOE"));
+    if (values[1].toInt() == 0) {
+      ++numNull;
+    }
+  }
+  // stratified over the discrete variable too
+  EXPECT_TRUE((numNull == 12) || (numNull == 13));
+
+  // same seed regenerates the same points, so nothing more is added
+  EXPECT_EQ(0,algorithm.createNextIteration(analysis));
+  EXPECT_TRUE(algorithm.isComplete());
+
+  // full factorial does not accept continuous variables
+  algorithm.designOfExperimentsOptions().setDesignType(DesignOfExperimentsType::FullFactorial);
+  EXPECT_FALSE(algorithm.isCompatibleProblemType(problem));
+}
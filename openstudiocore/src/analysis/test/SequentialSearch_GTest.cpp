@@ -52,6 +52,8 @@
 
 #include <QVariant>
 
+#include <set>
+
 using namespace openstudio;
 using namespace openstudio::analysis;
 
@@ -281,3 +283,180 @@ TEST_F(AnalysisFixture, SequentialSearch) {
   values = paretoFront[3].objectiveValues();
   EXPECT_DOUBLE_EQ(20.0,values[0]); EXPECT_DOUBLE_EQ(12.0,values[1]); // minimizes f1
 }
+
+TEST_F(AnalysisFixture, SequentialSearch_IncrementalParetoFront) {
+  VariableVector variables;
+  std::stringstream ss;
+  for (int i = 0; i < 5; ++i) {
+    MeasureVector measures;
+    measures.push_back(NullMeasure());
+    measures.push_back(RubyMeasure(toPath("in.rb"),FileReferenceType::OSM,FileReferenceType::OSM));
+    ss << "var " << i + 1;
+    variables.push_back(MeasureGroup(ss.str(),measures));
+    ss.str("");
+  }
+  FunctionVector functions;
+  functions.push_back(LinearFunction("",VariableVector(1u,OutputAttributeContinuousVariable("f1","f1"))));
+  functions.push_back(LinearFunction("",VariableVector(1u,OutputAttributeContinuousVariable("f2","f2"))));
+  OptimizationProblem problem("By-Hand Problem",functions,variables,runmanager::Workflow());
+
+  SequentialSearch algorithm(SequentialSearchOptions(0));
+  Analysis analysis("By-Hand Analysis",problem,algorithm,FileReference(toPath("in.osm")));
+
+  // non-dominated objective value pairs, computed by brute force
+  auto expectedFront = [](const std::vector< std::pair<double,double> >& allValues) {
+    std::set< std::pair<double,double> > result;
+    for (const std::pair<double,double>& p : allValues) {
+      bool dominated(false);
+      for (const std::pair<double,double>& q : allValues) {
+        if ((q.first <= p.first) && (q.second <= p.second) &&
+            ((q.first < p.first) || (q.second < p.second)))
+        {
+          dominated = true;
+          break;
+        }
+      }
+      if (!dominated) {
+        result.insert(p);
+      }
+    }
+    return result;
+  };
+
+  // complete all 32 combinations in batches, updating the front after each batch
+  std::vector< std::pair<double,double> > completedValues;
+  OptimizationDataPointVector completedPoints;
+  for (int k = 0; k < 32; ++k) {
+    std::vector<QVariant> values;
+    for (int i = 0; i < 5; ++i) {
+      values.push_back(QVariant((k >> i) & 1));
+    }
+    DoubleVector objectiveValues = getObjectiveValues(values);
+    OptimizationDataPoint point(createUUID(),
+                                createUUID(),
+                                "","","",
+                                problem,
+                                true,
+                                false,
+                                true,
+                                DataPointRunType::Local,
+                                values,
+                                DoubleVector(),
+                                objectiveValues,
+                                openstudio::path(),
+                                boost::none,
+                                boost::none,
+                                boost::none,
+                                boost::none,
+                                std::vector<openstudio::path>(),
+                                std::vector<Tag>(),
+                                std::vector<Attribute>());
+    ASSERT_TRUE(analysis.addDataPoint(point));
+    completedPoints.push_back(point);
+    completedValues.push_back(std::make_pair(objectiveValues[0],objectiveValues[1]));
+
+    if (k % 8 == 7) {
+      OptimizationDataPointVector paretoFront = algorithm.getParetoFront(analysis);
+      std::set< std::pair<double,double> > frontValues;
+      for (const OptimizationDataPoint& paretoPoint : paretoFront) {
+        DoubleVector values = paretoPoint.objectiveValues();
+        frontValues.insert(std::make_pair(values[0],values[1]));
+        EXPECT_TRUE(paretoPoint.isTag("pareto"));
+      }
+      EXPECT_EQ(paretoFront.size(),frontValues.size());
+      EXPECT_TRUE(expectedFront(completedValues) == frontValues);
+      EXPECT_EQ(paretoFront.size(),analysis.getDataPoints("pareto").size());
+    }
+  }
+
+  // removing a front member rebuilds the front
+  OptimizationDataPointVector paretoFront = algorithm.getParetoFront(analysis);
+  ASSERT_FALSE(paretoFront.empty());
+  DoubleVector removedValues = paretoFront[0].objectiveValues();
+  EXPECT_TRUE(analysis.removeDataPoint(paretoFront[0]));
+  auto it = std::find(completedValues.begin(),
+                      completedValues.end(),
+                      std::make_pair(removedValues[0],removedValues[1]));
+  ASSERT_TRUE(it != completedValues.end());
+  completedValues.erase(it);
+  paretoFront = algorithm.getParetoFront(analysis);
+  std::set< std::pair<double,double> > frontValues;
+  for (const OptimizationDataPoint& paretoPoint : paretoFront) {
+    DoubleVector values = paretoPoint.objectiveValues();
+    frontValues.insert(std::make_pair(values[0],values[1]));
+  }
+  EXPECT_TRUE(expectedFront(completedValues) == frontValues);
+}
+
+TEST_F(AnalysisFixture, SequentialSearch_IncrementalMinimumCurve) {
+  VariableVector variables;
+  std::stringstream ss;
+  for (int i = 0; i < 5; ++i) {
+    MeasureVector measures;
+    measures.push_back(NullMeasure());
+    measures.push_back(RubyMeasure(toPath("in.rb"),FileReferenceType::OSM,FileReferenceType::OSM));
+    ss << "var " << i + 1;
+    variables.push_back(MeasureGroup(ss.str(),measures));
+    ss.str("");
+  }
+  FunctionVector functions;
+  functions.push_back(LinearFunction("",VariableVector(1u,OutputAttributeContinuousVariable("f1","f1"))));
+  functions.push_back(LinearFunction("",VariableVector(1u,OutputAttributeContinuousVariable("f2","f2"))));
+  OptimizationProblem problem("By-Hand Problem",functions,variables,runmanager::Workflow());
+
+  SequentialSearch algorithm(SequentialSearchOptions(0));
+  Analysis analysis("By-Hand Analysis",problem,algorithm,FileReference(toPath("in.osm")));
+
+  // complete all 32 combinations in batches, comparing each curve to one built from scratch
+  for (int k = 0; k < 32; ++k) {
+    std::vector<QVariant> values;
+    for (int i = 0; i < 5; ++i) {
+      values.push_back(QVariant((k >> i) & 1));
+    }
+    std::vector<Tag> tags;
+    if (k == 0) {
+      tags.push_back(Tag("iter0"));
+    }
+    OptimizationDataPoint point(createUUID(),
+                                createUUID(),
+                                "","","",
+                                problem,
+                                true,
+                                false,
+                                true,
+                                DataPointRunType::Local,
+                                values,
+                                DoubleVector(),
+                                getObjectiveValues(values),
+                                openstudio::path(),
+                                boost::none,
+                                boost::none,
+                                boost::none,
+                                boost::none,
+                                std::vector<openstudio::path>(),
+                                tags,
+                                std::vector<Attribute>());
+    ASSERT_TRUE(analysis.addDataPoint(point));
+
+    if (k % 4 == 3) {
+      for (unsigned i = 0; i < 2; ++i) {
+        OptimizationDataPointVector minimumCurve = algorithm.getMinimumCurve(i,analysis);
+        SequentialSearch rebuilt = algorithm.clone().cast<SequentialSearch>();
+        EXPECT_TRUE(rebuilt.getMinimumCurve(i,analysis) == minimumCurve);
+        ASSERT_FALSE(minimumCurve.empty());
+        // as createNextIteration does for the end of the curve
+        if (!minimumCurve.back().isTag("explored")) {
+          minimumCurve.back().addTag("explored");
+        }
+      }
+    }
+  }
+
+  // removing a curve point rebuilds the curve
+  OptimizationDataPointVector minimumCurve = algorithm.getMinimumCurve(0,analysis);
+  ASSERT_LT(1u,minimumCurve.size());
+  EXPECT_TRUE(analysis.removeDataPoint(minimumCurve[1]));
+  minimumCurve = algorithm.getMinimumCurve(0,analysis);
+  SequentialSearch rebuilt = algorithm.clone().cast<SequentialSearch>();
+  EXPECT_TRUE(rebuilt.getMinimumCurve(0,analysis) == minimumCurve);
+}
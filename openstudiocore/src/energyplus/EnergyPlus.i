@@ -26,6 +26,7 @@
 #endif
 
 %{
+  #include <energyplus/TranslationProfiler.hpp>
   #include <energyplus/ForwardTranslator.hpp>
   #include <energyplus/ReverseTranslator.hpp>
   #include <energyplus/ErrorFile.hpp>
@@ -46,7 +47,13 @@
 %ignore ForwardTranslatorInitializer;
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
+// profiling scopes are only used inside the translators
+%ignore openstudio::energyplus::TranslationProfiler::Scope;
+%ignore openstudio::energyplus::TranslationProfiler::begin;
+%ignore openstudio::energyplus::TranslationProfiler::end;
+
 %include <energyplus/ErrorFile.hpp>
+%include <energyplus/TranslationProfiler.hpp>
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
 
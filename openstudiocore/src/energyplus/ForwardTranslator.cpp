@@ -74,6 +74,7 @@
 #include <utilities/idd/Output_VariableDictionary_FieldEnums.hxx>
 #include <utilities/idd/Output_SQLite_FieldEnums.hxx>
 #include <utilities/idd/LifeCycleCost_NonrecurringCost_FieldEnums.hxx>
+#include <utilities/idd/OS_Schedule_Rule_FieldEnums.hxx>
 #include <utilities/idd/SetpointManager_MixedAir_FieldEnums.hxx>
 
 #include "../utilities/idd/IddEnums.hpp"
@@ -103,6 +104,8 @@ ForwardTranslator::ForwardTranslator()
   m_keepRunControlSpecialDays = false;
   m_ipTabularOutput = false;
   m_excludeLCCObjects = false;
+
+  m_lastTranslationIncremental = false;
 }
 
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
@@ -115,6 +118,8 @@ Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* p
     m_progressBar->setMaximum(model.numObjects());
   }
 
+  m_lastTranslationIncremental = false;
+
   return translateModelPrivate(modelCopy, true);
 }
 
@@ -125,14 +130,97 @@ Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
 
   m_progressBar = nullptr;
 
+  m_lastTranslationIncremental = false;
+
   return translateModelPrivate(modelCopy, false);
 }
 
+Workspace ForwardTranslator::translateModelIncremental( const Model & model, ProgressBar* progressBar )
+{
+  if (m_baselineWorkspace && (m_baselineOptions == translationOptions())){
+    boost::optional<Workspace> result = translateModelDelta(model);
+    if (result){
+      m_lastTranslationIncremental = true;
+      if (progressBar){
+        progressBar->setMinimum(0);
+        progressBar->setMaximum(model.numObjects());
+        progressBar->setValue(model.numObjects());
+      }
+      return *result;
+    }
+
+    LOG(Info, "Model differs from the baseline in ways that cannot be translated incrementally, translating the full model.");
+    return translateModel(model, progressBar);
+  }
+
+  // keep handles so that later models can be compared to the baseline object by object
+  Model modelCopy = model.clone(true).cast<Model>();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  m_lastTranslationIncremental = false;
+
+  Workspace workspace = translateModelPrivate(modelCopy, true);
+
+  m_baselineWorkspace = workspace.clone(true);
+
+  m_baselineMap.clear();
+  m_baselineMap.insert(m_map.begin(), m_map.end());
+
+  ModelObjectFieldsMap fields = modelFields(model);
+  m_baselineFields.swap(fields);
+
+  m_baselineConstructionSummary = constructionSummary(model);
+
+  // constructions paired up across matched surfaces depend on each other's layers
+  m_baselineReversedConstructions.clear();
+  for (const auto& reversed : m_constructionHandleToReversedConstructions){
+    m_baselineReversedConstructions.insert(reversed.first);
+    m_baselineReversedConstructions.insert(reversed.second.handle());
+  }
+
+  m_baselineLogMessages = m_logSink.logMessages();
+
+  m_baselineOptions = translationOptions();
+
+  return workspace;
+}
+
+bool ForwardTranslator::lastTranslationWasIncremental() const
+{
+  return m_lastTranslationIncremental;
+}
+
+void ForwardTranslator::clearBaseline()
+{
+  m_baselineWorkspace.reset();
+  m_baselineMap.clear();
+  m_baselineFields.clear();
+  m_baselineConstructionSummary.clear();
+  m_baselineReversedConstructions.clear();
+  m_baselineLogMessages.clear();
+  m_baselineOptions.clear();
+  m_lastTranslationIncremental = false;
+}
+
 std::vector<LogMessage> ForwardTranslator::warnings() const
 {
   std::vector<LogMessage> result;
 
-  for (LogMessage logMessage : m_logSink.logMessages()){
+  // an incremental translation also reports the messages of its baseline
+  std::vector<LogMessage> logMessages;
+  if (m_lastTranslationIncremental){
+    logMessages = m_baselineLogMessages;
+  }
+  for (const LogMessage& logMessage : m_logSink.logMessages()){
+    logMessages.push_back(logMessage);
+  }
+
+  for (LogMessage logMessage : logMessages){
     if (logMessage.logLevel() == Warn){
       result.push_back(logMessage);
     }
@@ -145,7 +233,16 @@ std::vector<LogMessage> ForwardTranslator::errors() const
 {
   std::vector<LogMessage> result;
 
-  for (LogMessage logMessage : m_logSink.logMessages()){
+  // an incremental translation also reports the messages of its baseline
+  std::vector<LogMessage> logMessages;
+  if (m_lastTranslationIncremental){
+    logMessages = m_baselineLogMessages;
+  }
+  for (const LogMessage& logMessage : m_logSink.logMessages()){
+    logMessages.push_back(logMessage);
+  }
+
+  for (LogMessage logMessage : logMessages){
     if (logMessage.logLevel() > Warn){
       result.push_back(logMessage);
     }
@@ -170,6 +267,11 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
   m_excludeLCCObjects = excludeLCCObjects;
 }
 
+TranslationProfiler& ForwardTranslator::profiler()
+{
+  return m_profiler;
+}
+
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
   reset();
@@ -178,6 +280,8 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   model::Version version = model.getUniqueModelObject<model::Version>();
   translateAndMapModelObject(version);
 
+  TranslationProfiler::Scope preprocessingScope(m_profiler, "Model Preprocessing", m_idfObjects);
+
   // resolve surface marching conflicts before combining thermal zones or removing spaces
   // as those operations may change search distances
   resolveMatchedSurfaceConstructionConflicts(model);
@@ -351,6 +455,8 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     }
   }
 
+  preprocessingScope.end();
+
   if (fullModelTranslation){
 
     // translate life cycle cost parameters
@@ -457,6 +563,8 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     this->createStandardOutputRequests();
   }
 
+  TranslationProfiler::Scope constructionScope(m_profiler, "Workspace Construction", m_idfObjects);
+
   Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
   OptionalWorkspaceObject vo = workspace.versionObject();
   OS_ASSERT(vo);
@@ -467,9 +575,318 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   workspace.setFastNaming(false);
   OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
 
+  constructionScope.end();
+
   return workspace;
 }
 
+boost::optional<Workspace> ForwardTranslator::translateModelDelta( const model::Model& model )
+{
+  OS_ASSERT(m_baselineWorkspace);
+
+  // the model must contain exactly the objects of the baseline
+  std::vector<WorkspaceObject> objects = model.objects();
+  if (objects.size() != m_baselineFields.size()){
+    return boost::none;
+  }
+
+  std::vector<Handle> changed;
+  for (const WorkspaceObject& object : objects){
+    auto baselineIt = m_baselineFields.find(object.handle());
+    if (baselineIt == m_baselineFields.end()){
+      return boost::none;
+    }
+    if (!hasFields(object, baselineIt->second)){
+      changed.push_back(object.handle());
+    }
+  }
+
+  if (!changed.empty() && (constructionSummary(model) != m_baselineConstructionSummary)){
+    LOG(Debug, "Construction properties used by surface translation changed.");
+    return boost::none;
+  }
+
+  // schedule rules are not translated themselves, the schedule ruleset they belong to is retranslated instead
+  std::vector<Handle> retranslated;
+  for (const Handle& handle : changed){
+    boost::optional<ModelObject> modelObject = model.getModelObject<ModelObject>(handle);
+    if (!modelObject){
+      return boost::none;
+    }
+
+    if (boost::optional<model::ScheduleRule> scheduleRule = modelObject->optionalCast<model::ScheduleRule>()){
+      // a rule moved to another ruleset changes both rulesets
+      const std::vector<std::string>& baselineFields = m_baselineFields.find(handle)->second.second;
+      if ((baselineFields.size() <= OS_Schedule_RuleFields::ScheduleRulesetName) ||
+          (scheduleRule->getString(OS_Schedule_RuleFields::ScheduleRulesetName).get_value_or("") != baselineFields[OS_Schedule_RuleFields::ScheduleRulesetName])){
+        return boost::none;
+      }
+      modelObject = scheduleRule->scheduleRuleset();
+    }
+
+    if (std::find(retranslated.begin(), retranslated.end(), modelObject->handle()) == retranslated.end()){
+      retranslated.push_back(modelObject->handle());
+    }
+  }
+
+  for (const Handle& handle : retranslated){
+    boost::optional<ModelObject> modelObject = model.getModelObject<ModelObject>(handle);
+    if (!modelObject || !isIncrementallyTranslatable(modelObject->iddObject().type())){
+      return boost::none;
+    }
+
+    auto mapIt = m_baselineMap.find(handle);
+    if (mapIt == m_baselineMap.end()){
+      return boost::none;
+    }
+
+    // other objects refer to the translated object by name
+    boost::optional<std::string> name = modelObject->name();
+    boost::optional<std::string> baselineName = mapIt->second.name();
+    if (!name || !baselineName || (*name != *baselineName)){
+      return boost::none;
+    }
+
+    if (m_baselineReversedConstructions.find(handle) != m_baselineReversedConstructions.end()){
+      return boost::none;
+    }
+
+    // a construction that now reverses a matched surface construction would be used in place of a generated one
+    if (boost::optional<model::Construction> construction = modelObject->optionalCast<model::Construction>()){
+      model::MaterialVector layers = construction->layers();
+      for (const Handle& reversedHandle : m_baselineReversedConstructions){
+        boost::optional<model::Construction> other = model.getModelObject<model::Construction>(reversedHandle);
+        if (!other){
+          continue;
+        }
+        model::MaterialVector otherLayers = other->layers();
+        if (otherLayers.size() != layers.size()){
+          continue;
+        }
+        if (std::equal(layers.begin(), layers.end(), otherLayers.rbegin(),
+                       [](const model::Material& a, const model::Material& b){ return a.handle() == b.handle(); })){
+          return boost::none;
+        }
+      }
+    }
+  }
+
+  reset();
+
+  m_progressBar = nullptr;
+
+  if (changed.empty()){
+    return m_baselineWorkspace->clone(true);
+  }
+
+  // the retranslated objects only read the objects they point to, directly or through their targets,
+  // except for schedule rulesets which also read the rules that point to them
+  std::vector<Handle> subset;
+  std::set<Handle> visited;
+  std::vector<WorkspaceObject> toVisit;
+  for (const Handle& handle : retranslated){
+    toVisit.push_back(model.getObject(handle).get());
+  }
+  while (!toVisit.empty()){
+    WorkspaceObject object = toVisit.back();
+    toVisit.pop_back();
+    if (visited.insert(object.handle()).second){
+      subset.push_back(object.handle());
+      for (const WorkspaceObject& target : object.targets()){
+        toVisit.push_back(target);
+      }
+      if (boost::optional<model::ScheduleRuleset> scheduleRuleset = object.optionalCast<model::ScheduleRuleset>()){
+        for (const model::ScheduleRule& scheduleRule : scheduleRuleset->scheduleRules()){
+          toVisit.push_back(scheduleRule);
+        }
+      }
+    }
+  }
+
+  // schedule rulesets are laid out over the calendar year of the model
+  if (boost::optional<model::YearDescription> yearDescription = model.yearDescription()){
+    if (visited.insert(yearDescription->handle()).second){
+      subset.push_back(yearDescription->handle());
+    }
+  }
+
+  Model modelSubset = model.cloneSubset(subset, true).cast<Model>();
+
+  std::vector<std::pair<Handle, IdfObject> > translated;
+  std::map<Handle, std::vector<IdfObject> > weekSchedules;
+  std::vector<IdfObject> dependencies;
+  for (const Handle& handle : retranslated){
+    ModelObject modelObject = modelSubset.getModelObject<ModelObject>(handle).get();
+    size_t numIdfObjects = m_idfObjects.size();
+    boost::optional<IdfObject> idfObject = translateAndMapModelObject(modelObject);
+
+    const IdfObject& baselineObject = m_baselineMap.find(handle)->second;
+    if (!idfObject || (idfObject->iddObject().type() != baselineObject.iddObject().type())){
+      return boost::none;
+    }
+    translated.push_back(std::make_pair(baselineObject.handle(), *idfObject));
+
+    // a schedule ruleset also generates week schedules, and translates the day schedules and limits it uses
+    if (modelObject.iddObject().type() == IddObjectType::OS_Schedule_Ruleset){
+      std::vector<IdfObject>& weeks = weekSchedules[baselineObject.handle()];
+      for (size_t i = numIdfObjects; i < m_idfObjects.size(); ++i){
+        if (m_idfObjects[i].iddObject().type() == IddObjectType::Schedule_Week_Daily){
+          weeks.push_back(m_idfObjects[i]);
+        }else if (m_idfObjects[i].handle() != idfObject->handle()){
+          dependencies.push_back(m_idfObjects[i]);
+        }
+      }
+    }
+  }
+
+  Workspace workspace = m_baselineWorkspace->clone(true);
+
+  // the day schedules and limits must already be in the baseline, changed ones are swapped in on their own
+  for (const IdfObject& dependency : dependencies){
+    boost::optional<std::string> name = dependency.name();
+    if (!name || !workspace.getObjectByTypeAndName(dependency.iddObject().type(), *name)){
+      return boost::none;
+    }
+  }
+
+  for (auto& translatedObject : translated){
+    boost::optional<WorkspaceObject> currentObject = workspace.getObject(translatedObject.first);
+    if (!currentObject){
+      return boost::none;
+    }
+
+    // the week schedules of a schedule ruleset are replaced along with its year schedule
+    std::vector<Handle> oldWeeks;
+    auto weeksIt = weekSchedules.find(translatedObject.first);
+    if (weeksIt != weekSchedules.end()){
+      for (const WorkspaceObject& target : currentObject->targets()){
+        if (target.iddObject().type() == IddObjectType::Schedule_Week_Daily){
+          oldWeeks.push_back(target.handle());
+        }
+      }
+      if (workspace.addObjects(weeksIt->second).size() != weeksIt->second.size()){
+        return boost::none;
+      }
+    }
+
+    // swap resolves the references of the new object by name and repoints the sources of the current one
+    if (!workspace.swap(*currentObject, translatedObject.second)){
+      return boost::none;
+    }
+
+    if (!oldWeeks.empty() && !workspace.removeObjects(oldWeeks)){
+      return boost::none;
+    }
+  }
+
+  LOG(Debug, "Retranslated " << retranslated.size() << " of " << objects.size() << " objects from a subset of " << subset.size() << ".");
+
+  return workspace;
+}
+
+ForwardTranslator::ModelObjectFieldsMap ForwardTranslator::modelFields(const model::Model& model)
+{
+  ModelObjectFieldsMap result;
+
+  // pointer fields return the name of their target, so renaming an object also changes the objects that refer to it
+  for (const WorkspaceObject& object : model.objects()){
+    std::vector<std::string> fields;
+    fields.reserve(object.numFields());
+    for (unsigned i = 0, n = object.numFields(); i < n; ++i){
+      boost::optional<std::string> value = object.getString(i);
+      fields.push_back(value ? *value : std::string());
+    }
+    result.insert(std::make_pair(object.handle(), std::make_pair(object.iddObject().type(), fields)));
+  }
+
+  return result;
+}
+
+bool ForwardTranslator::hasFields(const WorkspaceObject& object, const std::pair<IddObjectType, std::vector<std::string> >& fields)
+{
+  if ((object.iddObject().type() != fields.first) || (object.numFields() != fields.second.size())){
+    return false;
+  }
+
+  for (unsigned i = 0, n = object.numFields(); i < n; ++i){
+    boost::optional<std::string> value = object.getString(i);
+    if ((value ? *value : std::string()) != fields.second[i]){
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::string ForwardTranslator::constructionSummary(const model::Model& model)
+{
+  std::stringstream ss;
+
+  std::vector<model::ConstructionBase> constructions = model.getModelObjects<model::ConstructionBase>();
+  std::sort(constructions.begin(), constructions.end(),
+            [](const model::ConstructionBase& a, const model::ConstructionBase& b){ return a.handle() < b.handle(); });
+
+  // surface translation reads fenestration and air wall status, shading surface translation the outer layer reflectance
+  for (const model::ConstructionBase& construction : constructions){
+    ss << toString(construction.handle()) << "," << construction.isFenestration() << "," << construction.isModelPartition();
+
+    if (boost::optional<model::LayeredConstruction> layeredConstruction = construction.optionalCast<model::LayeredConstruction>()){
+      model::MaterialVector layers = layeredConstruction->layers();
+      ss << "," << ((layers.size() == 1u) && layers[0].optionalCast<model::AirWallMaterial>());
+      if (!layers.empty()){
+        boost::optional<double> solarReflectance;
+        boost::optional<double> visibleReflectance;
+        if (boost::optional<model::StandardOpaqueMaterial> material = layers[0].optionalCast<model::StandardOpaqueMaterial>()){
+          solarReflectance = material->solarReflectance();
+          visibleReflectance = material->visibleReflectance();
+        }else if (boost::optional<model::MasslessOpaqueMaterial> material = layers[0].optionalCast<model::MasslessOpaqueMaterial>()){
+          solarReflectance = material->solarReflectance();
+          visibleReflectance = material->visibleReflectance();
+        }
+        if (solarReflectance){
+          ss << "," << *solarReflectance;
+        }
+        if (visibleReflectance){
+          ss << "," << *visibleReflectance;
+        }
+      }
+    }
+
+    ss << ";";
+  }
+
+  return ss.str();
+}
+
+bool ForwardTranslator::isIncrementallyTranslatable(const IddObjectType& iddObjectType)
+{
+  switch (iddObjectType.value()){
+  case openstudio::IddObjectType::OS_Material :
+  case openstudio::IddObjectType::OS_Material_AirGap :
+  case openstudio::IddObjectType::OS_Material_NoMass :
+  case openstudio::IddObjectType::OS_WindowMaterial_Gas :
+  case openstudio::IddObjectType::OS_WindowMaterial_Glazing :
+  case openstudio::IddObjectType::OS_WindowMaterial_SimpleGlazingSystem :
+  case openstudio::IddObjectType::OS_Construction :
+  case openstudio::IddObjectType::OS_Schedule_Compact :
+  case openstudio::IddObjectType::OS_Schedule_Constant :
+  case openstudio::IddObjectType::OS_Schedule_Day :
+  case openstudio::IddObjectType::OS_Schedule_Ruleset :
+    return true;
+  default:
+    return false;
+  }
+}
+
+std::vector<bool> ForwardTranslator::translationOptions() const
+{
+  std::vector<bool> result;
+  result.push_back(m_keepRunControlSpecialDays);
+  result.push_back(m_ipTabularOutput);
+  result.push_back(m_excludeLCCObjects);
+  return result;
+}
+
 // struct for sorting children in forward translator
 struct ChildSorter {
   ChildSorter(std::vector<IddObjectType>& iddObjectTypes)
@@ -517,6 +934,8 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
 
   LOG(Trace,"Translating " << modelObject.briefDescription() << ".");
 
+  TranslationProfiler::Scope profilerScope(m_profiler, modelObject.iddObject().type(), m_idfObjects);
+
   switch(modelObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::OS_AirConditioner_VariableRefrigerantFlow :
@@ -30,6 +30,7 @@
 #define ENERGYPLUS_FORWARDTRANSLATOR_HPP
 
 #include "EnergyPlusAPI.hpp"
+#include "TranslationProfiler.hpp"
 #include "../model/Model.hpp"
 #include "../model/ConstructionBase.hpp"
 #include "../model/HVACComponent.hpp"
@@ -38,6 +39,8 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/time/Time.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -377,6 +380,28 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
 
+  /** Translates the given Model to a Workspace, reusing the translation of a baseline model where possible.
+   *  The first call, and the first call after clearBaseline(), performs a full translation and records it
+   *  as the baseline.  Later calls compare the model to the baseline object by object.  If the only differences
+   *  are field changes to materials, constructions, or schedules that keep their names, only those objects are
+   *  retranslated and spliced into a copy of the baseline Workspace.  Supported schedules are Schedule:Constant,
+   *  Schedule:Compact, day schedules, and schedule rulesets; a changed rule retranslates its ruleset, replacing
+   *  the Schedule:Year and its Schedule:Week:Daily objects.  Any other difference, including a new day schedule
+   *  or a rule moved to another ruleset, falls back to translateModel, and the baseline is kept.
+   *
+   *  The baseline keeps a string copy of every field in the model, and each call compares every field against
+   *  it, so change detection costs roughly as much as copying the model.
+   */
+  Workspace translateModelIncremental( const model::Model & model, ProgressBar* progressBar=nullptr );
+
+  /** Returns true if the last translation was produced from the baseline by translateModelIncremental.
+   */
+  bool lastTranslationWasIncremental() const;
+
+  /** Discards the baseline recorded by translateModelIncremental.
+   */
+  void clearBaseline();
+
   /** Get warning messages generated by the last translation.
    */
   std::vector<LogMessage> warnings() const;
@@ -401,6 +426,11 @@ class ENERGYPLUS_API ForwardTranslator {
     */
   void setExcludeLCCObjects(bool excludeLCCObjects);
 
+  /** Profiler recording the time spent in each type specific translate function.  Profiling is disabled
+   *  until enabled with profiler().setEnabled(true).
+   */
+  TranslationProfiler& profiler();
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -422,6 +452,11 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelPrivate( model::Model& model, bool fullModelTranslation );
 
+  /** Retranslates the objects of model that differ from the baseline and splices them into a copy of the
+   *  baseline Workspace.  Returns an empty optional if the differences cannot be translated in isolation.
+   */
+  boost::optional<Workspace> translateModelDelta( const model::Model& model );
+
   boost::optional<IdfObject> translateAndMapModelObject( model::ModelObject & modelObject );
 
   boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow( model::AirConditionerVariableRefrigerantFlow & modelObject );
@@ -1153,6 +1188,8 @@ class ENERGYPLUS_API ForwardTranslator {
 
   typedef std::map<const openstudio::Handle, const IdfObject> ModelObjectMap;
 
+  typedef std::map<const openstudio::Handle, const std::pair<IddObjectType, std::vector<std::string> > > ModelObjectFieldsMap;
+
   typedef std::map<const std::string, const std::string> FluidPropertiesMap;
 
   FluidPropertiesMap m_fluidPropertiesMap;
@@ -1167,6 +1204,8 @@ class ENERGYPLUS_API ForwardTranslator {
 
   ProgressBar* m_progressBar;
 
+  TranslationProfiler m_profiler;
+
   friend struct detail::ForwardTranslatorInitializer;
 
   // temp code
@@ -1175,6 +1214,38 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_ipTabularOutput;
 
   bool m_excludeLCCObjects;
+
+  /** Returns the type and field data of each object in model, keyed by handle. */
+  static ModelObjectFieldsMap modelFields(const model::Model& model);
+
+  /** Returns true if object has the type and field data in fields. */
+  static bool hasFields(const WorkspaceObject& object, const std::pair<IddObjectType, std::vector<std::string> >& fields);
+
+  /** Returns a summary of the construction properties that surface translation depends on. */
+  static std::string constructionSummary(const model::Model& model);
+
+  /** Returns true if objects of this type translate to a single IdfObject that no other translation reads.
+   *  Schedule rulesets also generate week schedules, which translateModelDelta replaces along with the year schedule. */
+  static bool isIncrementallyTranslatable(const IddObjectType& iddObjectType);
+
+  std::vector<bool> translationOptions() const;
+
+  // baseline recorded by translateModelIncremental
+  boost::optional<Workspace> m_baselineWorkspace;
+
+  ModelObjectMap m_baselineMap;
+
+  ModelObjectFieldsMap m_baselineFields;
+
+  std::string m_baselineConstructionSummary;
+
+  std::set<Handle> m_baselineReversedConstructions;
+
+  std::vector<LogMessage> m_baselineLogMessages;
+
+  std::vector<bool> m_baselineOptions;
+
+  bool m_lastTranslationIncremental;
 };
 
 namespace detail
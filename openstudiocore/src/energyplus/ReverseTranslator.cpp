@@ -157,9 +157,13 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
     m_progressBar->setMaximum(workspace.numObjects());
   }
 
-  LOG(Trace,"Calling geometry translator.");
-  GeometryTranslator geometryTranslator(m_workspace);
-  geometryTranslator.convert(CoordinateSystem::Relative, CoordinateSystem::Relative);
+  {
+    TranslationProfiler::Scope profilerScope(m_profiler, "Geometry Conversion", m_model);
+
+    LOG(Trace,"Calling geometry translator.");
+    GeometryTranslator geometryTranslator(m_workspace);
+    geometryTranslator.convert(CoordinateSystem::Relative, CoordinateSystem::Relative);
+  }
 
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
 
@@ -233,6 +237,11 @@ std::vector<IdfObject> ReverseTranslator::untranslatedIdfObjects() const
   return m_untranslatedIdfObjects;
 }
 
+TranslationProfiler& ReverseTranslator::profiler()
+{
+  return m_profiler;
+}
+
 struct IdfObjectEqual {
   explicit IdfObjectEqual(const IdfObject& target)
     : m_target(target)
@@ -266,6 +275,8 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
 
   bool addToUntranslated = true;
 
+  TranslationProfiler::Scope profilerScope(m_profiler, workspaceObject.iddObject().type(), m_model);
+
   switch(workspaceObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::AirLoopHVAC :
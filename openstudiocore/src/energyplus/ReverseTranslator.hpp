@@ -30,6 +30,7 @@
 #define ENERGYPLUS_REVERSETRANSLATOR_HPP
 
 #include "EnergyPlusAPI.hpp"
+#include "TranslationProfiler.hpp"
 #include "../model/Model.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
@@ -58,6 +59,10 @@ class ENERGYPLUS_API ReverseTranslator {
   /** Get IdfObjects that were passed over by the last translation. */
   std::vector<IdfObject> untranslatedIdfObjects() const;
 
+  /** Profiler recording the time spent in each type specific translate function.  Profiling is disabled
+   *  until enabled with profiler().setEnabled(true). */
+  TranslationProfiler& profiler();
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ReverseTranslator");
@@ -309,6 +314,8 @@ class ENERGYPLUS_API ReverseTranslator {
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
+
+  TranslationProfiler m_profiler;
 };
 
 
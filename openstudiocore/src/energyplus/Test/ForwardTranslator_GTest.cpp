@@ -50,7 +50,9 @@
 #include "../../model/SiteWaterMainsTemperature_Impl.hpp"
 #include "../../model/Building.hpp"
 #include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
 #include "../../model/Lights.hpp"
 #include "../../model/AirLoopHVAC.hpp"
 #include "../../model/Schedule.hpp"
@@ -62,14 +64,25 @@
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/StandardOpaqueMaterial_Impl.hpp"
 #include "../../model/Construction.hpp"
+#include "../../model/Construction_Impl.hpp"
+#include "../../model/Material.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleDay_Impl.hpp"
+#include "../../model/ScheduleRule.hpp"
+#include "../../model/ScheduleRule_Impl.hpp"
+#include "../../model/ScheduleRuleset.hpp"
+#include "../../model/ScheduleRuleset_Impl.hpp"
 #include "../../model/Version.hpp"
 #include "../../model/Version_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 #include "../../utilities/core/Checksum.hpp"
+#include "../../utilities/core/Compare.hpp"
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/time/Time.hpp"
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/IdfObject.hpp"
@@ -81,10 +94,12 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <QElapsedTimer>
 #include <QThread>
 
 #include <resources.hxx>
 
+#include <algorithm>
 #include <sstream>
 
 #include <vector>
@@ -139,6 +154,214 @@ TEST_F(EnergyPlusFixture,ForwardTranslator_ExampleModel) {
   workspace.save(toPath("./example.idf"), true);
 }
 
+// sorted field data of all objects, pointer fields compare by target name
+// names generated by fast naming or createName end in UUIDs that differ between translations
+std::vector<std::string> workspaceContents(const Workspace& workspace)
+{
+  std::vector<std::string> result;
+  for (const WorkspaceObject& object : workspace.objects()){
+    std::string contents = object.iddObject().name();
+    for (unsigned i = 0; i < object.numFields(); ++i){
+      std::string value = object.getString(i).get_value_or("");
+      if ((value.size() >= 38u) && (value[value.size() - 38u] == '{') && (value[value.size() - 1u] == '}')){
+        value = value.substr(0, value.size() - 38u) + "{UUID}";
+      }
+      contents += "," + value;
+    }
+    result.push_back(contents);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelIncremental) {
+  Model model = exampleModel();
+
+  std::vector<StandardOpaqueMaterial> materials = model.getConcreteModelObjects<StandardOpaqueMaterial>();
+  ASSERT_LE(2u, materials.size());
+  std::sort(materials.begin(), materials.end(), WorkspaceObjectNameLess());
+
+  // unused constructions are translated too
+  Construction construction(model);
+  construction.setName("Incremental Construction");
+  construction.setLayers(std::vector<Material>(1, materials[0]));
+
+  ForwardTranslator forwardTranslator;
+  Workspace baseline = forwardTranslator.translateModelIncremental(model);
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(baseline));
+  unsigned numWarnings = forwardTranslator.warnings().size();
+
+  // unchanged model
+  Workspace workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(numWarnings, forwardTranslator.warnings().size());
+  EXPECT_EQ(workspaceContents(baseline), workspaceContents(workspace));
+
+  // material property
+  EXPECT_TRUE(materials[1].setThickness(materials[1].thickness() * 2.0));
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+  EXPECT_NE(workspaceContents(baseline), workspaceContents(workspace));
+
+  // construction layers
+  std::vector<Material> layers;
+  layers.push_back(materials[0]);
+  layers.push_back(materials[1]);
+  EXPECT_TRUE(construction.setLayers(layers));
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+  boost::optional<WorkspaceObject> idfConstruction = workspace.getObjectByTypeAndName(IddObjectType::Construction, "Incremental Construction");
+  ASSERT_TRUE(idfConstruction);
+  EXPECT_EQ(3u, idfConstruction->numFields());
+
+  // a renamed material changes the objects that refer to it
+  std::string name = materials[1].nameString();
+  materials[1].setName("Renamed Material");
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+
+  // the baseline is kept after a full translation
+  materials[1].setName(name);
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+
+  // new objects always require a full translation
+  ThermalZone thermalZone(model);
+  Space space(model);
+  space.setThermalZone(thermalZone);
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+
+  // the next call records a new baseline
+  forwardTranslator.clearBaseline();
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelIncrementalScheduleRuleset) {
+  Model model = exampleModel();
+
+  std::vector<ScheduleRule> scheduleRules = model.getConcreteModelObjects<ScheduleRule>();
+  ASSERT_FALSE(scheduleRules.empty());
+  std::sort(scheduleRules.begin(), scheduleRules.end(), WorkspaceObjectNameLess());
+  ScheduleRule scheduleRule = scheduleRules[0];
+  ScheduleRuleset scheduleRuleset = scheduleRule.scheduleRuleset();
+
+  ForwardTranslator forwardTranslator;
+  Workspace baseline = forwardTranslator.translateModelIncremental(model);
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(baseline));
+  unsigned numWeeks = baseline.getObjectsByType(IddObjectType::Schedule_Week_Daily).size();
+
+  // day schedule values
+  EXPECT_TRUE(scheduleRule.daySchedule().addValue(Time(0, 6), 0.25));
+  Workspace workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+  EXPECT_NE(workspaceContents(baseline), workspaceContents(workspace));
+
+  // the days a rule applies to change the week schedules of its ruleset
+  scheduleRule.setApplySunday(!scheduleRule.applySunday());
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+  EXPECT_EQ(numWeeks, workspace.getObjectsByType(IddObjectType::Schedule_Week_Daily).size());
+
+  boost::optional<WorkspaceObject> scheduleYear = workspace.getObjectByTypeAndName(IddObjectType::Schedule_Year, scheduleRuleset.nameString());
+  ASSERT_TRUE(scheduleYear);
+  for (const WorkspaceObject& target : scheduleYear->targets()){
+    EXPECT_TRUE(target.iddObject().type() == IddObjectType::Schedule_Week_Daily || target.iddObject().type() == IddObjectType::ScheduleTypeLimits);
+  }
+
+  // rule order
+  if (scheduleRuleset.scheduleRules().size() > 1u){
+    EXPECT_TRUE(scheduleRuleset.setScheduleRuleIndex(scheduleRule, scheduleRuleset.scheduleRules().size() - 1u));
+    workspace = forwardTranslator.translateModelIncremental(model);
+    EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+    EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+  }
+
+  // a rule with a new day schedule adds objects
+  ScheduleRule newRule(scheduleRuleset);
+  newRule.setApplySaturday(true);
+  workspace = forwardTranslator.translateModelIncremental(model);
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+  EXPECT_EQ(workspaceContents(ForwardTranslator().translateModel(model)), workspaceContents(workspace));
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelIncrementalTiming) {
+  Model model = exampleModel();
+
+  // stack copies of the example building to get a larger model
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  for (int i = 1; i < 10; ++i){
+    for (const Space& space : spaces){
+      Space newSpace = space.clone(model).cast<Space>();
+      newSpace.setZOrigin(space.zOrigin() + 10.0 * i);
+      ThermalZone thermalZone(model);
+      newSpace.setThermalZone(thermalZone);
+    }
+  }
+
+  std::vector<StandardOpaqueMaterial> materials = model.getConcreteModelObjects<StandardOpaqueMaterial>();
+  ASSERT_FALSE(materials.empty());
+  StandardOpaqueMaterial material = materials[0];
+  double thickness = material.thickness();
+
+  ForwardTranslator forwardTranslator;
+
+  QElapsedTimer et;
+  et.start();
+  Workspace baseline = forwardTranslator.translateModelIncremental(model);
+  qint64 baselineTime = et.elapsed();
+  EXPECT_FALSE(forwardTranslator.lastTranslationWasIncremental());
+
+  const int numDeltas = 5;
+  qint64 fullTime = 0;
+  qint64 incrementalTime = 0;
+  for (int i = 1; i <= numDeltas; ++i){
+    EXPECT_TRUE(material.setThickness(thickness * (1.0 + 0.1 * i)));
+
+    et.restart();
+    Workspace full = ForwardTranslator().translateModel(model);
+    fullTime += et.elapsed();
+
+    et.restart();
+    Workspace incremental = forwardTranslator.translateModelIncremental(model);
+    incrementalTime += et.elapsed();
+    EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+
+    EXPECT_EQ(workspaceContents(full), workspaceContents(incremental));
+  }
+
+  // change detection alone, every field is compared against the baseline copy
+  et.restart();
+  forwardTranslator.translateModelIncremental(model);
+  qint64 unchangedTime = et.elapsed();
+  EXPECT_TRUE(forwardTranslator.lastTranslationWasIncremental());
+
+  // size of the field strings the baseline keeps
+  size_t baselineBytes = 0;
+  for (const WorkspaceObject& object : model.objects()){
+    for (unsigned i = 0; i < object.numFields(); ++i){
+      baselineBytes += sizeof(std::string) + object.getString(i).get_value_or("").size();
+    }
+  }
+
+  // timings depend on the machine, they are logged rather than checked
+  LOG_FREE(Info, "ForwardTranslatorTiming", "Translated " << model.numObjects() << " objects: baseline " << baselineTime
+           << "ms, full " << fullTime / numDeltas << "ms, incremental " << incrementalTime / numDeltas
+           << "ms, unchanged " << unchangedTime << "ms, baseline fields " << baselineBytes / 1024 << "kB");
+}
 
 TEST_F(EnergyPlusFixture,ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
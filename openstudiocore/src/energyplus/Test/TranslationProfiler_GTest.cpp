@@ -0,0 +1,169 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "EnergyPlusFixture.hpp"
+
+#include "../ForwardTranslator.hpp"
+#include "../ReverseTranslator.hpp"
+#include "../TranslationProfiler.hpp"
+
+#include "../../model/Model.hpp"
+
+#include "../../utilities/idf/IdfObject.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+#include "../../utilities/core/Logger.hpp"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <string>
+#include <vector>
+
+using namespace openstudio::energyplus;
+using namespace openstudio::model;
+using namespace openstudio;
+
+TEST_F(EnergyPlusFixture,TranslationProfiler_ForwardTranslator)
+{
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  EXPECT_FALSE(forwardTranslator.profiler().enabled());
+  forwardTranslator.translateModel(model);
+  EXPECT_TRUE(forwardTranslator.profiler().names().empty());
+
+  forwardTranslator.profiler().setEnabled(true);
+  Workspace workspace = forwardTranslator.translateModel(model);
+
+  TranslationProfiler& profiler = forwardTranslator.profiler();
+  std::vector<std::string> names = profiler.names();
+  ASSERT_FALSE(names.empty());
+  EXPECT_EQ(1u, profiler.numCalls("Model Preprocessing"));
+  EXPECT_EQ(1u, profiler.numCalls("Workspace Construction"));
+  // constructions reversed for matched surfaces are added during translation
+  EXPECT_LE(model.getObjectsByType(IddObjectType::OS_Construction).size(), profiler.numCalls("OS:Construction"));
+  EXPECT_EQ(0u, profiler.numCalls("OS:NotATranslator"));
+
+  // names are sorted by self time, objects created outside of translate functions are not counted
+  int numObjectsCreated = 0;
+  for (unsigned i = 0; i < names.size(); ++i){
+    EXPECT_LE(profiler.selfTime(names[i]), profiler.totalTime(names[i]));
+    if (i > 0){
+      EXPECT_LE(profiler.selfTime(names[i]), profiler.selfTime(names[i-1]));
+    }
+    numObjectsCreated += profiler.numObjectsCreated(names[i]);
+  }
+  EXPECT_LT(0, numObjectsCreated);
+  EXPECT_GE(static_cast<int>(workspace.numObjects()), numObjectsCreated);
+
+  QJsonDocument doc = QJsonDocument::fromJson(QByteArray(profiler.toJSON().c_str()));
+  ASSERT_TRUE(doc.isObject());
+  QJsonArray translators = doc.object()["translators"].toArray();
+  ASSERT_EQ(names.size(), static_cast<size_t>(translators.size()));
+  EXPECT_EQ(names[0], translators[0].toObject()["name"].toString().toStdString());
+  EXPECT_FALSE(doc.object()["stacks"].toArray().isEmpty());
+
+  // nested translations appear below their parent in the folded stacks
+  std::string foldedStacks = profiler.toFoldedStacks();
+  EXPECT_NE(std::string::npos, foldedStacks.find("\nOS:Construction "));
+  EXPECT_NE(std::string::npos, foldedStacks.find("OS:AirLoopHVAC;"));
+
+  EXPECT_TRUE(profiler.saveJSON(toPath("./TranslationProfiler_ForwardTranslator.json")));
+  EXPECT_TRUE(profiler.saveFoldedStacks(toPath("./TranslationProfiler_ForwardTranslator.folded")));
+
+  // results accumulate until cleared
+  forwardTranslator.translateModel(model);
+  EXPECT_EQ(2u, profiler.numCalls("Model Preprocessing"));
+  profiler.clear();
+  EXPECT_TRUE(profiler.names().empty());
+}
+
+TEST_F(EnergyPlusFixture,TranslationProfiler_ReverseTranslator)
+{
+  Model model = exampleModel();
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+
+  ReverseTranslator reverseTranslator;
+  reverseTranslator.profiler().setEnabled(true);
+  Model result = reverseTranslator.translateWorkspace(workspace);
+
+  TranslationProfiler& profiler = reverseTranslator.profiler();
+  EXPECT_EQ(1u, profiler.numCalls("Geometry Conversion"));
+  EXPECT_LE(workspace.getObjectsByType(IddObjectType::Construction).size(), profiler.numCalls("Construction"));
+  EXPECT_LT(0, profiler.numObjectsCreated("Construction"));
+
+  std::vector<std::string> names = profiler.names();
+  ASSERT_FALSE(names.empty());
+  LOG_FREE(Info, "TranslationProfiler", "Slowest reverse translator " << names[0] << " took " << profiler.selfTime(names[0]) << "ms in "
+           << profiler.numCalls(names[0]) << " calls");
+}
+
+TEST_F(EnergyPlusFixture,TranslationProfiler_Scope)
+{
+  TranslationProfiler profiler;
+  std::vector<IdfObject> idfObjects;
+
+  // enabling the profiler inside a scope that did not begin does not unbalance it
+  {
+    TranslationProfiler::Scope outer(profiler, "Outer", idfObjects);
+    profiler.setEnabled(true);
+  }
+  EXPECT_EQ(0u, profiler.numCalls("Outer"));
+
+  {
+    TranslationProfiler::Scope outer(profiler, "Outer", idfObjects);
+    {
+      TranslationProfiler::Scope inner(profiler, "Inner", idfObjects);
+      idfObjects.push_back(IdfObject(IddObjectType::Zone));
+      inner.end();
+      inner.end();
+      idfObjects.push_back(IdfObject(IddObjectType::Zone));
+    }
+  }
+  EXPECT_EQ(1u, profiler.numCalls("Outer"));
+  EXPECT_EQ(1u, profiler.numCalls("Inner"));
+  EXPECT_EQ(1, profiler.numObjectsCreated("Outer"));
+  EXPECT_EQ(1, profiler.numObjectsCreated("Inner"));
+  EXPECT_NE(std::string::npos, profiler.toFoldedStacks().find("Outer;Inner "));
+
+  // clearing discards calls in progress, later calls start a new stack
+  {
+    TranslationProfiler::Scope outer(profiler, "Outer", idfObjects);
+    profiler.clear();
+  }
+  EXPECT_TRUE(profiler.names().empty());
+  {
+    TranslationProfiler::Scope inner(profiler, "Inner", idfObjects);
+  }
+  EXPECT_EQ(1u, profiler.numCalls("Inner"));
+  EXPECT_EQ(0u, profiler.numCalls("Outer"));
+  EXPECT_EQ("Inner", profiler.toFoldedStacks().substr(0, 5));
+}
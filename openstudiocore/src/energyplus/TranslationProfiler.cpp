@@ -0,0 +1,299 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "TranslationProfiler.hpp"
+
+#include "../utilities/idf/IdfObject.hpp"
+#include "../utilities/idf/Workspace.hpp"
+#include "../utilities/core/Assert.hpp"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace openstudio {
+namespace energyplus {
+
+  TranslationProfiler::TranslationProfiler()
+    : m_enabled(false)
+  {
+    m_timer.start();
+  }
+
+  bool TranslationProfiler::enabled() const
+  {
+    return m_enabled;
+  }
+
+  void TranslationProfiler::setEnabled(bool enabled)
+  {
+    m_enabled = enabled;
+  }
+
+  void TranslationProfiler::clear()
+  {
+    m_entries.clear();
+    m_stacks.clear();
+    m_frames.clear();
+  }
+
+  std::vector<std::string> TranslationProfiler::names() const
+  {
+    std::vector<std::pair<qint64, std::string> > sorted;
+    for (const auto& entry : m_entries){
+      sorted.push_back(std::make_pair(-entry.second.selfTime, entry.first));
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<std::string> result;
+    for (const auto& entry : sorted){
+      result.push_back(entry.second);
+    }
+    return result;
+  }
+
+  unsigned TranslationProfiler::numCalls(const std::string& name) const
+  {
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()){
+      return 0;
+    }
+    return it->second.numCalls;
+  }
+
+  double TranslationProfiler::totalTime(const std::string& name) const
+  {
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()){
+      return 0;
+    }
+    return it->second.totalTime / 1.0e6;
+  }
+
+  double TranslationProfiler::selfTime(const std::string& name) const
+  {
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()){
+      return 0;
+    }
+    return it->second.selfTime / 1.0e6;
+  }
+
+  int TranslationProfiler::numObjectsCreated(const std::string& name) const
+  {
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()){
+      return 0;
+    }
+    return it->second.numObjectsCreated;
+  }
+
+  std::string TranslationProfiler::toJSON() const
+  {
+    QJsonArray translators;
+    for (const std::string& name : names()){
+      const Entry& entry = m_entries.find(name)->second;
+      QJsonObject translator;
+      translator["name"] = QString::fromStdString(name);
+      translator["calls"] = static_cast<double>(entry.numCalls);
+      translator["totalTime"] = entry.totalTime / 1.0e6;
+      translator["selfTime"] = entry.selfTime / 1.0e6;
+      translator["objectsCreated"] = entry.numObjectsCreated;
+      translators.append(translator);
+    }
+
+    QJsonArray stacks;
+    for (const auto& stack : m_stacks){
+      QJsonObject object;
+      object["stack"] = QString::fromStdString(stack.first);
+      object["selfTime"] = stack.second / 1.0e6;
+      stacks.append(object);
+    }
+
+    QJsonObject result;
+    result["timeUnits"] = QString("ms");
+    result["translators"] = translators;
+    result["stacks"] = stacks;
+
+    return QJsonDocument(result).toJson().toStdString();
+  }
+
+  std::string TranslationProfiler::toFoldedStacks() const
+  {
+    std::stringstream ss;
+    for (const auto& stack : m_stacks){
+      ss << stack.first << " " << (stack.second / 1000) << std::endl;
+    }
+    return ss.str();
+  }
+
+  bool TranslationProfiler::saveJSON(const openstudio::path& path) const
+  {
+    boost::filesystem::ofstream ofs(path);
+    if (!ofs.is_open()){
+      return false;
+    }
+    ofs << toJSON();
+    ofs.close();
+    return true;
+  }
+
+  bool TranslationProfiler::saveFoldedStacks(const openstudio::path& path) const
+  {
+    boost::filesystem::ofstream ofs(path);
+    if (!ofs.is_open()){
+      return false;
+    }
+    ofs << toFoldedStacks();
+    ofs.close();
+    return true;
+  }
+
+  void TranslationProfiler::begin(const std::string& name, int numObjects)
+  {
+    Frame frame;
+    frame.name = name;
+    if (m_frames.empty()){
+      frame.stack = name;
+    }else{
+      frame.stack = m_frames.back().stack + ";" + name;
+    }
+    frame.childTime = 0;
+    frame.numObjects = numObjects;
+    frame.childObjects = 0;
+    frame.start = m_timer.nsecsElapsed();
+    m_frames.push_back(frame);
+  }
+
+  void TranslationProfiler::end(int numObjects)
+  {
+    qint64 now = m_timer.nsecsElapsed();
+
+    // the call was discarded by clear()
+    if (m_frames.empty()){
+      return;
+    }
+
+    Frame frame = m_frames.back();
+    m_frames.pop_back();
+
+    qint64 elapsed = now - frame.start;
+    int objects = numObjects - frame.numObjects;
+
+    Entry& entry = m_entries.insert(std::make_pair(frame.name, Entry{0, 0, 0, 0})).first->second;
+    entry.numCalls += 1;
+    entry.selfTime += elapsed - frame.childTime;
+    entry.numObjectsCreated += objects - frame.childObjects;
+
+    // recursive calls are only counted once in the total time
+    bool recursive = false;
+    for (const Frame& parent : m_frames){
+      if (parent.name == frame.name){
+        recursive = true;
+        break;
+      }
+    }
+    if (!recursive){
+      entry.totalTime += elapsed;
+    }
+
+    m_stacks[frame.stack] += elapsed - frame.childTime;
+
+    if (!m_frames.empty()){
+      m_frames.back().childTime += elapsed;
+      m_frames.back().childObjects += objects;
+    }
+  }
+
+  TranslationProfiler::Scope::Scope(TranslationProfiler& profiler, const IddObjectType& iddObjectType, const std::vector<IdfObject>& idfObjects)
+    : m_profiler(nullptr), m_idfObjects(&idfObjects), m_workspace(nullptr)
+  {
+    // only look up the name when it is needed, this is on every translate call
+    if (profiler.enabled()){
+      begin(profiler, iddObjectType.valueDescription());
+    }
+  }
+
+  TranslationProfiler::Scope::Scope(TranslationProfiler& profiler, const IddObjectType& iddObjectType, const Workspace& workspace)
+    : m_profiler(nullptr), m_idfObjects(nullptr), m_workspace(&workspace)
+  {
+    if (profiler.enabled()){
+      begin(profiler, iddObjectType.valueDescription());
+    }
+  }
+
+  TranslationProfiler::Scope::Scope(TranslationProfiler& profiler, const std::string& name, const std::vector<IdfObject>& idfObjects)
+    : m_profiler(nullptr), m_idfObjects(&idfObjects), m_workspace(nullptr)
+  {
+    if (profiler.enabled()){
+      begin(profiler, name);
+    }
+  }
+
+  TranslationProfiler::Scope::Scope(TranslationProfiler& profiler, const std::string& name, const Workspace& workspace)
+    : m_profiler(nullptr), m_idfObjects(nullptr), m_workspace(&workspace)
+  {
+    if (profiler.enabled()){
+      begin(profiler, name);
+    }
+  }
+
+  TranslationProfiler::Scope::~Scope()
+  {
+    end();
+  }
+
+  void TranslationProfiler::Scope::end()
+  {
+    if (m_profiler){
+      m_profiler->end(numObjects());
+      m_profiler = nullptr;
+    }
+  }
+
+  void TranslationProfiler::Scope::begin(TranslationProfiler& profiler, const std::string& name)
+  {
+    m_profiler = &profiler;
+    m_profiler->begin(name, numObjects());
+  }
+
+  int TranslationProfiler::Scope::numObjects() const
+  {
+    if (m_idfObjects){
+      return static_cast<int>(m_idfObjects->size());
+    }
+    return static_cast<int>(m_workspace->numObjects());
+  }
+
+} // energyplus
+} // openstudio
@@ -0,0 +1,168 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef ENERGYPLUS_TRANSLATIONPROFILER_HPP
+#define ENERGYPLUS_TRANSLATIONPROFILER_HPP
+
+#include "EnergyPlusAPI.hpp"
+
+#include "../utilities/core/Path.hpp"
+#include "../utilities/idd/IddEnums.hpp"
+
+#include <QElapsedTimer>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+class IdfObject;
+class Workspace;
+
+namespace energyplus {
+
+  /** TranslationProfiler records the number of calls, the wall time, and the number of objects created
+   *  for each type specific translate function of the ForwardTranslator and ReverseTranslator.  Translate
+   *  functions are identified by the IddObjectType they are dispatched on; named phases of a translation
+   *  may also be recorded.  Profiling is disabled by default, results accumulate over translations until
+   *  clear() is called. */
+  class ENERGYPLUS_API TranslationProfiler {
+   public:
+
+    TranslationProfiler();
+
+    /// is profiling enabled
+    bool enabled() const;
+
+    /// enable or disable profiling
+    void setEnabled(bool enabled);
+
+    /// discard all recorded results, including calls still in progress
+    void clear();
+
+    /// names of the profiled translate functions, in decreasing order of self time
+    std::vector<std::string> names() const;
+
+    /// number of calls to the translate function
+    unsigned numCalls(const std::string& name) const;
+
+    /// wall time in milliseconds spent in the translate function, including nested translations
+    double totalTime(const std::string& name) const;
+
+    /// wall time in milliseconds spent in the translate function, excluding nested translations
+    double selfTime(const std::string& name) const;
+
+    /// number of objects created by the translate function, excluding nested translations
+    int numObjectsCreated(const std::string& name) const;
+
+    /// results as a JSON document
+    std::string toJSON() const;
+
+    /// self time in microseconds of each translation call stack, in the folded format read by flame graph tools
+    std::string toFoldedStacks() const;
+
+    /// save toJSON() to path
+    bool saveJSON(const openstudio::path& path) const;
+
+    /// save toFoldedStacks() to path
+    bool saveFoldedStacks(const openstudio::path& path) const;
+
+    /// start recording a call to name, numObjects is the current number of translated objects
+    void begin(const std::string& name, int numObjects);
+
+    /// finish recording the innermost call, numObjects is the current number of translated objects
+    void end(int numObjects);
+
+    /** Records a call to the translate function for an IddObjectType, or a named phase, for the lifetime
+     *  of the Scope or until end() is called.  Does nothing if the profiler is disabled when the Scope is
+     *  created. */
+    class ENERGYPLUS_API Scope {
+     public:
+
+      Scope(TranslationProfiler& profiler, const IddObjectType& iddObjectType, const std::vector<IdfObject>& idfObjects);
+
+      Scope(TranslationProfiler& profiler, const IddObjectType& iddObjectType, const Workspace& workspace);
+
+      Scope(TranslationProfiler& profiler, const std::string& name, const std::vector<IdfObject>& idfObjects);
+
+      Scope(TranslationProfiler& profiler, const std::string& name, const Workspace& workspace);
+
+      ~Scope();
+
+      /// finish recording before the Scope is destroyed, later calls do nothing
+      void end();
+
+     private:
+
+      Scope(const Scope& other);
+      Scope& operator=(const Scope& other);
+
+      void begin(TranslationProfiler& profiler, const std::string& name);
+
+      int numObjects() const;
+
+      TranslationProfiler* m_profiler;
+      const std::vector<IdfObject>* m_idfObjects;
+      const Workspace* m_workspace;
+    };
+
+   private:
+
+    struct Entry {
+      unsigned numCalls;
+      qint64 totalTime;
+      qint64 selfTime;
+      int numObjectsCreated;
+    };
+
+    struct Frame {
+      std::string name;
+      std::string stack;
+      qint64 start;
+      qint64 childTime;
+      int numObjects;
+      int childObjects;
+    };
+
+    bool m_enabled;
+
+    QElapsedTimer m_timer;
+
+    // times are kept in nanoseconds
+    std::map<std::string, Entry> m_entries;
+
+    std::map<std::string, qint64> m_stacks;
+
+    std::vector<Frame> m_frames;
+  };
+
+} // energyplus
+} // openstudio
+
+#endif // ENERGYPLUS_TRANSLATIONPROFILER_HPP
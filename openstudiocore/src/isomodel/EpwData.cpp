@@ -29,6 +29,9 @@
 #include "EpwData.hpp"
 #include "SolarRadiation.hpp"
 
+#include <QCryptographicHash>
+#include <QFile>
+
 namespace openstudio {
 namespace isomodel {
 
@@ -136,6 +139,21 @@ void EpwData::toISOData(Matrix &_msolar, Matrix &_mhdbt, Matrix &_mhEgh, Vector
   _mwind = openstudio::createVector(pos.monthlyWindspeed());
 }
 
+std::string EpwData::isoDataKey(const openstudio::path &t_path)
+{
+  QFile file(openstudio::toQString(t_path));
+  if (!file.open(QIODevice::ReadOnly)) {
+    return std::string();
+  }
+
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  if (!hash.addData(&file)) {
+    return std::string();
+  }
+
+  return "sha256:" + std::string(hash.result().toHex().data()) + ";" + SolarRadiation::surfaceKey();
+}
+
 std::string EpwData::toISOData() const {
   TimeFrame frames;
   SolarRadiation pos(frames, *this);
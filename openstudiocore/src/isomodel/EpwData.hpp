@@ -66,6 +66,13 @@ class EpwData
     std::string toISOData() const;
     void toISOData(Matrix &_msolar, Matrix &_mhdbt, Matrix &_mhEgh, Vector &_mEgh, Vector &_mdbt, Vector &_mwind) const;
 
+    /**
+     * Key identifying the ISO weather summary produced by toISOData for the weather file at t_path.
+     * Combines the SHA-256 of the file contents with the surface tilt and azimuths used in the solar
+     * calculation. Returns an empty string if the file cannot be read.
+     */
+    static std::string isoDataKey(const openstudio::path &t_path);
+
   protected:
     void loadData(const openstudio::path &t_path);
     void parseHeader(const std::string &line);
@@ -31,6 +31,7 @@
 // #endif
 
 %ignore openstudio::isomodel::mult;
+%ignore openstudio::isomodel::simulate(const std::vector<SimModel>&);
 
 %rename("terrainClass=") openstudio::isomodel::UserModel::setTerrainClass(double value);
 %rename("floorArea=") openstudio::isomodel::UserModel::setFloorArea(double value);
@@ -28,6 +28,8 @@
 
 #include "SimModel.hpp"
 
+#include <QtConcurrentMap>
+
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #define DEBUG_ISO_MODEL_SIMULATION
 #endif
@@ -55,6 +57,21 @@ namespace isomodel {
   }
 
 
+  namespace {
+
+    ISOResults simulateModel(const SimModel& model)
+    {
+      return model.simulate();
+    }
+
+  }
+
+  std::vector<ISOResults> simulate(const std::vector<SimModel>& models)
+  {
+    // each model only reads its inputs, so they can run on the global thread pool
+    return QtConcurrent::blockingMapped<std::vector<ISOResults> >(models, simulateModel);
+  }
+
   void SimModel::printVector(const char* vecName, const Vector &vec){
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     std::stringstream ss;
@@ -365,8 +382,8 @@ namespace isomodel {
     Vector& v_Tdbt_nt) const
   {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     Vector v_Tdbt_Day = prod(m_mhdbt,clockHourOccupied);
     v_Tdbt_Day /= sum(clockHourOccupied);
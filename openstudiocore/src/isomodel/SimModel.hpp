@@ -248,6 +248,13 @@ namespace isomodel {
     static void printVector(const char* vecName, const Vector &vec);
     static void printMatrix(const char* matName, const Matrix &mat);
   };
+
+  /*
+   *  Runs the ISO Model calculations for each of the given models, spread across the available cores.
+   *  Models generated from UserModels that share one WeatherData also share all of the weather inputs.
+   *  returns one ISOResults per model, in the same order as models
+   */
+  ISOMODEL_API std::vector<ISOResults> simulate(const std::vector<SimModel>& models);
 } // isomodel
 } // openstudio
 
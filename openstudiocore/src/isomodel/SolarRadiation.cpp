@@ -28,6 +28,9 @@
 
 #include "SolarRadiation.hpp"
 
+#include <iomanip>
+#include <sstream>
+
 #define PI 3.141592653589
 
 namespace openstudio {
@@ -64,6 +67,20 @@ namespace isomodel {
 
   SolarRadiation::~SolarRadiation() {}
 
+  std::string SolarRadiation::surfaceKey(double tilt)
+  {
+    std::stringstream key;
+    key << std::setprecision(12) << "tilt=" << tilt << ";azimuths=";
+    for(int s = 0;s<NUM_SURFACES;s++)
+    {
+      if (s > 0) {
+        key << ",";
+      }
+      key << SurfaceAzimuths[s];
+    }
+    return key.str();
+  }
+
   /**
    * compute the monthly average solar radiation incident on the vertical surfaces for the 
    * eight primary directions (N, S, E, W, NW, SW, NE, SE)
@@ -32,6 +32,7 @@
 #include <math.h>
 #include <algorithm>
 #include <vector>
+#include <string>
 #include "TimeFrame.hpp"
 #include "EpwData.hpp"
 #include "../utilities/core/Logger.hpp"
@@ -52,6 +53,12 @@ class SolarRadiation
 
     void Calculate();
 
+    /**
+     * Describes the surface tilt and azimuths the monthly solar radiation is computed for.
+     * Used to key cached weather summaries so they are only reused for the same surface set.
+     */
+    static std::string surfaceKey(double tilt=3.141592653589);
+
     //outputs
     const std::vector<std::vector<double> > &eglobe() const {return m_eglobe;}//total solar radiation from direct beam, ground reflect and diffuse
     //averages
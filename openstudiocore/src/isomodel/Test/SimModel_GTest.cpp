@@ -30,7 +30,9 @@
 #include "ISOModelFixture.hpp"
 #include "../SimModel.hpp"
 #include "../UserModel.hpp"
+#include "../EpwData.hpp"
 #include <resources.hxx>
+#include <QElapsedTimer>
 #include <sstream>
 
 using namespace openstudio::isomodel;
@@ -330,3 +332,85 @@ TEST_F(ISOModelFixture, SimModel)
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems) );
 }
+
+TEST_F(ISOModelFixture, SimModel_Batch)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  ASSERT_TRUE(userModel.weatherData());
+
+  // variants share the weather data of the base model
+  std::vector<SimModel> simModels;
+  std::vector<ISOResults> expected;
+  for (int i = 0; i < 20; ++i){
+    UserModel variant(userModel);
+    variant.setCoolingSystemCOP(userModel.coolingSystemCOP() * (1.0 + 0.05 * i));
+    variant.setFloorArea(userModel.floorArea() * (1.0 + 0.01 * i));
+    EXPECT_EQ(userModel.weatherData(), variant.weatherData());
+    SimModel simModel = variant.toSimModel();
+    EXPECT_EQ(userModel.weatherData(), variant.weatherData());
+    simModels.push_back(simModel);
+    expected.push_back(simModel.simulate());
+  }
+
+  std::vector<ISOResults> results = simulate(simModels);
+  ASSERT_EQ(expected.size(), results.size());
+  for (unsigned i = 0; i < results.size(); ++i){
+    ASSERT_EQ(12u, results[i].monthlyResults.size());
+    EXPECT_DOUBLE_EQ(expected[i].totalEnergyUse(), results[i].totalEnergyUse());
+  }
+  EXPECT_NE(results.front().totalEnergyUse(), results.back().totalEnergyUse());
+}
+
+TEST_F(ISOModelFixture, SimModel_BatchProfile)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  // the weather summary, including the hourly solar calculation, is computed once per weather file
+  // and shared by every SimModel generated from UserModels that share the WeatherData
+  QElapsedTimer et;
+  et.start();
+  EpwData epw(resourcesPath() / openstudio::toPath("isomodel/weather.epw"));
+  Matrix msolar(12, 8, 0);
+  Matrix mhdbt(12, 24, 0);
+  Matrix mhEgh(12, 24, 0);
+  Vector mEgh(12);
+  Vector mdbt(12);
+  Vector mwind(12);
+  epw.toISOData(msolar, mhdbt, mhEgh, mEgh, mdbt, mwind);
+  qint64 weatherTime = et.nsecsElapsed();
+
+  const int numVariants = 2000;
+  std::vector<SimModel> simModels;
+  et.restart();
+  for (int i = 0; i < numVariants; ++i){
+    UserModel variant(userModel);
+    variant.setCoolingSystemCOP(userModel.coolingSystemCOP() * (1.0 + 0.001 * i));
+    variant.setFloorArea(userModel.floorArea() * (1.0 + 0.0001 * i));
+    simModels.push_back(variant.toSimModel());
+  }
+  qint64 toSimModelTime = et.nsecsElapsed();
+
+  std::vector<ISOResults> expected;
+  et.restart();
+  for (const SimModel &simModel : simModels){
+    expected.push_back(simModel.simulate());
+  }
+  qint64 serialTime = et.nsecsElapsed();
+
+  et.restart();
+  std::vector<ISOResults> results = simulate(simModels);
+  qint64 batchTime = et.nsecsElapsed();
+
+  ASSERT_EQ(expected.size(), results.size());
+  for (unsigned i = 0; i < results.size(); ++i){
+    EXPECT_DOUBLE_EQ(expected[i].totalEnergyUse(), results[i].totalEnergyUse());
+  }
+
+  LOG(Info, "Weather summary " << weatherTime / 1000 << "us once per weather file, per variant: toSimModel "
+      << toSimModelTime / numVariants / 1000.0 << "us simulate " << serialTime / numVariants / 1000.0
+      << "us batch simulate " << batchTime / numVariants / 1000.0 << "us");
+}
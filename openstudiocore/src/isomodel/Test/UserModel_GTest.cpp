@@ -31,9 +31,14 @@
 
 #include "../UserModel.hpp"
 #include "../SimModel.hpp"
+#include "../SolarRadiation.hpp"
+#include "../WeatherData.hpp"
+#include "../EpwData.hpp"
 
 #include <resources.hxx>
 
+#include <boost/filesystem/fstream.hpp>
+
 #include <sstream>
 
 using namespace openstudio::isomodel;
@@ -820,3 +825,95 @@ TEST_F(ISOModelFixture, UserModel)
 
 
 }
+
+TEST_F(ISOModelFixture, UserModel_WeatherCache)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  openstudio::path weatherFile = resourcesPath() / openstudio::toPath("isomodel/weather.epw");
+  std::string key = EpwData::isoDataKey(weatherFile);
+  openstudio::path cacheFile = WeatherData::cachePath(key);
+  ASSERT_FALSE(cacheFile.empty());
+
+  // computes the summary from the epw and writes the cache in the user cache directory
+  boost::filesystem::remove(cacheFile);
+  std::shared_ptr<WeatherData> computed = userModel.loadWeather();
+  ASSERT_TRUE(computed.get());
+  ASSERT_TRUE(boost::filesystem::exists(cacheFile));
+  EXPECT_NE(weatherFile.parent_path(), cacheFile.parent_path());
+  EXPECT_FALSE(boost::filesystem::exists(openstudio::toPath(openstudio::toString(weatherFile) + ".isoweather")));
+
+  // the cache file is named by the key, so a different surface set or file hash uses a different file
+  EXPECT_NE(cacheFile, WeatherData::cachePath(key + "x"));
+  EXPECT_EQ(0u, key.find("sha256:"));
+
+  // no temporary files are left next to the cache file
+  for (boost::filesystem::directory_iterator it(cacheFile.parent_path()), end; it != end; ++it) {
+    EXPECT_NE(".tmp", openstudio::toString(it->path().extension()));
+  }
+
+  // cache is only valid for the key it was saved with
+  EXPECT_FALSE(WeatherData::load(cacheFile, "sha256:" + std::string(64, '0') + ";" + SolarRadiation::surfaceKey()).get());
+  EXPECT_FALSE(WeatherData::load(cacheFile, key + "x").get());
+  EXPECT_FALSE(WeatherData::load(cacheFile, "").get());
+
+  // changing a single byte of the weather file changes the key
+  openstudio::path modifiedWeatherFile = openstudio::tempDir() / openstudio::toPath("UserModel_WeatherCache.epw");
+  boost::filesystem::copy_file(weatherFile, modifiedWeatherFile, boost::filesystem::copy_option::overwrite_if_exists);
+  {
+    boost::filesystem::fstream file(modifiedWeatherFile, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    file.seekp(-3, std::ios_base::end);
+    file.put('9');
+  }
+  std::string modifiedKey = EpwData::isoDataKey(modifiedWeatherFile);
+  EXPECT_FALSE(modifiedKey.empty());
+  EXPECT_NE(key, modifiedKey);
+  EXPECT_NE(cacheFile, WeatherData::cachePath(modifiedKey));
+  boost::filesystem::remove(modifiedWeatherFile);
+  EXPECT_TRUE(EpwData::isoDataKey(modifiedWeatherFile).empty());
+
+  std::shared_ptr<WeatherData> cached = WeatherData::load(cacheFile, key);
+  ASSERT_TRUE(cached.get());
+
+  // subsequent loads are served from the cache
+  std::shared_ptr<WeatherData> reloaded = userModel.loadWeather();
+  ASSERT_TRUE(reloaded.get());
+
+  for (const std::shared_ptr<WeatherData> &wd : {cached, reloaded}) {
+    for (size_t r = 0; r < 12; ++r) {
+      EXPECT_DOUBLE_EQ(computed->mEgh()[r], wd->mEgh()[r]);
+      EXPECT_DOUBLE_EQ(computed->mdbt()[r], wd->mdbt()[r]);
+      EXPECT_DOUBLE_EQ(computed->mwind()[r], wd->mwind()[r]);
+      for (size_t c = 0; c < 8; ++c) {
+        EXPECT_DOUBLE_EQ(computed->msolar()(r, c), wd->msolar()(r, c));
+      }
+      for (size_t c = 0; c < 24; ++c) {
+        EXPECT_DOUBLE_EQ(computed->mhdbt()(r, c), wd->mhdbt()(r, c));
+        EXPECT_DOUBLE_EQ(computed->mhEgh()(r, c), wd->mhEgh()(r, c));
+      }
+    }
+  }
+
+  // a file without the format header is rejected
+  {
+    boost::filesystem::ifstream ifile(cacheFile);
+    std::stringstream contents;
+    contents << ifile.rdbuf();
+    std::string text = contents.str();
+    ifile.close();
+    boost::filesystem::ofstream ofile(cacheFile);
+    ofile << text.substr(text.find('\n') + 1);
+  }
+  EXPECT_FALSE(WeatherData::load(cacheFile, key).get());
+
+  // a truncated cache file is rejected
+  {
+    boost::filesystem::ofstream ofile(cacheFile);
+    ofile << "OpenStudio ISO Weather Summary,2" << std::endl << "key," << key << std::endl << "mdbt" << std::endl << "0,1" << std::endl;
+  }
+  EXPECT_FALSE(WeatherData::load(cacheFile, key).get());
+  EXPECT_TRUE(userModel.loadWeather().get());
+  EXPECT_TRUE(WeatherData::load(cacheFile, key).get());
+}
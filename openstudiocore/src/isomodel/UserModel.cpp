@@ -623,6 +623,19 @@ namespace isomodel {
         return std::shared_ptr<WeatherData>();
       }
     }
+
+    // reuse the summary cached for the same weather file contents and surface set,
+    // this skips parsing the epw and the hourly solar calculations
+    std::string key = EpwData::isoDataKey(weatherFilename);
+    openstudio::path cacheFile;
+    if (!key.empty()) {
+      cacheFile = WeatherData::cachePath(key);
+      std::shared_ptr<WeatherData> cached = WeatherData::load(cacheFile, key);
+      if (cached) {
+        return cached;
+      }
+    }
+
     EpwData edata(weatherFilename);
 
     Matrix _msolar(12,8,0);
@@ -641,6 +654,10 @@ namespace isomodel {
     wdata->setMhEgh(_mhEgh);
     wdata->setMsolar(_msolar);
     wdata->setMwind(_mwind);
+
+    if (!key.empty() && !wdata->save(cacheFile, key)) {
+      LOG(Debug, "Unable to write weather summary cache: " << openstudio::toString(cacheFile));
+    }
     
     return wdata;
   }
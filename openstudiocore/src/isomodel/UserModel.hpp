@@ -53,6 +53,19 @@ namespace isomodel {
      */
     std::shared_ptr<WeatherData> loadWeather();
 
+    /**
+     * Returns the weather data loaded by load() or set by setWeatherData()
+     */
+    std::shared_ptr<WeatherData> weatherData() const {return _weather;}
+
+    /**
+     * Uses weather data that has already been loaded, for instance by another UserModel
+     * for the same climate, so that toSimModel() does not read the weather file again.
+     * Copies of a UserModel share its weather data, so many variants of one building
+     * can be generated and run with simulate(const std::vector<SimModel>&) cheaply.
+     */
+    void setWeatherData(std::shared_ptr<WeatherData> val){_weather = val;}
+
     /**
      * Loads an ISO model from the specified .ISO file
      */
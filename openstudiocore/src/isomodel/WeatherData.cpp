@@ -28,11 +28,191 @@
 
 #include "WeatherData.hpp"
 
+#include "../utilities/core/UUID.hpp"
+
+#include <QCryptographicHash>
+#include <QStandardPaths>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
 
 namespace openstudio {
 namespace isomodel {
 
-// nothing to see here
+namespace {
+
+  // first line of every summary, bumped whenever the layout changes
+  const char * const formatHeader = "OpenStudio ISO Weather Summary,2";
+
+  void writeVector(std::ostream &os, const std::string &header, const Vector &v)
+  {
+    os << header << std::endl;
+    for (unsigned i = 0; i < v.size(); ++i) {
+      os << i << "," << v[i] << std::endl;
+    }
+  }
+
+  void writeMatrix(std::ostream &os, const std::string &header, const Matrix &m)
+  {
+    os << header << std::endl;
+    for (unsigned i = 0; i < m.size1(); ++i) {
+      os << i;
+      for (unsigned j = 0; j < m.size2(); ++j) {
+        os << "," << m(i, j);
+      }
+      os << std::endl;
+    }
+  }
+
+  // reads the rows following a section header, each row is "index,value[,value...]"
+  bool readRows(std::istream &is, unsigned nRows, unsigned nCols, Matrix &m)
+  {
+    m = Matrix(nRows, nCols, 0);
+    std::string line;
+    for (unsigned i = 0; i < nRows; ++i) {
+      if (!std::getline(is, line)) {
+        return false;
+      }
+      std::stringstream ss(line);
+      std::string cell;
+      if (!std::getline(ss, cell, ',')) {
+        return false;
+      }
+      for (unsigned j = 0; j < nCols; ++j) {
+        if (!std::getline(ss, cell, ',')) {
+          return false;
+        }
+        std::stringstream cs(cell);
+        double value;
+        if (!(cs >> value)) {
+          return false;
+        }
+        m(i, j) = value;
+      }
+    }
+    return true;
+  }
+
+  bool readVector(std::istream &is, unsigned n, Vector &v)
+  {
+    Matrix m;
+    if (!readRows(is, n, 1, m)) {
+      return false;
+    }
+    v = Vector(n);
+    for (unsigned i = 0; i < n; ++i) {
+      v[i] = m(i, 0);
+    }
+    return true;
+  }
+
+}
+
+bool WeatherData::save(const openstudio::path &t_path, const std::string &t_key) const
+{
+  if (t_path.empty() || t_key.empty()) {
+    return false;
+  }
+
+  // write a sibling file and rename it over t_path, so readers never see a partial summary
+  openstudio::path tempPath = t_path.parent_path() /
+    openstudio::toPath(openstudio::toString(t_path.filename()) + "." + openstudio::removeBraces(openstudio::createUUID()) + ".tmp");
+  {
+    boost::filesystem::ofstream ofile(tempPath);
+    if (!ofile.is_open()) {
+      return false;
+    }
+
+    ofile << std::setprecision(std::numeric_limits<double>::digits10 + 2);
+    ofile << formatHeader << std::endl;
+    ofile << "key," << t_key << std::endl;
+    writeVector(ofile, "mdbt", _mdbt);
+    writeVector(ofile, "mwind", _mwind);
+    writeVector(ofile, "mEgh", _mEgh);
+    writeMatrix(ofile, "hdbt", _mhdbt);
+    writeMatrix(ofile, "hEgh", _mhEgh);
+    writeMatrix(ofile, "solar", _msolar);
+
+    ofile.close();
+    if (ofile.fail()) {
+      boost::system::error_code ec;
+      boost::filesystem::remove(tempPath, ec);
+      return false;
+    }
+  }
+
+  boost::system::error_code ec;
+  boost::filesystem::rename(tempPath, t_path, ec);
+  if (ec) {
+    boost::filesystem::remove(tempPath, ec);
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<WeatherData> WeatherData::load(const openstudio::path &t_path, const std::string &t_key)
+{
+  std::shared_ptr<WeatherData> result;
+
+  boost::filesystem::ifstream ifile(t_path);
+  if (!ifile.is_open()) {
+    return result;
+  }
+
+  std::string line;
+  if (t_key.empty() || !std::getline(ifile, line) || line != formatHeader) {
+    return result;
+  }
+  if (!std::getline(ifile, line) || line != "key," + t_key) {
+    return result;
+  }
+
+  std::shared_ptr<WeatherData> wdata(new WeatherData);
+  bool mdbt = false, mwind = false, mEgh = false, hdbt = false, hEgh = false, solar = false;
+  while (std::getline(ifile, line)) {
+    bool ok = false;
+    if (line == "mdbt") {
+      ok = mdbt = readVector(ifile, 12, wdata->_mdbt);
+    } else if (line == "mwind") {
+      ok = mwind = readVector(ifile, 12, wdata->_mwind);
+    } else if (line == "mEgh") {
+      ok = mEgh = readVector(ifile, 12, wdata->_mEgh);
+    } else if (line == "hdbt") {
+      ok = hdbt = readRows(ifile, 12, 24, wdata->_mhdbt);
+    } else if (line == "hEgh") {
+      ok = hEgh = readRows(ifile, 12, 24, wdata->_mhEgh);
+    } else if (line == "solar") {
+      ok = solar = readRows(ifile, 12, 8, wdata->_msolar);
+    }
+    if (!ok) {
+      return result;
+    }
+  }
+
+  if (mdbt && mwind && mEgh && hdbt && hEgh && solar) {
+    result = wdata;
+  }
+  return result;
+}
+
+openstudio::path WeatherData::cachePath(const std::string &t_key)
+{
+  QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  openstudio::path cacheDir = (cacheLocation.isEmpty() ? openstudio::tempDir() : openstudio::toPath(cacheLocation))
+    / openstudio::toPath("ISOWeather");
+
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(cacheDir, ec);
+  if (ec) {
+    return openstudio::path();
+  }
+
+  QByteArray hash = QCryptographicHash::hash(QByteArray(t_key.c_str()), QCryptographicHash::Sha1);
+  return cacheDir / openstudio::toPath(std::string(hash.toHex().data()) + ".isoweather");
+}
 
 }
 }
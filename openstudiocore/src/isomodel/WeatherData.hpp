@@ -32,6 +32,10 @@
 #include "ISOModelAPI.hpp"
 #include "../utilities/data/Vector.hpp"
 #include "../utilities/data/Matrix.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <memory>
+#include <string>
 
 namespace openstudio {
 namespace isomodel {
@@ -72,6 +76,28 @@ public:
   void setMsolar(const Matrix &val){_msolar = val;}
   void setMhdbt(const Matrix &val){_mhdbt = val;}
 
+  /**
+   * Writes the weather summary to t_path tagged with t_key, which should identify the
+   * source weather file and the surfaces msolar was computed for (see EpwData::isoDataKey).
+   * The summary is written to a temporary file in the same directory and renamed into place.
+   * Returns false if the file could not be written or t_key is empty.
+   */
+  bool save(const openstudio::path &t_path, const std::string &t_key) const;
+
+  /**
+   * Loads a weather summary previously written by save().
+   * Returns an empty pointer if the file does not exist, does not start with the summary format header,
+   * cannot be parsed, or was saved with a different key.
+   */
+  static std::shared_ptr<WeatherData> load(const openstudio::path &t_path, const std::string &t_key);
+
+  /**
+   * Location of the cached weather summary saved with key t_key (see EpwData::isoDataKey). Summaries are
+   * stored in the user's cache directory rather than next to the weather file, which may be read only or shared.
+   * Returns an empty path if the cache directory cannot be created.
+   */
+  static openstudio::path cachePath(const std::string &t_key);
+
 private:
   Matrix _msolar;
   Matrix _mhdbt;
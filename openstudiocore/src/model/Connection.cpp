@@ -29,6 +29,8 @@
 #include "Connection.hpp"
 #include "Connection_Impl.hpp"
 #include "ModelObject.hpp"
+#include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
@@ -107,21 +109,25 @@ namespace detail {
   void Connection_Impl::setSourceObject(ModelObject object)
   {
     setPointer(openstudio::OS_ConnectionFields::SourceObject,object.handle());
+    model().getImpl<Model_Impl>()->hvacTopologyChanged();
   }
 
   void Connection_Impl::setSourceObjectPort(unsigned port)
   {
     this->setUnsigned(openstudio::OS_ConnectionFields::OutletPort,port);
+    model().getImpl<Model_Impl>()->hvacTopologyChanged();
   }
 
   void Connection_Impl::setTargetObject(ModelObject object)
   {
     setPointer(openstudio::OS_ConnectionFields::TargetObject,object.handle());
+    model().getImpl<Model_Impl>()->hvacTopologyChanged();
   }
 
   void Connection_Impl::setTargetObjectPort(unsigned port)
   {
     this->setUnsigned(openstudio::OS_ConnectionFields::InletPort,port);
+    model().getImpl<Model_Impl>()->hvacTopologyChanged();
   }
 
 } // detail
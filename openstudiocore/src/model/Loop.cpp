@@ -49,11 +49,16 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 namespace openstudio {
 
 namespace model {
@@ -115,39 +120,6 @@ namespace detail {
     return ParentObject_Impl::remove();
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // searches all paths of nodes between the source and sink until a handle match is found
-  boost::optional<ModelObject> findModelObject(const openstudio::Handle & handle, const HVACComponent & sink, std::vector<HVACComponent> & visited, bool isDemandComponents)
-  {
-    HVACComponent hvacComponent = visited.back();
-    if( handle == hvacComponent.handle() ) { 
-      return hvacComponent;
-    }
-
-    boost::optional<HVACComponent> prev;
-    if( visited.size() >= 2u ) prev = visited.rbegin()[1];
-
-    std::vector<HVACComponent> nodes = hvacComponent.getImpl<HVACComponent_Impl>()->edges(prev);
-
-    for(auto it = nodes.begin();
-        it != nodes.end();
-        it++)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(), visited.end(), *it) != visited.end() ||
-          *it == sink )
-      {
-        continue; 
-      }
-      visited.push_back(*it);
-      boost::optional<ModelObject> foundHandle = findModelObject(handle, sink, visited, isDemandComponents);
-      if( foundHandle ) { return *foundHandle; }
-      visited.pop_back();
-    }
-    return boost::none;
-  }
-
   OptionalModelObject Loop_Impl::component(openstudio::Handle handle)
   {
     boost::optional<ModelObject> supplyComp = this->supplyComponent(handle);
@@ -164,9 +136,8 @@ namespace detail {
 
     for( auto const & inletComp : inletComps ) {
       if( handle == inletComp.handle() ) { return inletComp; }
-      std::vector<HVACComponent> visited { inletComp };
-      if( auto mo = findModelObject(handle, outletComp, visited, true) ) {
-        return mo;
+      if( topology(inletComp, outletComp).reachableComponents.count(handle) ) {
+        return model().getModelObject<ModelObject>(handle);
       }
     }
 
@@ -183,9 +154,8 @@ namespace detail {
 
     for( auto const & outletComp : outletComps ) {
       if( handle == outletComp.handle() ) { return outletComp; }
-      std::vector<HVACComponent> visited { inletComp };
-      if( auto mo = findModelObject(handle, outletComp, visited, false) ) {
-        return mo;
+      if( topology(inletComp, outletComp).reachableComponents.count(handle) ) {
+        return model().getModelObject<ModelObject>(handle);
       }
     }
 
@@ -239,74 +209,200 @@ namespace detail {
     return result;
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
-  {
-    boost::optional<HVACComponent> prev;
-    if( visited.size() >= 2u ) prev = visited.rbegin()[1];
+  namespace {
 
-    std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(prev);
+    // A component of a loop together with the component it was reached from.
+    // Some components (e.g. water to air coils) sit on two loops, and edges() uses the previous
+    // component to decide which side to continue on, so the graph is keyed on both.
+    struct TopologyVertex {
+      TopologyVertex(const HVACComponent & t_component, const boost::optional<HVACComponent> & t_prev)
+        : component(t_component), prev(t_prev), feedsSink(false), reachesSink(false), visited(false)
+      {
+      }
 
-    for(const auto & node : nodes)
+      HVACComponent component;
+      boost::optional<HVACComponent> prev;
+      std::vector<unsigned> next;
+      bool feedsSink;
+      bool reachesSink;
+      bool visited;
+    };
+
+    // Sets reachesSink on every vertex with a path to the sink, by searching backwards from the
+    // vertices that feed it. Each vertex is marked once, so cycles need no special handling.
+    void markReachesSink(std::vector<TopologyVertex> & vertices)
     {
-      // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
+      std::vector<std::vector<unsigned> > prev(vertices.size());
+      std::vector<unsigned> pending;
+      for( unsigned i = 0; i < vertices.size(); ++i ) {
+        for( auto n : vertices[i].next ) {
+          prev[n].push_back(i);
+        }
+        if( vertices[i].feedsSink ) {
+          vertices[i].reachesSink = true;
+          pending.push_back(i);
+        }
+      }
+
+      while( !pending.empty() ) {
+        unsigned i = pending.back();
+        pending.pop_back();
+        for( auto p : prev[i] ) {
+          if( !vertices[p].reachesSink ) {
+            vertices[p].reachesSink = true;
+            pending.push_back(p);
+          }
+        }
+      }
+    }
+
+    struct TopologyOrdering {
+      TopologyOrdering(std::vector<TopologyVertex> & t_vertices, const HVACComponent & t_sink)
+        : vertices(t_vertices), sink(t_sink), appended(0)
+      {
+      }
+
+      // a path to the sink was found through the current stack, append the components not seen yet
+      void completePath(bool includeSink)
       {
-        continue; 
+        for( ; appended < stack.size(); ++appended ) {
+          const HVACComponent & component = vertices[stack[appended]].component;
+          if( emitted.insert(component.handle()).second ) {
+            result.push_back(component);
+          }
+        }
+        if( includeSink && emitted.insert(sink.handle()).second ) {
+          result.push_back(sink);
+        }
       }
-      if( node == sink )
+
+      void visit(unsigned i)
       {
-        visited.push_back(node);
-        // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
-        {
-          paths.insert(paths.end(), visited.begin(), visited.end());
+        stack.push_back(i);
+        onStack.insert(vertices[i].component.handle());
+        vertices[i].visited = true;
+
+        if( vertices[i].feedsSink ) {
+          completePath(true);
         }
-        else
-        {
-          for( const auto & visitedit : visited )
-          {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
-            }
+
+        for( auto n : vertices[i].next ) {
+          if( !vertices[n].reachesSink || onStack.count(vertices[n].component.handle()) ) {
+            continue;
+          }
+          if( vertices[n].visited ) {
+            // everything downstream of n is already in result
+            completePath(false);
+            continue;
           }
+          visit(n);
         }
-        visited.pop_back();
+
+        onStack.erase(vertices[i].component.handle());
+        stack.pop_back();
+        appended = std::min(appended, static_cast<unsigned>(stack.size()));
       }
+
+      std::vector<TopologyVertex> & vertices;
+      const HVACComponent & sink;
+      std::vector<unsigned> stack;
+      unsigned appended;
+      std::set<Handle> onStack;
+      std::set<Handle> emitted;
+      std::vector<ModelObject> result;
+    };
+
+  }
+
+  // Builds the graph of components reachable from inletComp without passing through outletComp.
+  // pathComponents lists the components that lie on a path from inletComp to outletComp, in the
+  // order a depth first enumeration of those paths discovers them, so the inlet comes first and the
+  // components of the first branch come before those of later branches. Each vertex and edge is
+  // visited a constant number of times.
+  const Loop_Impl::Topology & Loop_Impl::topology(const HVACComponent & inletComp, const HVACComponent & outletComp) const
+  {
+    unsigned version = model().getImpl<Model_Impl>()->hvacTopologyVersion();
+    if( version != m_topologiesVersion ) {
+      // drop every entry, including those for inlet and outlet pairs that no longer exist
+      m_topologies.clear();
+      m_topologiesVersion = version;
     }
 
-    for(const auto & node : nodes)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
-          node == sink )
-      {
-        continue;
+    auto key = std::make_pair(inletComp.handle(), outletComp.handle());
+
+    auto it = m_topologies.find(key);
+    if( it != m_topologies.end() ) {
+      bool valid = true;
+      for( const auto & component : it->second.pathComponents ) {
+        if( component.handle().isNull() ) {
+          valid = false;
+          break;
+        }
+      }
+      if( valid ) {
+        return it->second;
+      }
+    }
+
+    Topology & result = m_topologies[key];
+    result.pathComponents.clear();
+    result.reachableComponents.clear();
+
+    if( inletComp == outletComp ) {
+      result.pathComponents.push_back(inletComp);
+      result.reachableComponents.insert(inletComp.handle());
+      return result;
+    }
+
+    std::vector<TopologyVertex> vertices;
+    std::map<std::pair<Handle,Handle>, unsigned> index;
+    vertices.push_back(TopologyVertex(inletComp, boost::none));
+    index[std::make_pair(Handle(), inletComp.handle())] = 0;
+
+    for( unsigned i = 0; i < vertices.size(); ++i ) {
+      HVACComponent component = vertices[i].component;
+      result.reachableComponents.insert(component.handle());
+
+      std::vector<HVACComponent> edges = component.getImpl<HVACComponent_Impl>()->edges(vertices[i].prev);
+      for( const auto & edge : edges ) {
+        if( edge == outletComp ) {
+          vertices[i].feedsSink = true;
+          continue;
+        }
+        auto edgeKey = std::make_pair(component.handle(), edge.handle());
+        auto indexIt = index.find(edgeKey);
+        unsigned n;
+        if( indexIt == index.end() ) {
+          n = vertices.size();
+          index[edgeKey] = n;
+          vertices.push_back(TopologyVertex(edge, component));
+        } else {
+          n = indexIt->second;
+        }
+        vertices[i].next.push_back(n);
       }
-      visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
-      visited.pop_back();
     }
+
+    markReachesSink(vertices);
+    if( vertices[0].reachesSink ) {
+      TopologyOrdering ordering(vertices, outletComp);
+      ordering.visit(0);
+      result.pathComponents = ordering.result;
+    }
+
+    return result;
+  }
+
+  void Loop_Impl::clearTopologies()
+  {
+    m_topologies.clear();
   }
 
   std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type ) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
-    }
-    std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
+    const std::vector<ModelObject> & _demandComponents = topology(inletComp, outletComp).pathComponents;
 
     // Filter modelObjects for type
     if( type == IddObjectType::Catchall ) {
@@ -398,17 +494,7 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
-    }
-    std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
+    const std::vector<ModelObject> & _supplyComponents = topology(inletComp, outletComp).pathComponents;
 
     // Filter modelObjects for type
     if( type == IddObjectType::Catchall ) {
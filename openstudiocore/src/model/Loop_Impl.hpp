@@ -31,6 +31,9 @@
 
 #include "ParentObject_Impl.hpp"
 
+#include <map>
+#include <set>
+
 namespace openstudio {
 
 namespace model {
@@ -124,6 +127,9 @@ namespace detail {
 
     virtual Mixer demandMixer() = 0;
 
+    /** Drops the cached component graphs, called by Model_Impl when this loop is removed. */
+    void clearTopologies();
+
   private:
 
     REGISTER_LOGGER("openstudio.model.Loop");
@@ -134,6 +140,20 @@ namespace detail {
     boost::optional<ModelObject> demandInletNodeAsModelObject();
     boost::optional<ModelObject> demandOutletNodeAsModelObject();
 
+    // Components between an inlet and an outlet component, see Model_Impl::hvacTopologyVersion
+    struct Topology {
+      // components on a path from the inlet to the outlet, in traversal order
+      std::vector<ModelObject> pathComponents;
+      // every component reachable from the inlet without passing through the outlet
+      std::set<Handle> reachableComponents;
+    };
+
+    const Topology & topology(const HVACComponent & inletComp, const HVACComponent & outletComp) const;
+
+    // all entries are built against m_topologiesVersion, the map is cleared when it is stale
+    mutable std::map<std::pair<Handle,Handle>, Topology> m_topologies;
+    mutable unsigned m_topologiesVersion = 0;
+
   };
 
 } // detail
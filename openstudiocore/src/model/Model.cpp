@@ -63,6 +63,8 @@
 
 #include <boost/regex.hpp>
 
+#include <algorithm>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -163,6 +165,14 @@ namespace detail {
     m_componentWatchers = otherImpl->m_componentWatchers;
     otherImpl->m_componentWatchers = tcw;
 
+    // objects in either model may hold cached data from before the swap
+    ++m_hvacTopologyVersion;
+    ++otherImpl->m_hvacTopologyVersion;
+    ++m_geometryVersion;
+    ++otherImpl->m_geometryVersion;
+    ++m_scheduleRulesVersion;
+    ++otherImpl->m_scheduleRulesVersion;
+
     OptionalBuilding tcb = m_cachedBuilding;
     m_cachedBuilding = otherImpl->m_cachedBuilding;
     otherImpl->m_cachedBuilding = tcb;
@@ -1372,6 +1382,8 @@ if (_className::iddObjectType() == typeToCreate) { \
     disconnect(sourceObject,sourcePort);
     disconnect(targetObject,targetPort);
 
+    ++m_hvacTopologyVersion;
+
     Connection c(m);
     c.setSourceObject(sourceObject);
     c.setSourceObjectPort(sourcePort);
@@ -1382,9 +1394,60 @@ if (_className::iddObjectType() == typeToCreate) { \
     targetObject.setPointer(targetPort,c.handle());
   }
 
+  unsigned Model_Impl::hvacTopologyVersion() const
+  {
+    return m_hvacTopologyVersion;
+  }
+
+  void Model_Impl::hvacTopologyChanged()
+  {
+    ++m_hvacTopologyVersion;
+  }
+
+  unsigned Model_Impl::geometryVersion() const
+  {
+    return m_geometryVersion;
+  }
+
+  unsigned Model_Impl::scheduleRulesVersion() const
+  {
+    return m_scheduleRulesVersion;
+  }
+
+  void Model_Impl::registerChangeOfObject(openstudio::detail::WorkspaceObject_Impl& object, bool removed)
+  {
+    switch (object.iddObject().type().value()){
+      case IddObjectType::OS_Space: // fall through
+      case IddObjectType::OS_Surface: // fall through
+      case IddObjectType::OS_SubSurface: // fall through
+      case IddObjectType::OS_ShadingSurface: // fall through
+      case IddObjectType::OS_InteriorPartitionSurface:
+        ++m_geometryVersion;
+        break;
+      case IddObjectType::OS_Schedule_Ruleset: // fall through
+      case IddObjectType::OS_Schedule_Rule: // fall through
+      case IddObjectType::OS_YearDescription:
+        ++m_scheduleRulesVersion;
+        break;
+      case IddObjectType::OS_AirLoopHVAC: // fall through
+      case IddObjectType::OS_PlantLoop:
+        if (removed){
+          // removed loops do not keep their components alive
+          if (Loop_Impl* loop = dynamic_cast<Loop_Impl*>(&object)){
+            loop->clearTopologies();
+          }
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
   void Model_Impl::disconnect(ModelObject object,
                               unsigned port)
   {
+    ++m_hvacTopologyVersion;
+
     if( boost::optional<HVACComponent> hvacComponent = object.optionalCast<HVACComponent>() )
     {
       std::shared_ptr<HVACComponent_Impl> hvacComponentImpl;
@@ -828,6 +828,9 @@ namespace detail {
 
     if (anyFailures){
       emit onChange();
+      if (Workspace_Impl* workspace = workspaceImpl()) {
+        workspace->change();
+      }
     }
   }
 
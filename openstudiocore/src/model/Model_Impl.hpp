@@ -206,6 +206,27 @@ namespace detail {
 
     void disconnect(ModelObject object, unsigned port);
 
+    /** Incremented whenever connect, disconnect, the Connection setters or the PortList port
+     *  methods change how HVAC components are linked. Loops use this to know when their cached
+     *  component graphs are stale. Port fields edited with setString or setPointer directly
+     *  bypass it, callers doing so should call hvacTopologyChanged. */
+    unsigned hvacTopologyVersion() const;
+
+    /** Increments hvacTopologyVersion. */
+    void hvacTopologyChanged();
+
+    /** Incremented whenever a Space or a planar surface is added, changed, or removed. Spaces, thermal
+     *  zones and surfaces use this to know when their cached areas are stale. */
+    unsigned geometryVersion() const;
+
+    /** Incremented whenever a ScheduleRuleset, ScheduleRule, or the YearDescription is added, changed,
+     *  or removed. ScheduleRulesets use this to know when their annual rule tables are stale. */
+    unsigned scheduleRulesVersion() const;
+
+    /** Bumps the versions above for the type of object and evicts the component graphs of removed
+     *  loops, so that these caches do not need a connection to every object they depend on. */
+    virtual void registerChangeOfObject(openstudio::detail::WorkspaceObject_Impl& object, bool removed) override;
+
    public slots :
 
     virtual void obsoleteComponentWatcher(const ComponentWatcher& watcher);
@@ -245,6 +266,10 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    unsigned m_hvacTopologyVersion = 0;
+    unsigned m_geometryVersion = 0;
+    unsigned m_scheduleRulesVersion = 0;
+
   private slots:
 
     void clearCachedBuilding();
@@ -29,6 +29,7 @@
 #include "PlanarSurface.hpp"
 #include "PlanarSurface_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "PlanarSurfaceGroup.hpp"
 #include "Space.hpp"
@@ -249,17 +250,25 @@ namespace model {
     // compute gross area (m^2)
     double PlanarSurface_Impl::grossArea() const
     {
-      double result = 0.0;
-      OptionalDouble area = getArea(vertices());
-      if (area){
-        result = *area;
+      if (!m_cachedGrossArea){
+        m_cachedGrossArea = 0.0;
+        OptionalDouble area = getArea(vertices());
+        if (area){
+          m_cachedGrossArea = *area;
+        }
       }
-      return result;
+      return m_cachedGrossArea.get();
     }
 
     // compute net area (m^2)
     double PlanarSurface_Impl::netArea() const
     {
+      // the net area also depends on the children, any change to them bumps Model_Impl::geometryVersion
+      unsigned version = this->model().getImpl<Model_Impl>()->geometryVersion();
+      if (m_cachedNetArea && (m_cachedNetAreaVersion == version)){
+        return m_cachedNetArea.get();
+      }
+
       double result = this->grossArea();
 
       // subtract net area of child planar surfaces
@@ -277,6 +286,8 @@ namespace model {
         }
       }
 
+      m_cachedNetArea = result;
+      m_cachedNetAreaVersion = version;
       return result;
     }
 
@@ -549,9 +560,11 @@ namespace model {
 
     Point3d PlanarSurface_Impl::centroid() const
     {
-      boost::optional<Point3d> result = getCentroid(this->vertices());
-      OS_ASSERT(result);
-      return *result;
+      if (!m_cachedCentroid){
+        m_cachedCentroid = getCentroid(this->vertices());
+        OS_ASSERT(m_cachedCentroid);
+      }
+      return m_cachedCentroid.get();
     }
 
     std::vector<ModelObject> PlanarSurface_Impl::solarCollectors() const
@@ -606,6 +619,9 @@ namespace model {
       m_cachedPlane.reset();
       m_cachedOutwardNormal.reset();
       m_cachedTriangulation.clear();
+      m_cachedGrossArea.reset();
+      m_cachedNetArea.reset();
+      m_cachedCentroid.reset();
     }
 
     bool PlanarSurface_Impl::setConstructionAsModelObject(boost::optional<ModelObject> modelObject)
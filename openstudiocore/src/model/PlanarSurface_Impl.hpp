@@ -196,6 +196,10 @@ namespace detail {
     mutable boost::optional<Plane> m_cachedPlane;
     mutable boost::optional<Vector3d> m_cachedOutwardNormal;
     mutable std::vector<std::vector<Point3d> > m_cachedTriangulation;
+    mutable boost::optional<double> m_cachedGrossArea;
+    mutable boost::optional<double> m_cachedNetArea;
+    mutable unsigned m_cachedNetAreaVersion = 0;
+    mutable boost::optional<Point3d> m_cachedCentroid;
 
   };
 
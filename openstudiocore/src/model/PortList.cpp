@@ -258,6 +258,7 @@ void PortList_Impl::removePort(unsigned port)
     }
   }
   eraseExtensibleGroup(port - numNonextensibleFields());
+  model().getImpl<Model_Impl>()->hvacTopologyChanged();
 }
 
 unsigned PortList_Impl::airLoopHVACPort()
@@ -311,7 +312,9 @@ HVACComponent PortList_Impl::hvacComponent() const
 
 bool PortList_Impl::setHVACComponent(const HVACComponent & hvacComponent)
 {
-  return setPointer(OS_PortListFields::HVACComponent,hvacComponent.handle());
+  bool result = setPointer(OS_PortListFields::HVACComponent,hvacComponent.handle());
+  model().getImpl<Model_Impl>()->hvacTopologyChanged();
+  return result;
 }
 
 } // detail
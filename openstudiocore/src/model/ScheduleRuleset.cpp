@@ -45,7 +45,11 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/data/TimeSeries.hpp"
+#include "../utilities/data/Vector.hpp"
 #include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
+#include "../utilities/units/Unit.hpp"
 
 namespace openstudio {
 namespace model {
@@ -408,6 +412,22 @@ namespace detail {
 
   std::vector<int> ScheduleRuleset_Impl::getActiveRuleIndices(const openstudio::Date& startDate, const openstudio::Date& endDate) const
   {
+    // dates in the assumed base year can be looked up in the annual table
+    const std::vector<int>& annualIndices = this->annualActiveRuleIndices();
+    OS_ASSERT(m_cachedAnnualStartDate);
+    int year = m_cachedAnnualStartDate->year();
+    if ((startDate.year() == year) && (endDate.year() == year)){
+      unsigned startIndex = startDate.dayOfYear() - 1;
+      unsigned endIndex = endDate.dayOfYear() - 1;
+      OS_ASSERT(startIndex < annualIndices.size());
+      OS_ASSERT(endIndex < annualIndices.size());
+      if (startIndex <= endIndex){
+        return std::vector<int>(annualIndices.begin() + startIndex, annualIndices.begin() + endIndex + 1);
+      }
+      std::vector<int> result(annualIndices.begin() + startIndex, annualIndices.end());
+      result.insert(result.end(), annualIndices.begin(), annualIndices.begin() + endIndex + 1);
+      return result;
+    }
 
     // need to check or adjust assumed base year on input date?
 
@@ -433,14 +453,88 @@ namespace detail {
       }
     }
 
+    return computeActiveRuleIndices(dates, this->scheduleRules());
+  }
+
+  std::vector<ScheduleDay> ScheduleRuleset_Impl::getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const
+  {
+    std::vector<ScheduleDay> result;
+    ScheduleDay defaultDaySchedule = this->defaultDaySchedule();
+    std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
+    std::vector<int> activeRuleIndices = this->getActiveRuleIndices(startDate, endDate);
+    for (int i : activeRuleIndices){
+      if (i == -1){
+        result.push_back(defaultDaySchedule);
+      }else{
+        result.push_back(scheduleRules[i].daySchedule());
+      }
+    }
+
+    return result;
+  }
+
+  boost::optional<openstudio::TimeSeries> ScheduleRuleset_Impl::annualTimeSeries(const openstudio::Time& intervalLength) const
+  {
+    int secondsPerInterval = intervalLength.totalSeconds();
+    if ((secondsPerInterval <= 0) || ((86400 % secondsPerInterval) != 0)){
+      LOG(Warn, "Interval length " << intervalLength << " does not evenly divide one day.");
+      return boost::none;
+    }
+    unsigned intervalsPerDay = 86400 / secondsPerInterval;
+
+    const std::vector<int>& annualIndices = this->annualActiveRuleIndices();
+    OS_ASSERT(m_cachedAnnualStartDate);
+
+    // evaluate each distinct day schedule once over one day, index 0 is the default day schedule
+    std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
+    OS_ASSERT(scheduleRules.size() == m_cachedScheduleRuleHandles.size());
+    std::vector<std::vector<double> > dayProfiles(scheduleRules.size() + 1);
+    std::vector<bool> evaluated(scheduleRules.size() + 1, false);
+    for (int ruleIndex : annualIndices){
+      unsigned profileIndex = static_cast<unsigned>(ruleIndex + 1);
+      if (evaluated[profileIndex]){
+        continue;
+      }
+      ScheduleDay daySchedule = (ruleIndex == -1) ? this->defaultDaySchedule() : scheduleRules[ruleIndex].daySchedule();
+      std::vector<double>& profile = dayProfiles[profileIndex];
+      profile.resize(intervalsPerDay);
+      for (unsigned i = 0; i < intervalsPerDay; ++i){
+        // value in effect at the end of each interval
+        profile[i] = daySchedule.getValue(openstudio::Time(0, 0, 0, (i + 1) * secondsPerInterval));
+      }
+      evaluated[profileIndex] = true;
+    }
+
+    // then stitch the year together from the day profiles in a single pass
+    openstudio::Vector values(annualIndices.size() * intervalsPerDay);
+    unsigned n = 0;
+    for (int ruleIndex : annualIndices){
+      const std::vector<double>& profile = dayProfiles[static_cast<unsigned>(ruleIndex + 1)];
+      for (unsigned i = 0; i < intervalsPerDay; ++i){
+        values[n++] = profile[i];
+      }
+    }
+
+    std::string units;
+    if (boost::optional<ScheduleTypeLimits> scheduleTypeLimits = this->scheduleTypeLimits()){
+      if (OptionalUnit siUnits = ScheduleTypeLimits::units(scheduleTypeLimits->unitType(),false)){
+        units = siUnits->standardString();
+      }
+    }
+
+    return openstudio::TimeSeries(*m_cachedAnnualStartDate, intervalLength, values, units);
+  }
+
+  std::vector<int> ScheduleRuleset_Impl::computeActiveRuleIndices(const std::vector<openstudio::Date>& dates,
+                                                                  const std::vector<ScheduleRule>& scheduleRules) const
+  {
     unsigned numDates = dates.size();
 
     // check if each rule contains each date
-    std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
     unsigned numRules = scheduleRules.size();
     std::vector<std::vector<bool> > test;
     for(unsigned i = 0; i < numRules; ++i){
-      test.push_back(scheduleRules[i].containsDates(dates));
+      test.push_back(ScheduleRule(scheduleRules[i]).containsDates(dates));
     }
 
     // now create result
@@ -457,21 +551,37 @@ namespace detail {
     return result;
   }
 
-  std::vector<ScheduleDay> ScheduleRuleset_Impl::getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const
+  const std::vector<int>& ScheduleRuleset_Impl::annualActiveRuleIndices() const
   {
-    std::vector<ScheduleDay> result;
-    ScheduleDay defaultDaySchedule = this->defaultDaySchedule();
+    // any change to a ruleset, a rule, or the year description bumps the version, see Model_Impl::scheduleRulesVersion
+    unsigned version = this->model().getImpl<Model_Impl>()->scheduleRulesVersion();
+    if (m_cachedAnnualActiveRuleIndices && (m_cachedScheduleRulesVersion == version)){
+      return m_cachedAnnualActiveRuleIndices.get();
+    }
+
     std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
-    std::vector<int> activeRuleIndices = this->getActiveRuleIndices(startDate, endDate);
-    for (int i : activeRuleIndices){
-      if (i == -1){
-        result.push_back(defaultDaySchedule);
-      }else{
-        result.push_back(scheduleRules[i].daySchedule());
-      }
+    YearDescription yd = this->model().getUniqueModelObject<model::YearDescription>();
+    openstudio::Date startDate = yd.makeDate(MonthOfYear::Jan, 1);
+    openstudio::Date endDate = yd.makeDate(MonthOfYear::Dec, 31);
+
+    std::vector<openstudio::Date> dates;
+    openstudio::Date date = startDate;
+    while (date <= endDate){
+      dates.push_back(date);
+      date += Time(1);
     }
 
-    return result;
+    m_cachedAnnualActiveRuleIndices = computeActiveRuleIndices(dates, scheduleRules);
+    m_cachedAnnualStartDate = startDate;
+    m_cachedScheduleRuleHandles.clear();
+    for (const ScheduleRule& scheduleRule : scheduleRules){
+      m_cachedScheduleRuleHandles.push_back(scheduleRule.handle());
+    }
+
+    // getUniqueModelObject may have just created the year description
+    m_cachedScheduleRulesVersion = this->model().getImpl<Model_Impl>()->scheduleRulesVersion();
+
+    return m_cachedAnnualActiveRuleIndices.get();
   }
 
   bool ScheduleRuleset_Impl::moveToEnd(ScheduleRule& scheduleRule)
@@ -584,6 +694,11 @@ std::vector<ScheduleDay> ScheduleRuleset::getDaySchedules(const openstudio::Date
 {
   return getImpl<detail::ScheduleRuleset_Impl>()->getDaySchedules(startDate, endDate);
 }
+
+boost::optional<openstudio::TimeSeries> ScheduleRuleset::annualTimeSeries(const openstudio::Time& intervalLength) const
+{
+  return getImpl<detail::ScheduleRuleset_Impl>()->annualTimeSeries(intervalLength);
+}
   
 bool ScheduleRuleset::moveToEnd(ScheduleRule& scheduleRule)
 {
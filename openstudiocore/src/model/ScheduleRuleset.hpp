@@ -35,6 +35,8 @@
 namespace openstudio {
 
 class Date;
+class Time;
+class TimeSeries;
 
 namespace model {
 
@@ -135,6 +137,12 @@ class MODEL_API ScheduleRuleset : public Schedule {
   std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, 
                                            const openstudio::Date& endDate) const;
 
+  /// Returns the values of this schedule for every interval of the assumed base year, each value 
+  /// taken at the end of its interval. The rule in effect on each day is resolved once and cached 
+  /// until this schedule or its rules change, so repeated calls only evaluate the day schedules.
+  /// Returns boost::none if intervalLength does not evenly divide one day.
+  boost::optional<openstudio::TimeSeries> annualTimeSeries(const openstudio::Time& intervalLength) const;
+
   //@}
  protected:
 
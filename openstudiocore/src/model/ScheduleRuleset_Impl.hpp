@@ -35,6 +35,8 @@
 namespace openstudio {
 
 class Date;
+class Time;
+class TimeSeries;
 
 namespace model {
 
@@ -139,6 +141,9 @@ namespace detail {
 
     /// Returns a vector of day schedules between start date (inclusive) and end date (inclusive).
     std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const;
+
+    /// Returns the values of this schedule for every interval of the assumed base year.
+    boost::optional<openstudio::TimeSeries> annualTimeSeries(const openstudio::Time& intervalLength) const;
     
     // Moves this rule to the last position. Called in ScheduleRule remove.
     bool moveToEnd(ScheduleRule& scheduleRule);
@@ -151,6 +156,17 @@ namespace detail {
     REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
     boost::optional<ScheduleDay> optionalDefaultDaySchedule() const;
+
+    std::vector<int> computeActiveRuleIndices(const std::vector<openstudio::Date>& dates, 
+                                              const std::vector<ScheduleRule>& scheduleRules) const;
+
+    // active rule index for every day of the assumed base year, recomputed when Model_Impl::scheduleRulesVersion changes
+    const std::vector<int>& annualActiveRuleIndices() const;
+
+    mutable boost::optional<std::vector<int> > m_cachedAnnualActiveRuleIndices;
+    mutable boost::optional<openstudio::Date> m_cachedAnnualStartDate;
+    mutable std::vector<Handle> m_cachedScheduleRuleHandles;
+    mutable unsigned m_cachedScheduleRulesVersion = 0;
   };
 
 } // detail
@@ -118,6 +118,7 @@
 #include "../utilities/geometry/Vector3d.hpp"
 #include "../utilities/geometry/EulerAngles.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
+#include "../utilities/geometry/PolygonArray.hpp"
 
 #include "../utilities/core/Assert.hpp"
 
@@ -878,73 +879,108 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
+    cacheAreas();
+
     double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor"))
-      {
-        if (surface.isAirWall()){
-          continue;
-        }
-        result += surface.grossArea();
+    Model model = this->model();
+    for (const std::pair<Handle, double>& floorArea : m_cachedFloorAreas.get()) {
+      boost::optional<Surface> surface = model.getModelObject<Surface>(floorArea.first);
+      if (surface && surface->isAirWall()){
+        continue;
       }
+      result += floorArea.second;
     }
     return result;
   }
 
   double Space_Impl::exteriorArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        result += surface.grossArea();
-      }
-    }
-    return result;
+    cacheAreas();
+    return m_cachedExteriorArea.get();
   }
 
   double Space_Impl::exteriorWallArea() const {
+    cacheAreas();
+    return m_cachedExteriorWallArea.get();
+  }
+
+  double Space_Impl::volume() const {
+    cacheAreas();
+
     double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        if (istringEqual(surface.surfaceType(), "Wall"))
-        {
-          result += surface.grossArea();
-        }
-      }
+    if (m_cachedHeight.get() != 0.0){
+      result = m_cachedHeight.get() * this->floorArea();
     }
     return result;
   }
 
-  double Space_Impl::volume() const {
-    double result = 0;
+  void Space_Impl::cacheAreas() const
+  {
+    // the areas depend on the surfaces, any change to them bumps Model_Impl::geometryVersion
+    unsigned version = this->model().getImpl<Model_Impl>()->geometryVersion();
+    if (m_cachedFloorAreas && (m_cachedAreasVersion == version)){
+      return;
+    }
+
+    // collect every surface polygon first, then compute all of the areas in one pass
+    std::vector<Surface> surfaces = this->surfaces();
+    std::vector<std::string> surfaceTypes;
+    std::vector<bool> outdoors;
+    PolygonArray polygons;
+    polygons.reserve(surfaces.size(), 4 * surfaces.size());
 
     // TODO: need a better method
     double roofHeight = 0;
     int numRoof = 0;
     double floorHeight = 0;
     int numFloor = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor")){
-        for (const Point3d& point : surface.vertices()) {
+
+    for (const Surface& surface : surfaces) {
+      std::string surfaceType = surface.surfaceType();
+      std::vector<Point3d> vertices = surface.vertices();
+      if (istringEqual(surfaceType, "Floor")){
+        for (const Point3d& point : vertices) {
           floorHeight += point.z();
           ++numFloor;
         }
-      }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
-        for (const Point3d& point : surface.vertices()) {
+      }else if (istringEqual(surfaceType, "RoofCeiling")){
+        for (const Point3d& point : vertices) {
           roofHeight += point.z();
           ++numRoof;
         }
       }
+
+      polygons.addPolygon(vertices);
+      surfaceTypes.push_back(surfaceType);
+      outdoors.push_back(istringEqual(surface.outsideBoundaryCondition(), "Outdoors"));
     }
 
+    std::vector<double> areas = polygons.areas();
+
+    std::vector<std::pair<Handle, double> > floorAreas;
+    double exteriorArea = 0;
+    double exteriorWallArea = 0;
+    for (unsigned i = 0, n = surfaces.size(); i < n; ++i) {
+      if (istringEqual(surfaceTypes[i], "Floor")){
+        floorAreas.push_back(std::make_pair(surfaces[i].handle(), areas[i]));
+      }
+      if (outdoors[i]){
+        exteriorArea += areas[i];
+        if (istringEqual(surfaceTypes[i], "Wall")){
+          exteriorWallArea += areas[i];
+        }
+      }
+    }
+
+    double height = 0;
     if ((numRoof > 0) * (numFloor > 0)){
-      roofHeight /= numRoof;
-      floorHeight /= numFloor;
-      result = (roofHeight - floorHeight) * this->floorArea();
+      height = roofHeight / numRoof - floorHeight / numFloor;
     }
 
-    return result;
+    m_cachedFloorAreas = floorAreas;
+    m_cachedExteriorArea = exteriorArea;
+    m_cachedExteriorWallArea = exteriorWallArea;
+    m_cachedHeight = height;
+    m_cachedAreasVersion = version;
   }
 
   double Space_Impl::numberOfPeople() const {
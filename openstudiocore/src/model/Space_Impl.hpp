@@ -534,6 +534,9 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Space");
 
+    // computes the cached areas and height in one pass over the surfaces, unless they are current
+    void cacheAreas() const;
+
     openstudio::Quantity directionofRelativeNorth_SI() const;
     openstudio::Quantity directionofRelativeNorth_IP() const;
     bool setDirectionofRelativeNorth(const Quantity& directionofRelativeNorth);   
@@ -588,6 +591,16 @@ namespace detail {
     // helper function to get a boost polygon point from a Point3d
     boost::tuple<double, double> point3dToTuple(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) const;
 
+    // gross area of each floor surface, air walls are checked when floorArea is called
+    // since their construction may come from a default construction set
+    mutable boost::optional<std::vector<std::pair<Handle, double> > > m_cachedFloorAreas;
+    mutable boost::optional<double> m_cachedExteriorArea;
+    mutable boost::optional<double> m_cachedExteriorWallArea;
+    // average roof height minus average floor height, 0 if the space has no floor or no roof
+    mutable boost::optional<double> m_cachedHeight;
+    // Model_Impl::geometryVersion the cached values were computed at
+    mutable unsigned m_cachedAreasVersion = 0;
+
   };
 
 } // detail
@@ -692,6 +692,7 @@ namespace detail {
   }
 
   double ThermalZone_Impl::floorArea() const {
+    // not cached here, floor area depends on air wall constructions which may come from default construction sets
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.floorArea();
@@ -700,19 +701,33 @@ namespace detail {
   }
 
   double ThermalZone_Impl::exteriorSurfaceArea() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.exteriorArea();
-    }
-    return result;
+    cacheAreas();
+    return m_cachedExteriorSurfaceArea.get();
   }
 
   double ThermalZone_Impl::exteriorWallArea() const {
-    double result(0.0);
+    cacheAreas();
+    return m_cachedExteriorWallArea.get();
+  }
+
+  void ThermalZone_Impl::cacheAreas() const
+  {
+    // the areas depend on the spaces and their surfaces, any change to them bumps Model_Impl::geometryVersion
+    unsigned version = this->model().getImpl<Model_Impl>()->geometryVersion();
+    if (m_cachedExteriorSurfaceArea && (m_cachedAreasVersion == version)){
+      return;
+    }
+
+    double exteriorSurfaceArea(0.0);
+    double exteriorWallArea(0.0);
     for (const Space& space : spaces()) {
-      result += space.exteriorWallArea();
+      exteriorSurfaceArea += space.exteriorArea();
+      exteriorWallArea += space.exteriorWallArea();
     }
-    return result;
+
+    m_cachedExteriorSurfaceArea = exteriorSurfaceArea;
+    m_cachedExteriorWallArea = exteriorWallArea;
+    m_cachedAreasVersion = version;
   }
 
   double ThermalZone_Impl::airVolume() const {
@@ -465,6 +465,14 @@ namespace detail {
 
    private:
     REGISTER_LOGGER("openstudio.model.ThermalZone");
+
+    // computes the cached areas in one pass over the spaces, unless they are current
+    void cacheAreas() const;
+
+    mutable boost::optional<double> m_cachedExteriorSurfaceArea;
+    mutable boost::optional<double> m_cachedExteriorWallArea;
+    // Model_Impl::geometryVersion the cached values were computed at
+    mutable unsigned m_cachedAreasVersion = 0;
     
     openstudio::OSOptionalQuantity ceilingHeight_SI() const;
     openstudio::OSOptionalQuantity ceilingHeight_IP() const;
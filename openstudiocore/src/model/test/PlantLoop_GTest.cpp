@@ -28,10 +28,12 @@
 
 #include <gtest/gtest.h>
 #include "ModelFixture.hpp"
+#include "../Model_Impl.hpp"
 #include "../PlantLoop.hpp"
 #include "../Node.hpp"
 #include "../Node_Impl.hpp"
 #include "../Loop.hpp"
+#include "../Connection.hpp"
 #include "../ConnectorSplitter.hpp"
 #include "../ConnectorSplitter_Impl.hpp"
 #include "../ConnectorMixer.hpp"
@@ -184,6 +186,68 @@ TEST_F(ModelFixture,PlantLoop_demandComponents)
   ASSERT_EQ( 3u,plantLoop.demandComponents(coil2,mixer).size() );
 }
 
+TEST_F(ModelFixture,PlantLoop_demandComponents_ManyBranches)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+
+  std::vector<CoilHeatingWater> coils;
+  for( unsigned i = 0; i < 50; ++i ) {
+    CoilHeatingWater coil(m,s);
+    EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+    coils.push_back(coil);
+  }
+
+  // inlet node, splitter, mixer, outlet node and three components per branch
+  std::vector<ModelObject> components = plantLoop.demandComponents();
+  ASSERT_EQ( 4u + 3u * 50u, components.size() );
+  EXPECT_EQ( plantLoop.demandInletNode(), components.front() );
+  EXPECT_EQ( plantLoop.demandOutletNode(), components.back() );
+  EXPECT_EQ( 50u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size() );
+
+  for( const auto & coil : coils ) {
+    ASSERT_TRUE( plantLoop.demandComponent(coil.handle()) );
+    EXPECT_FALSE( plantLoop.supplyComponent(coil.handle()) );
+  }
+
+  // the cached graph is rebuilt after the topology changes
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coils.back()));
+  EXPECT_EQ( 4u + 3u * 49u, plantLoop.demandComponents().size() );
+  EXPECT_FALSE( plantLoop.demandComponent(coils.back().handle()) );
+}
+
+TEST_F(ModelFixture,PlantLoop_demandComponents_TopologyChanges)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+  CoilHeatingWater coil(m,s);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  EXPECT_EQ( 1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size() );
+
+  std::shared_ptr<openstudio::model::detail::Model_Impl> modelImpl = m.getImpl<openstudio::model::detail::Model_Impl>();
+
+  // fields that are not ports leave the cached graph alone
+  unsigned version = modelImpl->hvacTopologyVersion();
+  EXPECT_TRUE(coil.setName("Renamed Coil"));
+  EXPECT_EQ( version, modelImpl->hvacTopologyVersion() );
+
+  // the Connection setters invalidate it
+  boost::optional<Connection> connection = coil.getModelObjectTarget<Connection>(coil.waterOutletPort());
+  ASSERT_TRUE(connection);
+  connection->setSourceObjectPort(coil.waterOutletPort());
+  EXPECT_NE( version, modelImpl->hvacTopologyVersion() );
+  EXPECT_EQ( 1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size() );
+
+  // a port field cleared directly is picked up once the change is reported
+  version = modelImpl->hvacTopologyVersion();
+  EXPECT_TRUE(coil.setString(coil.waterOutletPort(), ""));
+  EXPECT_EQ( version, modelImpl->hvacTopologyVersion() );
+  modelImpl->hvacTopologyChanged();
+  EXPECT_TRUE( plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).empty() );
+}
+
 TEST_F(ModelFixture,PlantLoop_addDemandBranchForComponent)
 {
   Model m; 
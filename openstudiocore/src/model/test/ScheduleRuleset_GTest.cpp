@@ -43,6 +43,8 @@
 #include "../ScheduleTypeLimits_Impl.hpp"
 
 #include "../../utilities/core/UUID.hpp"
+#include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/data/Vector.hpp"
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
 
@@ -933,3 +935,77 @@ Nov 11  Veterans Day
 Nov 26  Thanksgiving Day
 Dec 25  Christmas Day
 */
+
+TEST_F(ModelFixture, ScheduleRuleset_AnnualTimeSeries)
+{
+  Model model;
+
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleRuleset schedule(model);
+  schedule.defaultDaySchedule().addValue(Time(0,24,0), 1.0);
+
+  // interval must evenly divide one day
+  EXPECT_FALSE(schedule.annualTimeSeries(Time(0,0,7)));
+
+  boost::optional<TimeSeries> timeSeries = schedule.annualTimeSeries(Time(0,1,0));
+  ASSERT_TRUE(timeSeries);
+  Vector values = timeSeries->values();
+  ASSERT_EQ(8760u, values.size());
+  for (unsigned i = 0; i < values.size(); ++i){
+    EXPECT_DOUBLE_EQ(1.0, values[i]);
+  }
+
+  // weekend rule, off until 8 am and on until midnight
+  ScheduleRule weekendRule(schedule);
+  weekendRule.setApplySunday(true);
+  weekendRule.setApplySaturday(true);
+  weekendRule.daySchedule().addValue(Time(0,8,0), 0.0);
+  weekendRule.daySchedule().addValue(Time(0,24,0), 0.5);
+
+  timeSeries = schedule.annualTimeSeries(Time(0,0,15));
+  ASSERT_TRUE(timeSeries);
+  values = timeSeries->values();
+  ASSERT_EQ(35040u, values.size());
+
+  std::vector<int> activeRuleIndices = schedule.getActiveRuleIndices(yd.makeDate(1), yd.makeDate(365));
+  ASSERT_EQ(365u, activeRuleIndices.size());
+  for (unsigned doy = 1; doy <= 365; ++doy){
+    Date date = yd.makeDate(doy);
+    bool weekend = (date.dayOfWeek().value() == DayOfWeek::Saturday || date.dayOfWeek().value() == DayOfWeek::Sunday);
+    EXPECT_EQ(weekend ? 0 : -1, activeRuleIndices[doy - 1]);
+    for (unsigned i = 0; i < 96; ++i){
+      double expected = 1.0;
+      if (weekend){
+        expected = (i < 32) ? 0.0 : 0.5;
+      }
+      EXPECT_DOUBLE_EQ(expected, values[(doy - 1) * 96 + i]);
+    }
+  }
+
+  // changing the rule invalidates the cached table
+  weekendRule.setApplySunday(false);
+  weekendRule.setApplySaturday(false);
+  timeSeries = schedule.annualTimeSeries(Time(0,1,0));
+  ASSERT_TRUE(timeSeries);
+  values = timeSeries->values();
+  ASSERT_EQ(8760u, values.size());
+  for (unsigned i = 0; i < values.size(); ++i){
+    EXPECT_DOUBLE_EQ(1.0, values[i]);
+  }
+
+  // removing the rule does too
+  weekendRule.setApplySaturday(true);
+  activeRuleIndices = schedule.getActiveRuleIndices(yd.makeDate(1), yd.makeDate(365));
+  EXPECT_NE(activeRuleIndices.end(), std::find(activeRuleIndices.begin(), activeRuleIndices.end(), 0));
+  weekendRule.remove();
+  activeRuleIndices = schedule.getActiveRuleIndices(yd.makeDate(1), yd.makeDate(365));
+  EXPECT_EQ(activeRuleIndices.end(), std::find(activeRuleIndices.begin(), activeRuleIndices.end(), 0));
+
+  // and so does changing the year description
+  yd.setCalendarYear(2012);
+  timeSeries = schedule.annualTimeSeries(Time(0,1,0));
+  ASSERT_TRUE(timeSeries);
+  EXPECT_EQ(8784u, timeSeries->values().size());
+}
@@ -69,6 +69,7 @@
 #include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/geometry/BoundingBox.hpp"
 #include "../../utilities/idf/WorkspaceObjectWatcher.hpp"
+#include "../../utilities/idf/WorkspaceBatchEdit.hpp"
 #include "../../utilities/core/Compare.hpp"
 
 #include <iostream>
@@ -255,6 +256,125 @@ TEST_F(ModelFixture, Space_FloorArea)
   EXPECT_NEAR(6, space.floorArea(), 0.0001);
 }
 
+TEST_F(ModelFixture, Space_CachedAreas)
+{
+  Model model;
+  ThermalZone zone1(model);
+  ThermalZone zone2(model);
+  Space space(model);
+  EXPECT_TRUE(space.setThermalZone(zone1));
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 0, 2));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(2, 0, 0));
+  points.push_back(Point3d(2, 0, 2));
+  Surface wall(points, model);
+  wall.setSpace(space);
+  EXPECT_EQ("Wall", wall.surfaceType());
+  EXPECT_EQ("Outdoors", wall.outsideBoundaryCondition());
+
+  points.clear();
+  points.push_back(Point3d(0, 2, 0));
+  points.push_back(Point3d(2, 2, 0));
+  points.push_back(Point3d(2, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  Surface floor(points, model);
+  floor.setSpace(space);
+  EXPECT_EQ("Floor", floor.surfaceType());
+
+  EXPECT_NEAR(4, space.floorArea(), 0.0001);
+  EXPECT_NEAR(4, space.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(4, zone1.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(4, wall.netArea(), 0.0001);
+
+  // changing vertices clears cached areas of the surface, space and zone
+  points.clear();
+  points.push_back(Point3d(0, 0, 3));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(2, 0, 0));
+  points.push_back(Point3d(2, 0, 3));
+  EXPECT_TRUE(wall.setVertices(points));
+  EXPECT_NEAR(6, wall.grossArea(), 0.0001);
+  EXPECT_NEAR(6, space.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(6, zone1.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(1.5, wall.centroid().z(), 0.0001);
+
+  // adding and changing a sub surface clears the cached net area of its parent
+  points.clear();
+  points.push_back(Point3d(0.5, 0, 2));
+  points.push_back(Point3d(0.5, 0, 1));
+  points.push_back(Point3d(1.5, 0, 1));
+  points.push_back(Point3d(1.5, 0, 2));
+  SubSurface window(points, model);
+  EXPECT_TRUE(window.setSurface(wall));
+  EXPECT_NEAR(5, wall.netArea(), 0.0001);
+  EXPECT_TRUE(window.setMultiplier(2));
+  EXPECT_NEAR(4, wall.netArea(), 0.0001);
+  window.remove();
+  EXPECT_NEAR(6, wall.netArea(), 0.0001);
+
+  // moving the space to another zone clears both zones
+  EXPECT_TRUE(space.setThermalZone(zone2));
+  EXPECT_NEAR(0, zone1.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(6, zone2.exteriorWallArea(), 0.0001);
+
+  // removing a surface clears cached areas of the space and zone
+  wall.remove();
+  EXPECT_NEAR(0, space.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(0, zone2.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(4, space.floorArea(), 0.0001);
+
+  floor.remove();
+  EXPECT_EQ(0, space.floorArea());
+}
+
+TEST_F(ModelFixture, Space_CachedAreas_BatchEdit)
+{
+  Model model;
+  ThermalZone zone(model);
+  Space space(model);
+  EXPECT_TRUE(space.setThermalZone(zone));
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 0, 2));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(2, 0, 0));
+  points.push_back(Point3d(2, 0, 2));
+  Surface wall(points, model);
+  wall.setSpace(space);
+  EXPECT_NEAR(4, wall.grossArea(), 0.0001);
+  EXPECT_NEAR(4, space.exteriorWallArea(), 0.0001);
+  EXPECT_NEAR(4, zone.exteriorWallArea(), 0.0001);
+
+  {
+    // cached values are cleared immediately inside a batch edit
+    WorkspaceBatchEdit batchEdit(model);
+    points.clear();
+    points.push_back(Point3d(0, 0, 3));
+    points.push_back(Point3d(0, 0, 0));
+    points.push_back(Point3d(2, 0, 0));
+    points.push_back(Point3d(2, 0, 3));
+    EXPECT_TRUE(wall.setVertices(points));
+    EXPECT_NEAR(6, wall.grossArea(), 0.0001);
+    EXPECT_NEAR(6, space.exteriorWallArea(), 0.0001);
+    EXPECT_NEAR(6, zone.exteriorWallArea(), 0.0001);
+    EXPECT_NEAR(1.5, wall.centroid().z(), 0.0001);
+
+    points.clear();
+    points.push_back(Point3d(0, 0, 1));
+    points.push_back(Point3d(0, 0, 0));
+    points.push_back(Point3d(2, 0, 0));
+    points.push_back(Point3d(2, 0, 1));
+    EXPECT_TRUE(wall.setVertices(points));
+    EXPECT_NEAR(2, wall.grossArea(), 0.0001);
+    EXPECT_NEAR(2, space.exteriorWallArea(), 0.0001);
+  }
+
+  EXPECT_NEAR(2, wall.grossArea(), 0.0001);
+  EXPECT_NEAR(2, zone.exteriorWallArea(), 0.0001);
+}
+
 TEST_F(ModelFixture, Space_Attributes) 
 {
   Model model;
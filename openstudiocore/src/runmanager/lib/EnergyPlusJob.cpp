@@ -129,7 +129,7 @@ namespace detail {
       {
         OptionalIdfFile idf = IdfFile::load(m_idf->fullPath);
         if (idf){
-          WeatherFileFinder::extractDetails(*idf, tv, m_filelocationname, m_weatherfilename);
+          WeatherFileFinder::extractDetails(*idf, tv, m_filelocationname, m_weatherfilename, m_latitude, m_longitude);
         } else {
           throw std::runtime_error("Unable to load IDF " + toString(m_idf->fullPath) + " file could not be parsed");
         }
@@ -173,7 +173,7 @@ namespace detail {
 
     if (!m_idf->hasRequiredFile(toPath("in.epw")))
     {
-      openstudio::path epw = WeatherFileFinder::find(allParams(), m_filelocationname, m_weatherfilename);
+      openstudio::path epw = WeatherFileFinder::find(allParams(), m_filelocationname, m_weatherfilename, m_latitude, m_longitude);
 
       if (!epw.empty())
       {
@@ -84,6 +84,8 @@ namespace detail {
 
       mutable boost::optional<std::string> m_filelocationname;
       mutable boost::optional<std::string> m_weatherfilename;
+      mutable boost::optional<double> m_latitude;
+      mutable boost::optional<double> m_longitude;
 
       std::string m_description; //< Description of job
 
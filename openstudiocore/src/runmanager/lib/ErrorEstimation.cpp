@@ -83,6 +83,23 @@ namespace openstudio {
       return sum / m_uses.size();
     }
 
+    FuelUses FuelUses::operator*(const double scalar) const
+    {
+      FuelUses ret(*this);
+      ret *= scalar;
+      return ret;
+    }
+
+    FuelUses &FuelUses::operator*=(const double scalar)
+    {
+      for (auto & use : m_uses)
+      {
+        use.second *= scalar;
+      }
+
+      return *this;
+    }
+
     FuelUses FuelUses::operator/(const double scalar) const
     {
       FuelUses ret(*this);
@@ -227,9 +244,17 @@ namespace openstudio {
       return add(getUses(t_sourceName, t_userModel, t_isoResults), t_sourceName, t_variables);
     }
 
-    FuelUses ErrorEstimation::add(const SqlFile &t_sql, const std::string &t_sourceName, const std::vector<double> &t_variables)
+    FuelUses ErrorEstimation::add(const SqlFile &t_sql, const std::string &t_sourceName, const std::vector<double> &t_variables,
+        double t_scale)
     {
-      return add(getUses(t_sourceName, t_sql), t_sourceName, t_variables);
+      FuelUses uses = getUses(t_sourceName, t_sql);
+
+      if (t_scale != 1.0)
+      {
+        uses *= t_scale;
+      }
+
+      return add(uses, t_sourceName, t_variables);
     }
 
     /// adds the data of an SqlFile simulation result into the ErrorEstimation and returns the error corrected values
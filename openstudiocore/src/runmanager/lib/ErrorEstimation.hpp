@@ -63,6 +63,9 @@ namespace openstudio {
     {
       FuelUses(double t_confidence);
 
+      FuelUses operator*(const double t_scalar) const;
+      FuelUses &operator*=(const double t_scalar);
+
       FuelUses operator/(const double t_scalar) const;
       FuelUses &operator/=(const double t_scalar);
 
@@ -110,9 +113,11 @@ namespace openstudio {
         /// \param[in] t_sql The SqlFile to pull the year end summary data from
         /// \param[in] t_sourceName The name of the simulation source this data is from, registered with addSource
         /// \param[in] t_variables The name of the variable that this data is for
+        /// \param[in] t_scale Factor applied to the year end values, for simulations that covered only part of the year
         ///
         /// \returns The error corrected values, or the input values if error correction was not possible
-        openstudio::runmanager::FuelUses add(const SqlFile &t_sql, const std::string &t_sourceName, const std::vector<double> &t_variables);
+        openstudio::runmanager::FuelUses add(const SqlFile &t_sql, const std::string &t_sourceName, const std::vector<double> &t_variables,
+            double t_scale = 1.0);
 
         /// Adds the data of an ISOResults from an ISO simulation into the ErrorEstimation and returns the error corrected values;
         /// 
@@ -32,9 +32,11 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/lu.hpp>
 
+#include <limits>
+
 
 LinearApproximation::LinearApproximation(const size_t t_numVars)
-  : m_numVars(t_numVars)
+  : m_numVars(t_numVars), m_treeRows(0)
 {
 }
 
@@ -42,12 +44,28 @@ LinearApproximation::~LinearApproximation()
 {
 }
 
+size_t LinearApproximation::numSamples() const
+{
+  return m_rows.size();
+}
+
+const double *LinearApproximation::row(size_t t_row) const
+{
+  return &m_values[t_row * (m_numVars + 1)];
+}
+
+std::vector<double> LinearApproximation::rowVector(size_t t_row) const
+{
+  const double *r = row(t_row);
+  return std::vector<double>(r, r + m_numVars + 1);
+}
+
 double LinearApproximation::average() const
 {
   double sum = 0;
-  for (const auto & lhsitr : m_values)
+  for (size_t i = 0; i < numSamples(); ++i)
   {
-    sum += lhsitr[m_numVars];
+    sum += row(i)[m_numVars];
   }
   return sum / m_numVars;
 }
@@ -61,30 +79,15 @@ LinearApproximation LinearApproximation::operator-(const LinearApproximation &t_
 
   LinearApproximation retval(m_numVars);
 
-  for (const auto & lhsitr : m_values)
+  for (size_t i = 0; i < numSamples(); ++i)
   {
-    for (const auto & rhsitr : t_rhs.m_values)
-    {
-      std::vector<double> vals(m_numVars, 0);
-
-      bool match = true;
-      for (size_t i = 0; i < m_numVars; ++i)
-      {
-        if ( lhsitr[i] != rhsitr[i] )
-        {
-          match = false;
-          break;
-        } else {
-          vals[i] = lhsitr[i];
-        }
-      }
+    std::vector<double> vals(row(i), row(i) + m_numVars);
 
-      if (match)
-      {
-        double value = lhsitr[m_numVars] - rhsitr[m_numVars];
-        retval.addVals(vals, value);
-        break;
-      }
+    std::map<std::vector<double>, size_t>::const_iterator match = t_rhs.m_rows.find(vals);
+    if (match != t_rhs.m_rows.end())
+    {
+      double value = row(i)[m_numVars] - t_rhs.row(match->second)[m_numVars];
+      retval.addVals(vals, value);
     }
   }
 
@@ -95,76 +98,58 @@ void LinearApproximation::addVals(std::vector<double> t_vals, const double t_res
 {
   validateVariableSize(t_vals);
 
-  t_vals.push_back(t_result);
-
-  for (std::vector<std::vector<double> >::const_iterator lhsitr = m_values.begin();
-      lhsitr != m_values.end();
-      ++lhsitr)
+  std::map<std::vector<double>, size_t>::const_iterator existing = m_rows.find(t_vals);
+  if (existing != m_rows.end())
   {
-    bool match = true;
-    for (size_t i = 0; i < m_numVars; ++i)
-    {
-      if ( (*lhsitr)[i] != t_vals[i] )
-      {
-        match = false;
-        break;
-      }
-    }
-
-    if (match)
+    if (row(existing->second)[m_numVars] != t_result)
     {
-      if ((*lhsitr)[m_numVars] != t_result)
-      {
-        throw std::runtime_error("Data already exists with a different result value");
-      } else {
-        // it already exists
-        return;
-      }
+      throw std::runtime_error("Data already exists with a different result value");
+    } else {
+      // it already exists
+      return;
     }
   }
 
   // it didn't already exist, add it now
-  m_values.push_back(t_vals);
-
+  m_values.insert(m_values.end(), t_vals.begin(), t_vals.end());
+  m_values.push_back(t_result);
+  m_rows.insert(std::make_pair(t_vals, m_rows.size()));
 }
 
 
 
 
-std::vector<std::vector<double> > LinearApproximation::findMinimalDifferences(
+std::vector<size_t> LinearApproximation::findMinimalDifferences(
     size_t t_numDifferences,
-    const std::vector<std::vector<double> > &t_vals,
-    const std::vector<std::vector<double> > &t_data) const
+    const std::vector<double> &t_point,
+    const std::vector<size_t> &t_chosen,
+    const std::vector<size_t> &t_data) const
 {
-  // t_vals includes the baseline requested value, so we want one more than that
-  if (t_data.empty() || t_numDifferences + 2 == t_vals.size())
+  // t_chosen does not include the baseline requested value, so we want one more than that
+  if (t_data.empty() || t_numDifferences + 1 == t_chosen.size())
   {
     // this is as good as we're going to get / can use right now
-    std::vector<std::vector<double> > retval = t_vals;
-
-    if (!t_vals.empty())
-    {
-      retval.erase(retval.begin());
-    }
-    return retval;
+    return t_chosen;
   }
 
-  std::vector<std::vector<double> > candidates;
-  std::vector<std::vector<double> > remainder;
+  std::vector<size_t> candidates;
 
   for (size_t i = 0; i < t_data.size(); ++i)
   {
+    const double *data = row(t_data[i]);
     size_t numDifferences = 0;
 
     for (size_t j = 0; j < m_numVars; ++j)
     {
-      for (size_t i2 = 0; i2 < t_vals.size(); ++i2)
+      bool different = (data[j] != t_point[j]);
+      for (size_t i2 = 0; !different && i2 < t_chosen.size(); ++i2)
       {
-        if (t_data[i][j] != t_vals[i2][j])
-        {
-          ++numDifferences;
-          break; // don't check any further input rows
-        }
+        different = (data[j] != row(t_chosen[i2])[j]);
+      }
+
+      if (different)
+      {
+        ++numDifferences;
       }
 
       if (numDifferences > t_numDifferences)
@@ -177,23 +162,23 @@ std::vector<std::vector<double> > LinearApproximation::findMinimalDifferences(
     if (numDifferences <= t_numDifferences)
     {
       candidates.push_back(t_data[i]);
-    } else {
-      remainder.push_back(t_data[i]);
     }
   }
 
-  std::vector<std::vector<double> > keptresult = t_vals;
-  keptresult.erase(keptresult.begin());
+  std::vector<size_t> keptresult = t_chosen;
 
-  for (size_t i = 0; i < candidates.size(); ++i)
+  // only a strictly longer result replaces the kept one, so stop once it cannot grow any further
+  for (size_t i = 0; i < candidates.size() && keptresult.size() < t_numDifferences + 1; ++i)
   {
-    std::vector<std::vector<double> > newvals(t_vals);
-    newvals.push_back(candidates[i]);
+    std::vector<size_t> newchosen(t_chosen);
+    newchosen.push_back(candidates[i]);
 
-    std::vector<std::vector<double> > newdata(t_data);
-    newdata.erase(std::remove(newdata.begin(), newdata.end(), candidates[i]), newdata.end());
+    // adding a row never reduces the number of differing columns, so rows that are not candidates
+    // now cannot become candidates further down
+    std::vector<size_t> newdata(candidates);
+    newdata.erase(newdata.begin() + i);
 
-    std::vector<std::vector<double> > result = findMinimalDifferences(t_numDifferences, newvals, newdata);
+    std::vector<size_t> result = findMinimalDifferences(t_numDifferences, t_point, newchosen, newdata);
     if (result.size() > keptresult.size())
     {
       keptresult = result;
@@ -203,22 +188,45 @@ std::vector<std::vector<double> > LinearApproximation::findMinimalDifferences(
   return keptresult;
 }
 
-std::vector<std::vector<double> > LinearApproximation::filterForProblemReduction(const std::vector<double> &t_vals,
-    const std::vector<std::vector<double> > &t_data) const
+bool LinearApproximation::filterForProblemReduction(const std::vector<double> &t_vals,
+    const std::vector<size_t> &t_rows, std::vector<size_t> &t_result) const
 {
-  std::vector<std::vector<double> > testData;
-  testData.push_back(t_vals);
+  // number of variables in which each row differs from the requested point
+  std::vector<size_t> numDifferences(t_rows.size(), 0);
+  for (size_t r = 0; r < t_rows.size(); ++r)
+  {
+    const double *data = row(t_rows[r]);
+    for (size_t j = 0; j < m_numVars; ++j)
+    {
+      if (data[j] != t_vals[j])
+      {
+        ++numDifferences[r];
+      }
+    }
+  }
 
   for (size_t i = 1; i < m_numVars; ++i)
   {
-    std::vector<std::vector<double> > results = findMinimalDifferences(i, testData, t_data);
+    // t_rows is already sorted by distance, filtering keeps that order
+    std::vector<size_t> testData;
+    for (size_t r = 0; r < t_rows.size(); ++r)
+    {
+      if (numDifferences[r] <= i)
+      {
+        testData.push_back(t_rows[r]);
+      }
+    }
+
+    std::vector<size_t> results = findMinimalDifferences(i, t_vals, std::vector<size_t>(), testData);
     if (results.size() > i)
     {
-      return results;
+      t_result = results;
+      return true;
     }
   }
 
-  return t_data;
+  t_result = t_rows;
+  return false;
 }
 
 
@@ -230,23 +238,59 @@ double LinearApproximation::approximate(const std::vector<double> &t_vals) const
 
 //  print("Approximating: ", t_vals);
 
-  std::vector<std::vector<double> > sortedPoints = sortByDistance(t_vals, m_values);
-
-  if (!sortedPoints.empty() && distance(t_vals, sortedPoints[0]) == 0)
+  std::map<std::vector<double>, size_t>::const_iterator exact = m_rows.find(t_vals);
+  if (exact != m_rows.end())
   {
     //return exact match
-    return sortedPoints[0].back();
+    return row(exact->second)[m_numVars];
   }
 
-  std::vector<std::vector<double> > optimalPoints = filterForProblemReduction(t_vals, sortedPoints);
+  // look for usable points among the nearest rows first, widening the search until they are
+  // found or every row has been considered
+  std::vector<size_t> similarPoints;
+  size_t count = std::max<size_t>(64, 4 * (m_numVars + 1));
+  while (true)
+  {
+    count = std::min(count, numSamples());
+
+    std::vector<size_t> optimalPoints;
+    bool reduced = filterForProblemReduction(t_vals, nearestRows(t_vals, count), optimalPoints);
+
+    if (count == numSamples())
+    {
+      similarPoints = filterForSimilarity(t_vals, optimalPoints);
+      break;
+    }
+
+    if (reduced)
+    {
+      try {
+        similarPoints = filterForSimilarity(t_vals, optimalPoints);
+        if (spansPoint(t_vals, similarPoints))
+        {
+          break;
+        }
+      } catch (const std::runtime_error &) {
+      }
+      // the nearby rows do not vary in every needed variable, keep looking further out
+    }
 
-//  print("Starting points: ", m_values);
+    count *= 4;
+  }
 
-//  print("Sorted Points: ", sortedPoints);
-  std::vector<std::vector<double> > chosenPoints = filterForSimilarity(t_vals, optimalPoints);
+  std::vector<std::vector<double> > chosenPoints;
+  for (size_t i : similarPoints)
+  {
+    chosenPoints.push_back(rowVector(i));
+  }
 
 //  print("Chosen points: ", chosenPoints);
 
+  if (chosenPoints.empty())
+  {
+    throw std::runtime_error("Unabled to approximate, not enough data");
+  }
+
 
   std::vector<std::vector<std::vector<double> > > coefficientMatrices = buildCoefficientMatrices(chosenPoints);
 
@@ -274,7 +318,7 @@ double LinearApproximation::approximate(const std::vector<double> &t_vals) const
     throw std::runtime_error("Unabled to approximate, not enough data");
   }
 
-  approximation = (approximation + chosenPoints[0][m_numVars] * coefficients[m_numVars]) / coefficients[m_numVars];
+  approximation = (chosenPoints[0][m_numVars] * coefficients[m_numVars] - approximation) / coefficients[m_numVars];
 
 //  std::cout << "final approximation: " << approximation << std::endl;
 
@@ -290,9 +334,9 @@ void LinearApproximation::validateVariableSize(const std::vector<double> &t_vals
   }
 }
 
-const std::vector<std::vector<double> > LinearApproximation::filterForSimilarity(const std::vector<double> &t_point, const std::vector<std::vector<double> > &t_vals) const
+std::vector<size_t> LinearApproximation::filterForSimilarity(const std::vector<double> &t_point, const std::vector<size_t> &t_rows) const
 {
-  std::vector<std::vector<double> > goodPoints = t_vals;
+  std::vector<size_t> goodPoints = t_rows;
   int pointsNeeded = m_numVars + 1;
 
   for (size_t i = 0; i < m_numVars; ++i)
@@ -303,14 +347,15 @@ const std::vector<std::vector<double> > LinearApproximation::filterForSimilarity
     int differencePosition = -1;
 
     int rowCount = 0;
-    for (const auto & vals : t_vals)
+    for (size_t r : t_rows)
     {
-      if (t_vals[0][i] != vals[i])
+      double val = row(r)[i];
+      if (row(t_rows[0])[i] != val)
       {
         diversityFound = true; // not all of the inputs match each other
       }
 
-      if (t_point[i] != vals[i])
+      if (t_point[i] != val)
       {
         allTheSame = false; // not all of the inputs for this position match the requested approximation
         differencePosition = rowCount;
@@ -341,6 +386,28 @@ const std::vector<std::vector<double> > LinearApproximation::filterForSimilarity
   return goodPoints;
 }
 
+bool LinearApproximation::spansPoint(const std::vector<double> &t_point, const std::vector<size_t> &t_rows) const
+{
+  if (t_rows.empty())
+  {
+    return false;
+  }
+
+  // a variable that is constant across the rows is dropped from the fit, which is only
+  // right if the requested point has that same value
+  for (size_t i = 0; i < m_numVars; ++i)
+  {
+    double val = row(t_rows[0])[i];
+    if (t_point[i] != val
+        && std::all_of(t_rows.begin(), t_rows.end(), [&](size_t t_row) { return row(t_row)[i] == val; }))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 std::vector<std::vector<std::vector<double> > > LinearApproximation::buildCoefficientMatrices(
     const std::vector<std::vector<double> > &t_points) const
 {
@@ -363,8 +430,17 @@ std::vector<std::vector<std::vector<double> > > LinearApproximation::buildCoeffi
     }
   }
 
+  if (t_points.size() + discardedColumns.size() < m_numVars + 1)
+  {
+    // fewer points than varying columns, the system is underdetermined
+    throw std::runtime_error("Unabled to approximate, not enough data");
+  }
+
   std::vector<std::vector<std::vector<double> > > retvals;
 
+  // position of the column among those kept, the minors alternate in sign by it
+  size_t position = 0;
+
   for (size_t i = 0; i <= m_numVars; ++i)
   {
     if (discardedColumns.count(i) == 1)
@@ -389,6 +465,17 @@ std::vector<std::vector<std::vector<double> > > LinearApproximation::buildCoeffi
         }
         m.push_back(row);
       }
+
+      if (position % 2 == 1)
+      {
+        // negating a row negates the determinant, which gives the cofactor
+        for (auto &val : m[0])
+        {
+          val = -val;
+        }
+      }
+      ++position;
+
       retvals.push_back(m);
     }
   }
@@ -527,24 +614,15 @@ std::vector<double> LinearApproximation::solveDeterminates(const std::vector<std
   return retval; 
 }
 
-std::vector<std::vector<double> > LinearApproximation::sortByDistance(const std::vector<double> &t_point, 
-    const std::vector<std::vector<double> > &t_values) const
+bool LinearApproximation::closer(const std::pair<double, size_t> &t_lhs, const std::pair<double, size_t> &t_rhs) const
 {
-  std::set<std::pair<double, std::vector<double> > > distanceSorted;
-
-  for (const auto & vals : t_values)
+  // by distance, then by row values
+  if (t_lhs.first != t_rhs.first)
   {
-    distanceSorted.insert(std::make_pair(distance(t_point, vals), vals));
+    return t_lhs.first < t_rhs.first;
   }
-
-  std::vector<std::vector<double> > retval;
-
-  for (const auto & vals : distanceSorted)
-  {
-    retval.push_back(vals.second);
-  }
-
-  return retval;
+  return std::lexicographical_compare(row(t_lhs.second), row(t_lhs.second) + m_numVars + 1,
+                                      row(t_rhs.second), row(t_rhs.second) + m_numVars + 1);
 }
 
 double LinearApproximation::distance(const std::vector<double> &t_p1, const std::vector<double> &t_p2) const
@@ -589,16 +667,276 @@ void LinearApproximation::print(const std::string &t_str, const std::vector<std:
   }
 }
 
+double LinearApproximation::squaredDistance(const std::vector<double> &t_point, size_t t_row) const
+{
+  const double *data = row(t_row);
+  double result = 0;
+  for (size_t i = 0; i < m_numVars; ++i)
+  {
+    double part = t_point[i] - data[i];
+    part *= part;
+
+    result += part;
+  }
+
+  return result;
+}
+
+void LinearApproximation::buildTree() const
+{
+  m_treeRows = numSamples();
+  m_treeOrder.resize(m_treeRows);
+  for (size_t i = 0; i < m_treeRows; ++i)
+  {
+    m_treeOrder[i] = i;
+  }
+  m_treeNodes.clear();
+  m_treeBounds.clear();
+
+  if (m_treeRows > 0)
+  {
+    buildNode(0, m_treeRows);
+  }
+}
+
+int LinearApproximation::buildNode(size_t t_begin, size_t t_end) const
+{
+  const size_t leafSize = 16;
+
+  int node = static_cast<int>(m_treeNodes.size());
+  KdNode kdNode = { t_begin, t_end, -1, -1 };
+  m_treeNodes.push_back(kdNode);
+
+  size_t boundsBegin = m_treeBounds.size();
+  m_treeBounds.insert(m_treeBounds.end(), row(m_treeOrder[t_begin]), row(m_treeOrder[t_begin]) + m_numVars);
+  m_treeBounds.insert(m_treeBounds.end(), row(m_treeOrder[t_begin]), row(m_treeOrder[t_begin]) + m_numVars);
+  for (size_t i = t_begin + 1; i < t_end; ++i)
+  {
+    const double *data = row(m_treeOrder[i]);
+    for (size_t j = 0; j < m_numVars; ++j)
+    {
+      m_treeBounds[boundsBegin + j] = std::min(m_treeBounds[boundsBegin + j], data[j]);
+      m_treeBounds[boundsBegin + m_numVars + j] = std::max(m_treeBounds[boundsBegin + m_numVars + j], data[j]);
+    }
+  }
+
+  if (t_end - t_begin <= leafSize)
+  {
+    return node;
+  }
+
+  // split on the widest dimension
+  size_t axis = 0;
+  double widest = -1;
+  for (size_t j = 0; j < m_numVars; ++j)
+  {
+    double width = m_treeBounds[boundsBegin + m_numVars + j] - m_treeBounds[boundsBegin + j];
+    if (width > widest)
+    {
+      widest = width;
+      axis = j;
+    }
+  }
+
+  if (widest <= 0)
+  {
+    // all points identical in every variable, cannot split
+    return node;
+  }
+
+  size_t mid = t_begin + (t_end - t_begin) / 2;
+  std::nth_element(m_treeOrder.begin() + t_begin, m_treeOrder.begin() + mid, m_treeOrder.begin() + t_end,
+      [&](size_t t_lhs, size_t t_rhs) { return row(t_lhs)[axis] < row(t_rhs)[axis]; });
+
+  int left = buildNode(t_begin, mid);
+  int right = buildNode(mid, t_end);
+  m_treeNodes[node].left = left;
+  m_treeNodes[node].right = right;
+  return node;
+}
+
+void LinearApproximation::ensureTree() const
+{
+  // rebuild once the rows added since the last build are a sizeable fraction of the total
+  size_t untracked = numSamples() - m_treeRows;
+  if (untracked > 0 && (m_treeRows == 0 || untracked * 8 > m_treeRows))
+  {
+    buildTree();
+  }
+}
+
+void LinearApproximation::boxDistances(int t_node, const std::vector<double> &t_point, double &t_min, double &t_max) const
+{
+  const double *lower = &m_treeBounds[2 * m_numVars * t_node];
+  const double *upper = lower + m_numVars;
+
+  // closest and farthest any point in the bounding box can be
+  t_min = 0;
+  t_max = 0;
+  for (size_t j = 0; j < m_numVars; ++j)
+  {
+    double toLower = t_point[j] - lower[j];
+    double toUpper = upper[j] - t_point[j];
+    if (toLower < 0)
+    {
+      t_min += toLower * toLower;
+    } else if (toUpper < 0) {
+      t_min += toUpper * toUpper;
+    }
+    double farthest = std::max(std::fabs(toLower), std::fabs(toUpper));
+    t_max += farthest * farthest;
+  }
+}
+
+void LinearApproximation::addNearest(std::vector<std::pair<double, size_t> > &t_heap, size_t t_count,
+    const std::pair<double, size_t> &t_candidate) const
+{
+  auto compare = [this](const std::pair<double, size_t> &t_lhs, const std::pair<double, size_t> &t_rhs) {
+    return closer(t_lhs, t_rhs);
+  };
+
+  // t_heap is a max-heap, its front is the furthest row kept so far
+  if (t_heap.size() < t_count)
+  {
+    t_heap.push_back(t_candidate);
+    std::push_heap(t_heap.begin(), t_heap.end(), compare);
+  } else if (closer(t_candidate, t_heap.front())) {
+    std::pop_heap(t_heap.begin(), t_heap.end(), compare);
+    t_heap.back() = t_candidate;
+    std::push_heap(t_heap.begin(), t_heap.end(), compare);
+  }
+}
+
+void LinearApproximation::nearestRows(int t_node, const std::vector<double> &t_point, size_t t_count,
+    std::vector<std::pair<double, size_t> > &t_heap) const
+{
+  const KdNode &node = m_treeNodes[t_node];
+
+  double minDistance = 0;
+  double maxDistance = 0;
+  boxDistances(t_node, t_point, minDistance, maxDistance);
+
+  // rows at exactly the kept distance can still win on the tie break
+  if (t_heap.size() == t_count && minDistance > t_heap.front().first)
+  {
+    return;
+  }
+
+  if (node.left < 0)
+  {
+    for (size_t i = node.begin; i < node.end; ++i)
+    {
+      addNearest(t_heap, t_count, std::make_pair(squaredDistance(t_point, m_treeOrder[i]), m_treeOrder[i]));
+    }
+    return;
+  }
+
+  // descend into the closer child first so the far one is more likely to be pruned
+  double leftMin = 0;
+  double rightMin = 0;
+  double unused = 0;
+  boxDistances(node.left, t_point, leftMin, unused);
+  boxDistances(node.right, t_point, rightMin, unused);
+  if (leftMin <= rightMin)
+  {
+    nearestRows(node.left, t_point, t_count, t_heap);
+    nearestRows(node.right, t_point, t_count, t_heap);
+  } else {
+    nearestRows(node.right, t_point, t_count, t_heap);
+    nearestRows(node.left, t_point, t_count, t_heap);
+  }
+}
+
+std::vector<size_t> LinearApproximation::nearestRows(const std::vector<double> &t_point, size_t t_count) const
+{
+  ensureTree();
+
+  std::vector<std::pair<double, size_t> > heap;
+  heap.reserve(t_count);
+
+  if (t_count > 0)
+  {
+    for (size_t i = m_treeRows; i < numSamples(); ++i)
+    {
+      addNearest(heap, t_count, std::make_pair(squaredDistance(t_point, i), i));
+    }
+
+    if (!m_treeNodes.empty())
+    {
+      nearestRows(0, t_point, t_count, heap);
+    }
+  }
+
+  std::sort(heap.begin(), heap.end(),
+      [this](const std::pair<double, size_t> &t_lhs, const std::pair<double, size_t> &t_rhs) {
+        return closer(t_lhs, t_rhs);
+      });
+
+  std::vector<size_t> retval;
+  retval.reserve(heap.size());
+  for (const auto &entry : heap)
+  {
+    retval.push_back(entry.second);
+  }
+  return retval;
+}
+
+void LinearApproximation::nearestFurthest(int t_node, const std::vector<double> &t_point, double &t_nearest, double &t_furthest) const
+{
+  const KdNode &node = m_treeNodes[t_node];
+
+  double minDistance = 0;
+  double maxDistance = 0;
+  boxDistances(t_node, t_point, minDistance, maxDistance);
+
+  bool needNearest = minDistance < t_nearest;
+  bool needFurthest = maxDistance > t_furthest;
+  if (!needNearest && !needFurthest)
+  {
+    return;
+  }
+
+  if (node.left < 0)
+  {
+    for (size_t i = node.begin; i < node.end; ++i)
+    {
+      double d = squaredDistance(t_point, m_treeOrder[i]);
+      t_nearest = std::min(t_nearest, d);
+      t_furthest = std::max(t_furthest, d);
+    }
+    return;
+  }
+
+  nearestFurthest(node.left, t_point, t_nearest, t_furthest);
+  nearestFurthest(node.right, t_point, t_nearest, t_furthest);
+}
+
 std::pair<double, double> LinearApproximation::nearestFurthestNeighborDistances(const std::vector<double> &t_vals) const
 {
-  std::vector<std::vector<double> > sorted = sortByDistance(t_vals, m_values);
+  validateVariableSize(t_vals);
 
-  if (sorted.size() < 1)
+  if (numSamples() < 1)
   {
     throw std::range_error("no neighbors");
   }
 
-  return std::make_pair(distance(t_vals, sorted.front()), distance(t_vals, sorted.back()));
+  ensureTree();
+
+  double nearest = std::numeric_limits<double>::max();
+  double furthest = -1;
+  for (size_t i = m_treeRows; i < numSamples(); ++i)
+  {
+    double d = squaredDistance(t_vals, i);
+    nearest = std::min(nearest, d);
+    furthest = std::max(furthest, d);
+  }
+
+  if (!m_treeNodes.empty())
+  {
+    nearestFurthest(0, t_vals, nearest, furthest);
+  }
+
+  return std::make_pair(std::sqrt(nearest), std::sqrt(furthest));
 }
 
 void LinearApproximation::print(const std::string &t_str, const std::vector<std::vector<std::vector<double> > > &t_vals)
@@ -42,6 +42,11 @@
 #include <map>
 #include "RunManagerAPI.hpp"
 
+/// Piecewise linear surrogate over simulated points. Samples are kept in one contiguous row-major
+/// store, with an index on the variable values for duplicate detection and exact matches, and a
+/// kd-tree over the sample space for neighbor queries. approximate() fits through points drawn from
+/// the nearest rows first and only widens the search when those cannot support the fit. The kd-tree is
+/// rebuilt lazily; rows added since the last build are scanned linearly until they exceed 1/8 of it.
 class RUNMANAGER_API LinearApproximation
 {
   public:
@@ -60,16 +65,29 @@ class RUNMANAGER_API LinearApproximation
 
     std::pair<double, double> nearestFurthestNeighborDistances(const std::vector<double> &t_vals) const;
 
+    /// Number of distinct samples stored
+    size_t numSamples() const;
+
   private:
-    std::vector<std::vector<double> > findMinimalDifferences(
+    struct KdNode
+    {
+      size_t begin;
+      size_t end;
+      int left;
+      int right;
+    };
+
+    std::vector<size_t> findMinimalDifferences(
         size_t t_numDifferences,
-        const std::vector<std::vector<double> > &t_vals,
-        const std::vector<std::vector<double> > &t_data) const;
+        const std::vector<double> &t_point,
+        const std::vector<size_t> &t_chosen,
+        const std::vector<size_t> &t_data) const;
 
     void validateVariableSize(const std::vector<double> &t_vals) const;
-    const std::vector<std::vector<double> > filterForSimilarity(const std::vector<double> &t_point, const std::vector<std::vector<double> > &t_vals) const;
-    std::vector<std::vector<double> > filterForProblemReduction(const std::vector<double> &t_vals,
-        const std::vector<std::vector<double> > &t_data) const;
+    std::vector<size_t> filterForSimilarity(const std::vector<double> &t_point, const std::vector<size_t> &t_rows) const;
+    bool spansPoint(const std::vector<double> &t_point, const std::vector<size_t> &t_rows) const;
+    bool filterForProblemReduction(const std::vector<double> &t_vals,
+        const std::vector<size_t> &t_rows, std::vector<size_t> &t_result) const;
 
 
     std::vector<std::vector<std::vector<double> > > buildCoefficientMatrices(
@@ -77,10 +95,24 @@ class RUNMANAGER_API LinearApproximation
     std::vector<std::vector<double> > removeCol(const std::vector<std::vector<double> > &t_matrix, const size_t col) const;
     double determinate(const std::vector<std::vector<double> > &t_matrix) const;
     std::vector<double> solveDeterminates(const std::vector<std::vector<std::vector<double> > > &t_matrices) const;
-    std::vector<std::vector<double> > sortByDistance(const std::vector<double> &t_point, 
-        const std::vector<std::vector<double> > &t_values) const;
+    bool closer(const std::pair<double, size_t> &t_lhs, const std::pair<double, size_t> &t_rhs) const;
 
     double distance(const std::vector<double> &t_p1, const std::vector<double> &t_p2) const;
+    double squaredDistance(const std::vector<double> &t_point, size_t t_row) const;
+
+    const double *row(size_t t_row) const;
+    std::vector<double> rowVector(size_t t_row) const;
+
+    void ensureTree() const;
+    void buildTree() const;
+    int buildNode(size_t t_begin, size_t t_end) const;
+    void boxDistances(int t_node, const std::vector<double> &t_point, double &t_min, double &t_max) const;
+    void addNearest(std::vector<std::pair<double, size_t> > &t_heap, size_t t_count,
+        const std::pair<double, size_t> &t_candidate) const;
+    void nearestRows(int t_node, const std::vector<double> &t_point, size_t t_count,
+        std::vector<std::pair<double, size_t> > &t_heap) const;
+    std::vector<size_t> nearestRows(const std::vector<double> &t_point, size_t t_count) const;
+    void nearestFurthest(int t_node, const std::vector<double> &t_point, double &t_nearest, double &t_furthest) const;
 
     static void print(const std::string &t_str, const std::vector<double> &t_vals);
 
@@ -90,7 +122,18 @@ class RUNMANAGER_API LinearApproximation
 
     size_t m_numVars;
     mutable std::map<std::vector<std::vector<double> >, double> m_cache;
-    std::vector<std::vector<double> > m_values;
+
+    // samples, m_numVars values followed by the result for each row
+    std::vector<double> m_values;
+    // row of each distinct set of variable values
+    std::map<std::vector<double>, size_t> m_rows;
+
+    // kd-tree over the first m_treeRows rows
+    mutable std::vector<size_t> m_treeOrder;
+    mutable std::vector<KdNode> m_treeNodes;
+    // lower then upper corner of each node's bounding box
+    mutable std::vector<double> m_treeBounds;
+    mutable size_t m_treeRows;
 };
 
 #endif // RUNMANAGER_LIB_LINEARAPPROXIMATION_HPP
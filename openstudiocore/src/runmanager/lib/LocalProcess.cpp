@@ -35,6 +35,7 @@
 #include "FileInfo.hpp"
 #include "JobOutputCleanup.hpp"
 #include "RunManager_Util.hpp"
+#include "RubyWorkerPool.hpp"
 
 #include "../../utilities/time/DateTime.hpp"
 #include "../../utilities/core/ApplicationPathHelpers.hpp"
@@ -43,6 +44,10 @@
 #include <QDir>
 #include <QDateTime>
 #include <QMutexLocker>
+#include <QHostAddress>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 #ifdef Q_OS_WIN
 #include <Windows.h>
@@ -131,6 +136,9 @@ namespace detail {
     
     connect(&m_process, &MyQProcess::stateChanged, this, &LocalProcess::processStateChanged);
 
+    connect(&m_workerSocket, &QTcpSocket::readyRead, this, &LocalProcess::workerReadyRead);
+    connect(&m_workerSocket, &QTcpSocket::disconnected, this, &LocalProcess::workerDisconnected);
+
 
     LOG(Debug, "Setting working directory: " << toString(m_outdir));
     m_process.setWorkingDirectory(openstudio::toQString(m_outdir));
@@ -251,12 +259,142 @@ namespace detail {
 
     m_process.setProcessEnvironment(env);
 
+    if (RubyWorkerPool::instance().canRun(m_tool, m_parameters) && startInWorker(env))
+    {
+      return;
+    }
    
     m_process.start(openstudio::toQString(m_tool.localBinPath), list, QIODevice::ReadWrite);
   }
 
+  bool LocalProcess::startInWorker(const QProcessEnvironment &t_env)
+  {
+    // a worker may have exited since it was last used, so try a second one before giving up
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+      std::string token;
+      boost::optional<int> port = RubyWorkerPool::instance().acquire(m_tool, token);
+      if (!port)
+      {
+        return false;
+      }
+
+      m_workerSocket.connectToHost(QHostAddress(QHostAddress::LocalHost), static_cast<quint16>(*port));
+      if (!m_workerSocket.waitForConnected(5000))
+      {
+        LOG(Debug, "Unable to connect to ruby worker on port " << *port);
+        m_workerSocket.abort();
+        RubyWorkerPool::instance().release(*port, false);
+        continue;
+      }
+
+      QJsonArray args;
+      for (const auto &parameter : m_parameters)
+      {
+        args.append(toQString(parameter));
+      }
+
+      QJsonObject request;
+      request["dir"] = toQString(m_outdir);
+      request["path"] = t_env.value("PATH");
+      request["args"] = args;
+
+      m_workerPort = *port;
+      m_workerSocket.write(QByteArray(token.c_str()) + "\n");
+      m_workerSocket.write(QJsonDocument(request).toJson(QJsonDocument::Compact) + "\n");
+
+      LOG(Info, "Running " << openstudio::toString(m_tool.localBinPath) << " in ruby worker on port " << *port);
+
+      emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Processing));
+      emit started();
+      return true;
+    }
+
+    return false;
+  }
+
+  void LocalProcess::workerReadyRead()
+  {
+    directoryChanged(openstudio::toQString(m_outdir));
+
+    m_workerBuffer.append(m_workerSocket.readAll());
+
+    while (m_workerPort)
+    {
+      int eol = m_workerBuffer.indexOf('\n');
+      if (eol < 0)
+      {
+        break;
+      }
+
+      QByteArray header = m_workerBuffer.left(eol);
+      char type = header.isEmpty() ? '\0' : header.at(0);
+      int value = header.mid(2).toInt();
+
+      if (type == 'X')
+      {
+        m_workerBuffer.clear();
+        finishWorker(value, QProcess::NormalExit, true);
+        return;
+      }
+
+      if (type != 'O' && type != 'E')
+      {
+        LOG(Error, "Unexpected response from ruby worker: " << header.constData());
+        m_workerBuffer.clear();
+        finishWorker(1, QProcess::CrashExit, false);
+        return;
+      }
+
+      if (m_workerBuffer.size() < eol + 1 + value)
+      {
+        // wait for the rest of the frame
+        break;
+      }
+
+      if (!stopped())
+      {
+        handleOutput(m_workerBuffer.mid(eol + 1, value), type == 'E');
+      }
+      m_workerBuffer.remove(0, eol + 1 + value);
+    }
+  }
+
+  void LocalProcess::workerDisconnected()
+  {
+    if (m_workerPort)
+    {
+      workerReadyRead();
+    }
+
+    if (m_workerPort)
+    {
+      LOG(Error, "Ruby worker on port " << *m_workerPort << " exited before the job finished");
+      finishWorker(1, QProcess::CrashExit, false);
+    }
+  }
+
+  void LocalProcess::finishWorker(int t_exitCode, QProcess::ExitStatus t_exitStatus, bool t_workerOk)
+  {
+    int port = *m_workerPort;
+    m_workerPort.reset();
+
+    // closing the connection also tells the worker to kill the job if it is still running
+    m_workerSocket.abort();
+    RubyWorkerPool::instance().release(port, t_workerOk);
+
+    processFinished(t_exitCode, t_exitStatus);
+  }
+
   LocalProcess::~LocalProcess()
   {
+    m_workerSocket.disconnect(this);
+    if (m_workerPort)
+    {
+      m_workerSocket.abort();
+      RubyWorkerPool::instance().release(*m_workerPort, true);
+    }
+
     m_process.disconnect();
     kill(m_process, true);
     m_process.waitForFinished();
@@ -265,6 +403,12 @@ namespace detail {
 
   void LocalProcess::stopImpl()
   {
+    if (m_workerPort)
+    {
+      finishWorker(1, QProcess::CrashExit, true);
+      return;
+    }
+
     kill(m_process, true);
 
 //    if (!m_process.waitForFinished(100))
@@ -352,6 +496,22 @@ namespace detail {
 
   void LocalProcess::waitForFinished()
   {
+    // the readyRead and disconnected slots run from within waitForReadyRead and may finish the job
+    // and abort the socket, so only keep waiting while it is still connected
+    while (m_workerPort && m_workerSocket.state() == QAbstractSocket::ConnectedState)
+    {
+      if (!m_workerSocket.waitForReadyRead(-1))
+      {
+        break;
+      }
+    }
+
+    if (m_workerPort)
+    {
+      // the connection went away without the disconnected signal reaching us
+      workerDisconnected();
+    }
+
     m_process.waitForFinished(-1);
   }
 
@@ -593,7 +753,8 @@ namespace detail {
   bool LocalProcess::running() const
   {
     return m_process.state() == QProcess::Running
-      || m_process.state() == QProcess::Starting;
+      || m_process.state() == QProcess::Starting
+      || m_workerPort;
   }
 
 
@@ -42,6 +42,8 @@
 #include <QDateTime>
 #include <QTimer>
 #include <QMutex>
+#include <QTcpSocket>
+#include <boost/optional.hpp>
 
 namespace openstudio {
 namespace runmanager {
@@ -124,6 +126,13 @@ namespace detail {
 
       static void kill(QProcess &t_process, bool t_force); //< Does an appropriate process tree kill on Windows
 
+      /// Hands the invocation to a RubyWorkerPool worker instead of launching the tool
+      /// \returns false if no worker was available, in which case the tool should be started normally
+      bool startInWorker(const QProcessEnvironment &t_env);
+
+      /// Returns the worker to the pool and reports the process as finished
+      void finishWorker(int t_exitCode, QProcess::ExitStatus t_exitStatus, bool t_workerOk);
+
       static std::set<openstudio::path> copyRequiredFiles(const ToolInfo &t_tool, const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles, 
           const openstudio::path &t_basePath);
 
@@ -144,6 +153,11 @@ namespace detail {
       /// QProcess used to monitor the execution of the process.
       MyQProcess m_process;
 
+      /// Connection to the ruby worker running this process, if any
+      QTcpSocket m_workerSocket;
+      boost::optional<int> m_workerPort;
+      QByteArray m_workerBuffer;
+
 
       QTimer m_fileCheckTimer;
 
@@ -183,6 +197,12 @@ namespace detail {
 
       void emitUpdatedFileInfo(const FileInfo &fi);
 
+      /// connected to m_workerSocket readyRead, parses the output and exit code frames sent by the worker
+      void workerReadyRead();
+
+      /// connected to m_workerSocket disconnected
+      void workerDisconnected();
+
   }; 
 
 }
@@ -35,6 +35,8 @@
 #include <sstream>
 #include <iomanip>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -196,6 +198,103 @@ std::vector<std::pair<boost::gregorian::date, boost::gregorian::date> > Parallel
 }
 
 
+double ParallelEnergyPlus::predictedSpeedup(int t_totalDays, int t_numPartitions, int t_offset, int t_numCores, const Costs &t_costs)
+{
+  if (t_totalDays <= 0 || t_numPartitions <= 0 || t_numCores <= 0)
+  {
+    return 1.0;
+  }
+
+  double serialTime = t_costs.warmupSeconds + t_totalDays * t_costs.secondsPerDay;
+
+  // the longest partition sets the pace, every partition but the first repeats the warm-up and its lead in days
+  int longestPartition = (t_totalDays + t_numPartitions - 1) / t_numPartitions + (t_numPartitions > 1 ? t_offset : 0);
+  int waves = (t_numPartitions + t_numCores - 1) / t_numCores;
+  double parallelTime = waves * (t_costs.warmupSeconds + longestPartition * t_costs.secondsPerDay);
+
+  if (parallelTime <= 0)
+  {
+    return 1.0;
+  }
+
+  return serialTime / parallelTime;
+}
+
+ParallelEnergyPlus::Plan ParallelEnergyPlus::plan(int t_totalDays, int t_numCores, int t_offset, const Costs &t_costs)
+{
+  Plan best(1, 0, 1.0);
+
+  // more partitions than cores only adds warm-ups, since the extra runs have to wait for a free core
+  int maxPartitions = std::min(t_numCores, t_totalDays);
+
+  for (int n = 2; n <= maxPartitions; ++n)
+  {
+    // same restriction as createPartitions
+    if (static_cast<double>(t_totalDays) / n - 1 < t_offset)
+    {
+      break;
+    }
+
+    // the split and join themselves are not free, so only take on another partition for a real gain
+    double speedup = predictedSpeedup(t_totalDays, n, t_offset, t_numCores, t_costs);
+    if (speedup > best.predictedSpeedup * 1.05)
+    {
+      best = Plan(n, t_offset, speedup);
+    }
+  }
+
+  LOG(Debug, "Planned " << best.numPartitions << " partitions with " << best.offset << " offset days for " << t_totalDays
+      << " days on " << t_numCores << " cores, predicted speedup " << best.predictedSpeedup);
+
+  return best;
+}
+
+boost::optional<ParallelEnergyPlus::Costs> ParallelEnergyPlus::fitCosts(const std::vector<std::pair<int, double> > &t_runs)
+{
+  if (t_runs.size() < 2)
+  {
+    return boost::none;
+  }
+
+  double n = static_cast<double>(t_runs.size());
+  double sumDays = 0, sumTime = 0;
+  int minDays = t_runs.front().first, maxDays = t_runs.front().first;
+  for (const auto &run : t_runs)
+  {
+    sumDays += run.first;
+    sumTime += run.second;
+    minDays = std::min(minDays, run.first);
+    maxDays = std::max(maxDays, run.first);
+  }
+
+  double meanDays = sumDays / n;
+  double meanTime = sumTime / n;
+
+  // with nearly equal lengths the slope is dominated by timing noise
+  if (meanDays <= 0 || (maxDays - minDays) < 0.5 * meanDays)
+  {
+    return boost::none;
+  }
+
+  double sxx = 0, sxy = 0;
+  for (const auto &run : t_runs)
+  {
+    sxx += (run.first - meanDays) * (run.first - meanDays);
+    sxy += (run.first - meanDays) * (run.second - meanTime);
+  }
+
+  if (sxx <= 0)
+  {
+    return boost::none;
+  }
+
+  double secondsPerDay = std::max(sxy / sxx, 0.0);
+  double warmupSeconds = std::max(meanTime - secondsPerDay * meanDays, 0.0);
+
+  return Costs(warmupSeconds, secondsPerDay);
+}
+
+
 void ParallelEnergyPlus::writePartition(int t_partition, const openstudio::path &t_path) const
 {
   openstudio::WorkspaceObject wo = m_runPeriod.second;
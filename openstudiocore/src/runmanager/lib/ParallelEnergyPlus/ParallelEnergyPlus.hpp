@@ -29,24 +29,64 @@
 #ifndef RUNMANAGER_LIB_PARALLELENERGYPLUS_PARALLELENERGYPLUS_HPP
 #define RUNMANAGER_LIB_PARALLELENERGYPLUS_PARALLELENERGYPLUS_HPP
 
+#include "../RunManagerAPI.hpp"
 #include "../../../utilities/core/Path.hpp"
 
 #include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
 
 #include "../../../utilities/idf/Workspace.hpp"
 #include "../../../utilities/idf/WorkspaceObject.hpp"
 
 
-class ParallelEnergyPlus {
+class RUNMANAGER_API ParallelEnergyPlus {
 
   public:
 
+    /// Cost model of a single EnergyPlus run: a fixed overhead for setup, sizing and warm-up
+    /// plus a cost for each simulated day
+    struct Costs {
+      Costs(double t_warmupSeconds, double t_secondsPerDay)
+        : warmupSeconds(t_warmupSeconds), secondsPerDay(t_secondsPerDay)
+      {}
+
+      double warmupSeconds;
+      double secondsPerDay;
+    };
+
+    /// Partitioning chosen by plan()
+    struct Plan {
+      Plan(int t_numPartitions, int t_offset, double t_predictedSpeedup)
+        : numPartitions(t_numPartitions), offset(t_offset), predictedSpeedup(t_predictedSpeedup)
+      {}
+
+      int numPartitions;
+      int offset;
+      double predictedSpeedup;
+    };
+
     ParallelEnergyPlus(const openstudio::path &t_path, int t_numPartitions, int t_numOffset);
     ~ParallelEnergyPlus();
 
     void writePartition(int t_num, const openstudio::path &t_path) const;
 
+    /// Speedup over a single run predicted by t_costs for splitting t_totalDays into t_numPartitions
+    /// runs with t_offset days of lead in each, when only t_numCores runs can execute at once
+    static double predictedSpeedup(int t_totalDays, int t_numPartitions, int t_offset, int t_numCores, const Costs &t_costs);
+
+    /// Chooses the number of partitions, at most t_numCores, with the best predicted speedup. An extra
+    /// partition is only used if it is predicted to be at least 5% faster.
+    /// Each partition after the first is given t_offset days of lead in; partition counts that
+    /// leave less than that per partition are not considered.
+    static Plan plan(int t_totalDays, int t_numCores, int t_offset, const Costs &t_costs);
+
+    /// Least squares fit of Costs to (simulated days, elapsed seconds) pairs from previous runs.
+    /// The slope is only meaningful if the run lengths differ substantially, so no fit is made unless
+    /// the longest run is at least half the mean length longer than the shortest. The partitions of a
+    /// single parallel run are nearly equal in length and usually do not qualify.
+    static boost::optional<Costs> fitCosts(const std::vector<std::pair<int, double> > &t_runs);
+
   private:
     REGISTER_LOGGER("openstudio.runmanager.ParallelEnergyPlus");
 
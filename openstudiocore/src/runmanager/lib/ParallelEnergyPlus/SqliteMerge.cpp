@@ -32,6 +32,7 @@
 #include "boost/filesystem/operations.hpp"
 #include "boost/filesystem/path.hpp"
 #include "boost/filesystem.hpp"
+#include <chrono>
 #include <iostream>
 #include <sstream>
 
@@ -71,6 +72,7 @@ SqliteMerge::~SqliteMerge()
 
 void SqliteMerge::mergeFiles()
 {
+  m_phaseTimes.clear();
 
   // If there is only one file, we are done.
   if (m_files.size() == 1)
@@ -81,37 +83,77 @@ void SqliteMerge::mergeFiles()
     renameFinalDatabase( m_files[0]);
   } else {
     // Otherwise, there are more files..
-    sqlite3 *main_db = openDatabase(m_files[0]);
-
-    //summary(main_db);
-    //m_primaryKeyBase = sqlite3_last_insert_rowid(main_db);  
-    //std::sort(m_files.begin(),m_files.end()); 
-
-    for (size_t i = 1; i < m_files.size(); ++i)
-    {
-      //m_primaryKeyBase = i*1000;
-      //m_primaryKeyBase = sqlite3_last_insert_rowid(main_db);  
-      mergeDatabases(main_db,m_files[i]);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    auto elapsed = [&start]() {
+      std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      double seconds = std::chrono::duration<double>(now - start).count();
+      start = now;
+      return seconds;
+    };
+
+    // merge into a scratch copy of the first partition and only replace the partition with it once
+    // the merge is complete, so a crash with syncing and journaling turned off can not corrupt it
+    openstudio::path scratch = m_files[0].parent_path() / openstudio::toPath(openstudio::toString(m_files[0].filename()) + ".merging");
+    boost::filesystem::remove(scratch);
+    boost::filesystem::copy_file(m_files[0], scratch);
+    recordPhase("copy scratch database", elapsed());
+
+    sqlite3 *main_db = nullptr;
+    try {
+      main_db = openDatabase(scratch);
+      configureBulkLoad(main_db);
+
+      // every partition appends to the same tables, so maintain their indexes once instead of per row
+      std::vector<std::string> indexes = dropIndexes(main_db);
+      recordPhase("drop indexes", elapsed());
+
+      for (size_t i = 1; i < m_files.size(); ++i)
+      {
+        mergeDatabases(main_db,m_files[i]);
+        recordPhase("copy " + openstudio::toString(m_files[i].filename()), elapsed());
+      }
+
+      createIndexes(main_db, indexes);
+      recordPhase("rebuild indexes", elapsed());
+
+      // create ABUPS table in main database 
+      begin(main_db); 
+
+      //meaningless is the tabular data now
+      dropTabularData(main_db);
+      createABUPS(main_db); 
+      commit(main_db); 
+      closeDatabase(main_db);
+      main_db = nullptr;
+      recordPhase("create ABUPS", elapsed());
+
+      boost::filesystem::rename(scratch, m_files[0]);
+    } catch (...) {
+      if (main_db)
+      {
+        closeDatabase(main_db);
+      }
+      boost::system::error_code ec;
+      boost::filesystem::remove(scratch, ec);
+      throw;
     }
 
-    //summary(main_db);
-
-    //printMeterData(main_db);
-    //CreateView 
-    //CreateView(main_db);  //for testing purposes
-    // create ABUPS table in main database 
-    //
-    begin(main_db); 
-
-    //meaningless is the tabular data now
-    dropTabularData(main_db);
-    createABUPS(main_db); 
-    commit(main_db); 
-    closeDatabase(main_db);
     renameFinalDatabase( m_files[0]);
+    recordPhase("copy final database", elapsed());
   }
 }
 
+const std::vector<std::pair<std::string, double> > &SqliteMerge::phaseTimes() const
+{
+  return m_phaseTimes;
+}
+
+void SqliteMerge::recordPhase(const std::string &t_phase, double t_seconds)
+{
+  LOG(Info, "SqliteMerge " << t_phase << ": " << t_seconds << "s");
+  m_phaseTimes.push_back(std::make_pair(t_phase, t_seconds));
+}
+
 void SqliteMerge::dropTabularData(sqlite3 *db)
 {
   executeCommand(db, "DELETE FROM tabulardata");
@@ -392,7 +434,9 @@ void SqliteMerge::createView(sqlite3 *db)
 void SqliteMerge::renameFinalDatabase(const openstudio::path &file)
 {
   std::string tmp = m_final;
-  openstudio::path final_path =  m_working / openstudio::toPath(tmp.append(".sql"));
+  // next to the merged file unless a working directory was given, rather than in the current directory
+  openstudio::path working = m_working.empty() ? file.parent_path() : m_working;
+  openstudio::path final_path =  working / openstudio::toPath(tmp.append(".sql"));
   boost::filesystem::remove_all( final_path);
   boost::filesystem::copy_file( file, final_path);
 }
@@ -467,6 +511,23 @@ void SqliteMerge::mergeDatabases(sqlite3 *dest, const openstudio::path &source)
   // Insert table information...
 
   attachDatabases(dest, source);
+
+  // The index remapping only depends on the two databases as they are before the copy, so
+  // work it out once up front rather than in subqueries re-run against the growing tables
+  boost::optional<long long> maxTime = queryInteger(dest, "select max(TimeIndex) from main.Time");
+  boost::optional<long long> minTime = queryInteger(dest, "select min(TimeIndex) from merger.Time");
+  boost::optional<long long> maxDays = queryInteger(dest, "select max(SimulationDays) from main.Time");
+  boost::optional<long long> minDays = queryInteger(dest, "select min(SimulationDays) from merger.Time");
+  boost::optional<long long> maxData = queryInteger(dest, "select max(ReportDataIndex) from main.ReportData");
+  boost::optional<long long> minData = queryInteger(dest, "select min(ReportDataIndex) from merger.ReportData");
+  boost::optional<long long> maxExtended = queryInteger(dest, "select max(ReportExtendedDataIndex) from main.ReportExtendedData");
+  boost::optional<long long> minExtended = queryInteger(dest, "select min(ReportExtendedDataIndex) from merger.ReportExtendedData");
+
+  long long timeOffset = (maxTime ? *maxTime : 0) - (minTime ? *minTime : 0) + 1;
+  long long daysOffset = (maxDays ? *maxDays : 0) - (minDays ? *minDays : 0) + 1;
+  long long dataOffset = (maxData ? *maxData : 0) - (minData ? *minData : 0) + 1;
+  long long extendedOffset = (maxExtended ? *maxExtended : 0) - (minExtended ? *minExtended : 0) + 1;
+
   begin(dest);
 
   //------------------------------------------------------------
@@ -479,48 +540,104 @@ void SqliteMerge::mergeDatabases(sqlite3 *dest, const openstudio::path &source)
    *  4. Report Meter Extended Data: modify, has summary stats
    */
 
-  tableReportVariableData(dest);
-  tableReportVariableExtendedData(dest);
-  tableTime(dest);
+  tableReportVariableData(dest, dataOffset, timeOffset);
+  tableReportVariableExtendedData(dest, extendedOffset, dataOffset);
+  tableTime(dest, timeOffset, daysOffset);
   //------------------------------------------------------------
 
   commit(dest);
   detachDatabases(dest);
 }
 
-void SqliteMerge::tableReportVariableData(sqlite3 *db)
+// Rows are copied in index order so that the remapped keys are always appended to the end of the table
+void SqliteMerge::tableReportVariableData(sqlite3 *db, long long t_reportDataOffset, long long t_timeOffset)
 {
-  std::string cmd = "insert into reportData "
-    "select (ReportDataIndex+(select Max(ReportDataIndex)from reportData)-(select Min(ReportDataIndex) from merger.reportData)+1) as ReportDataIndex, "
-    "(TimeIndex+(select Max(TimeIndex)from time)-(select Min(TimeIndex) from merger.Time)+1) as TimeIndex, "
-    "ReportDataDictionaryIndex, Value "
-    "from merger.reportData ";
+  std::stringstream cmd;
+  cmd << "insert into main.reportData "
+    << "select ReportDataIndex+(" << t_reportDataOffset << ") as ReportDataIndex, "
+    << "TimeIndex+(" << t_timeOffset << ") as TimeIndex, "
+    << "ReportDataDictionaryIndex, Value "
+    << "from merger.reportData order by ReportDataIndex";
+
+  executeCommand(db, cmd.str());
+}
 
-  executeCommand(db, cmd);
+void SqliteMerge::tableReportVariableExtendedData(sqlite3 *db, long long t_extendedDataOffset, long long t_reportDataOffset)
+{
+  std::stringstream cmd;
+  cmd << "insert into main.reportExtendedData "
+    << "select ReportExtendedDataIndex+(" << t_extendedDataOffset << ") as ReportExtendedDataIndex, "
+    << "ReportDataIndex+(" << t_reportDataOffset << ") as ReportDataIndex, "
+    << "MaxValue, MaxMonth, MaxDay, MaxHour, MaxStartMinute, MaxMinute, MinValue, MinMonth, MinDay, MinHour, "
+    << "MinStartMinute, MinMinute "
+    << "from merger.ReportExtendedData order by ReportExtendedDataIndex";
+
+  executeCommand(db, cmd.str());
 }
-//insert into reportVariableData select TimeIndex+(select Max(TimeIndex)from time) as TimeIndex, ReportVariableDataDictionaryIndex, VariableValue, ReportVariableExtendedDataIndex+(select Max(TimeIndex)from time) from reportMeterData2
 
-void SqliteMerge::tableReportVariableExtendedData(sqlite3 *db) 
+void SqliteMerge::tableTime(sqlite3 *db, long long t_timeOffset, long long t_simulationDaysOffset)
 {
-  std::string cmd = "insert into reportExtendedData "
-    "select ReportExtendedDataIndex+(select Max(ReportExtendedDataIndex)from reportExtendedData)-(select Min(ReportExtendedDataIndex) from merger.reportExtendedData)+1 as ReportExtendedDataIndex, "
-    "(ReportDataIndex+(select Max(ReportDataIndex)from reportData)-(select Min(ReportDataIndex) from merger.reportData)+1) as ReportDataIndex, "
-    "MaxValue, MaxMonth, MaxDay, MaxHour, MaxStartMinute, MaxMinute, MinValue, MinMonth, MinDay, MinHour, "
-    "MinStartMinute, MinMinute "
-    "from merger.ReportExtendedData ";
+  std::stringstream cmd;
+  cmd << "insert into main.time "
+    << "select TimeIndex+(" << t_timeOffset << ") as TimeIndex, "
+    << "Month, Day, Hour, Minute, Dst, Interval, IntervalType, "
+    << "SimulationDays+(" << t_simulationDaysOffset << ") as SimulationDays, DayType, EnvironmentPeriodIndex, WarmupFlag "
+    << "from merger.time order by TimeIndex";
+
+  executeCommand(db, cmd.str());
+}
 
-  executeCommand(db, cmd);
+void SqliteMerge::configureBulkLoad(sqlite3 *db)
+{
+  // only used on the scratch copy made by mergeFiles, which is renamed over the first partition once
+  // complete, so there is nothing to protect by syncing or journaling to disk during the copy
+  executeCommand(db, "PRAGMA synchronous = OFF");
+  executeCommand(db, "PRAGMA journal_mode = MEMORY");
+  executeCommand(db, "PRAGMA cache_size = -65536");
 }
 
-void SqliteMerge::tableTime(sqlite3 *db)
+std::vector<std::string> SqliteMerge::dropIndexes(sqlite3 *db)
 {
-  std::string cmd = "insert into time "
-    "select TimeIndex+(select Max(TimeIndex)from time)-(select Min(TimeIndex) from merger.Time)+1 as TimeIndex, "
-    "Month, Day, Hour, Minute, Dst, Interval, IntervalType, "
-    "SimulationDays+(select Max(SimulationDays)from time)-(select Min(SimulationDays) from merger.Time)+1 as SimulationDays, DayType, EnvironmentPeriodIndex, WarmupFlag "
-    "from merger.time ";
+  std::vector<std::string> indexes;
+  std::vector<std::string> names;
 
-  executeCommand(db, cmd);
+  // implicit primary key / unique indexes have no sql and can not be dropped
+  std::string cmd = "select name, sql from main.sqlite_master where type = 'index' and sql is not null "
+    "and lower(tbl_name) in ('time', 'reportdata', 'reportextendeddata')";
+
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(db, cmd.c_str(), -1, &stmt, nullptr) == SQLITE_OK)
+  {
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+      names.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+      indexes.push_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+    }
+  }
+  sqlite3_finalize(stmt);
+
+  for (const auto &name : names)
+  {
+    if (!executeCommand(db, "drop index \"" + name + "\""))
+    {
+      LOG(Warn, "Unable to drop index " << name << " before merging");
+    }
+  }
+
+  return indexes;
+}
+
+void SqliteMerge::createIndexes(sqlite3 *db, const std::vector<std::string> &t_indexes)
+{
+  begin(db);
+  for (const auto &index : t_indexes)
+  {
+    if (!executeCommand(db, index))
+    {
+      LOG(Error, "Unable to rebuild index after merging: " << index);
+    }
+  }
+  commit(db);
 }
 
 void SqliteMerge::printMeterData(sqlite3 * dest)
@@ -568,6 +685,22 @@ void SqliteMerge::detachDatabases(sqlite3 *destination)
   executeCommand(destination, "detach database merger");
 }
 
+boost::optional<long long> SqliteMerge::queryInteger(sqlite3 *db, const std::string &cmd)
+{
+  boost::optional<long long> result;
+
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(db, cmd.c_str(), -1, &stmt, nullptr) == SQLITE_OK
+      && sqlite3_step(stmt) == SQLITE_ROW
+      && sqlite3_column_type(stmt, 0) != SQLITE_NULL)
+  {
+    result = sqlite3_column_int64(stmt, 0);
+  }
+  sqlite3_finalize(stmt);
+
+  return result;
+}
+
 bool SqliteMerge::executeCommand(sqlite3 *destination, const std::string &cmd)
 {
   char *zErrMsg = nullptr;
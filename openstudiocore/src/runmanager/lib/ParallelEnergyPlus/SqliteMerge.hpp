@@ -30,13 +30,20 @@
 #define RUNMANAGER_LIB_PARALLELENERGYPLUS_SQLITEMERGE_HPP
 
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 #include "../../../utilities/core/Path.hpp"
+#include "../../../utilities/core/Logger.hpp"
+#include "../RunManagerAPI.hpp"
+
+#include <boost/optional.hpp>
 
 #include "sqlite3.h"
 
 
-class SqliteMerge {
+/// Merges the sql output of ParallelEnergyPlus partitions into the first loaded file
+class RUNMANAGER_API SqliteMerge {
 
   public:
     SqliteMerge();
@@ -45,9 +52,17 @@ class SqliteMerge {
     void mergeFiles();
     void loadFile(const openstudio::path &);
 
+    /// Wall clock seconds spent in each phase of the last mergeFiles call, in the order they ran
+    const std::vector<std::pair<std::string, double> > &phaseTimes() const;
+
   private:
+    REGISTER_LOGGER("openstudio.runmanager.SqliteMerge");
+
     void renameFinalDatabase(const openstudio::path &);
+    void recordPhase(const std::string &t_phase, double t_seconds);
+
     std::vector<openstudio::path> m_files;
+    std::vector<std::pair<std::string, double> > m_phaseTimes;
 
     openstudio::path m_working;
     std::string m_final;
@@ -59,15 +74,21 @@ class SqliteMerge {
     static void attachDatabases(sqlite3 *, const openstudio::path &source);
     static void detachDatabases(sqlite3 *);
     static bool executeCommand(sqlite3 *, const std::string &);
+    static boost::optional<long long> queryInteger(sqlite3 *, const std::string &);
+
+    // bulk load helpers, indexes on the appended tables are dropped for the copy and rebuilt once at the end
+    static void configureBulkLoad(sqlite3 *);
+    static std::vector<std::string> dropIndexes(sqlite3 *);
+    static void createIndexes(sqlite3 *, const std::vector<std::string> &t_indexes);
 
     static bool commit(sqlite3 *);
     static bool begin(sqlite3 *);
 
     // Here are the table updates...
     static void dropTabularData(sqlite3 *);
-    static void tableTime(sqlite3 *);
-    static void tableReportVariableData(sqlite3 *); 
-    static void tableReportVariableExtendedData(sqlite3 *);
+    static void tableTime(sqlite3 *, long long t_timeOffset, long long t_simulationDaysOffset);
+    static void tableReportVariableData(sqlite3 *, long long t_reportDataOffset, long long t_timeOffset);
+    static void tableReportVariableExtendedData(sqlite3 *, long long t_extendedDataOffset, long long t_reportDataOffset);
 
     static void summary(sqlite3 *);
     static void printNumberRows(sqlite3 *, const std::string &);
@@ -394,6 +394,22 @@ boost::gregorian::date SqliteObject::getStartDay()
 }
 
 
+int SqliteObject::getNumberOfDays()
+{
+  std::stringstream cmd;
+  cmd << "select count(distinct month * 100 + day) from time where daytype is null or (daytype != 'WinterDesignDay' ";
+  cmd << "and daytype != 'SummerDesignDay' and daytype != 'customday1' and daytype != 'customday2')";
+  execute(cmd.str());
+
+  if (m_results->data.size() != 1 || m_results->data[0].empty())
+  {
+    return 0;
+  }
+
+  return atoi(m_results->data[0][0].c_str());
+}
+
+
 bool SqliteObject::deleteDay(const boost::gregorian::date &d) 
 {
 
@@ -73,6 +73,7 @@ class SqliteObject {
     void extract_by_variable();
     void extract_total();
     boost::gregorian::date getStartDay();
+    int getNumberOfDays();  // run period days, not counting design days
 
 
   private:
@@ -48,9 +48,13 @@
 
 #include <sqlite/sqlite3.h>
 
+#include "ParallelEnergyPlus/ParallelEnergyPlus.hpp"
 #include "ParallelEnergyPlus/SqliteMerge.hpp"
 #include "ParallelEnergyPlus/SqliteObject.hpp"
 
+#include <boost/regex.hpp>
+#include <fstream>
+
 #include <QDir>
 #include <QDateTime>
 
@@ -142,7 +146,18 @@ namespace detail {
 
       openstudio::path outFile = outpath / toPath("eplusout.sql");
 
-
+      // time each partition before its lead in days are removed, the runs are the best estimate there is of what
+      // EnergyPlus costs for this model
+      std::vector<std::pair<int, double> > partitionRuns;
+      for (const auto & eplussqlfile : eplussqlfiles)
+      {
+        boost::optional<double> seconds = elapsedSeconds(eplussqlfile.fullPath.parent_path() / toPath("eplusout.err"));
+        if (seconds)
+        {
+          SqliteObject sql(eplussqlfile.fullPath);
+          partitionRuns.push_back(std::make_pair(sql.getNumberOfDays(), *seconds));
+        }
+      }
 
       // clean up generated sql files, removing duplicated data
       for (size_t i = 1; i < eplussqlfiles.size(); ++i)
@@ -182,6 +197,12 @@ namespace detail {
 
       merge.mergeFiles();
 
+      if (partitionRuns.size() == eplussqlfiles.size())
+      {
+        SqliteObject merged(outFile);
+        reportSpeedup(partitionRuns, merged.getNumberOfDays(), errors);
+      }
+
       // emit the file changed
       emitOutputFileChanged(RunManager_Util::dirFile(outFile));
     } catch (const std::exception &e) {
@@ -192,6 +213,79 @@ namespace detail {
     setErrors(errors);
   }
 
+  boost::optional<double> ParallelEnergyPlusJoinJob::elapsedSeconds(const openstudio::path &t_errFile)
+  {
+    std::ifstream ifs(openstudio::toString(t_errFile).c_str());
+    if (!ifs.good())
+    {
+      return boost::none;
+    }
+
+    // EnergyPlus Completed Successfully-- 3 Warning; 0 Severe Errors; Elapsed Time=00hr 00min  2.73sec
+    static const boost::regex elapsed("Elapsed Time=\\s*(\\d+)hr\\s*(\\d+)min\\s*([\\d.]+)sec");
+
+    boost::optional<double> seconds;
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+      boost::smatch matches;
+      if (boost::regex_search(line, matches, elapsed))
+      {
+        seconds = boost::lexical_cast<double>(matches[1].str()) * 3600
+          + boost::lexical_cast<double>(matches[2].str()) * 60
+          + boost::lexical_cast<double>(matches[3].str());
+      }
+    }
+
+    return seconds;
+  }
+
+  void ParallelEnergyPlusJoinJob::reportSpeedup(const std::vector<std::pair<int, double> > &t_partitionRuns, int t_totalDays,
+      JobErrors &t_errors) const
+  {
+    double wallTime = 0;
+    for (const auto & run : t_partitionRuns)
+    {
+      LOG(Debug, "Partition simulated " << run.first << " days in " << run.second << "s");
+      wallTime = std::max(wallTime, run.second);
+    }
+
+    std::stringstream ss;
+
+    if (params().has("predictedspeedup"))
+    {
+      ss << "Predicted speedup " << params().get("predictedspeedup").children.at(0).value << ". ";
+    }
+
+    int simulatedDays = 0;
+    double simulatedTime = 0;
+    for (const auto & run : t_partitionRuns)
+    {
+      simulatedDays += run.first;
+      simulatedTime += run.second;
+    }
+
+    boost::optional<ParallelEnergyPlus::Costs> costs = ParallelEnergyPlus::fitCosts(t_partitionRuns);
+    if (costs && wallTime > 0)
+    {
+      double serialTime = costs->warmupSeconds + t_totalDays * costs->secondsPerDay;
+      ss << "Achieved speedup " << serialTime / wallTime << " over an estimated " << serialTime
+        << "s single run. Measured warm-up " << costs->warmupSeconds << "s, " << costs->secondsPerDay << "s per day.";
+    } else if (simulatedDays > 0 && wallTime > 0) {
+      // partitions are too close in length to separate warm-up from per day cost, the mean cost per
+      // simulated day includes each partition's warm-up and so overstates the single run time
+      double secondsPerDay = simulatedTime / simulatedDays;
+      double serialTime = t_totalDays * secondsPerDay;
+      ss << "Achieved speedup at most " << serialTime / wallTime << " over an estimated " << serialTime
+        << "s single run, from a mean " << secondsPerDay << "s per simulated day including warm-up.";
+    } else {
+      ss << "Partition run times are not available to estimate the achieved speedup.";
+    }
+
+    LOG(Info, ss.str());
+    t_errors.addError(ErrorType::Info, ss.str());
+  }
+
   std::string ParallelEnergyPlusJoinJob::getOutput() const
   {
     return "";
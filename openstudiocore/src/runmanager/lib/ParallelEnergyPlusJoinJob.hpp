@@ -81,6 +81,12 @@ namespace detail {
 
       FileInfo inputFile() const;
 
+      /// Reads the elapsed time EnergyPlus reported at the end of its err file
+      static boost::optional<double> elapsedSeconds(const openstudio::path &t_errFile);
+
+      /// Reports the predicted and measured speedup, and the run costs fit to the partition run times
+      void reportSpeedup(const std::vector<std::pair<int, double> > &t_partitionRuns, int t_totalDays, JobErrors &t_errors) const;
+
       mutable QReadWriteLock m_mutex;
 
       int m_numSplits; //< Number of splits to expect to join
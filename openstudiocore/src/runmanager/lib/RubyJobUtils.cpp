@@ -42,6 +42,7 @@
 
 #include <boost/filesystem.hpp>
 #include <QDir>
+#include <algorithm>
 
 namespace openstudio {
 namespace runmanager {
@@ -471,6 +472,14 @@ void RubyJobBuilder::addScriptArgument(const std::string &name)
   m_params.push_back(name);
 }
 
+void RubyJobBuilder::setSaveIntermediateModel()
+{
+  if (std::find(m_params.begin(), m_params.end(), "--saveIntermediateModel") == m_params.end())
+  {
+    addScriptParameter("saveIntermediateModel");
+  }
+}
+
 void RubyJobBuilder::clearIncludeDir() {
   auto it = m_toolparams.begin();
   while (it != m_toolparams.end()) {
@@ -177,6 +177,13 @@ namespace runmanager {
       /// Adds an argument with no "--" prefix to the ruby script that is executed
       void addScriptArgument(const std::string &name);
 
+      /// Asks the UserScriptAdapter to write out the model produced by this user script even when
+      /// the job is merged with the following user script jobs. Merged jobs otherwise pass the
+      /// in-memory model along and only save the model produced by the last script.
+      ///
+      /// \sa JobFactory::optimizeJobTree
+      void setSaveIntermediateModel();
+
       /// Clears any -I parameters currently set to be sent to the ruby script interpreter
       void clearIncludeDir();
 
@@ -0,0 +1,338 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+
+#include "RubyWorkerPool.hpp"
+
+#include "../../utilities/core/ApplicationPathHelpers.hpp"
+#include "../../utilities/core/String.hpp"
+#include "../../utilities/core/UUID.hpp"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutexLocker>
+#include <QProcess>
+#include <QStringList>
+#include <QThread>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+#ifndef Q_OS_WIN
+#include <signal.h>
+#endif
+
+namespace openstudio {
+namespace runmanager {
+
+  RubyWorkerPool &RubyWorkerPool::instance()
+  {
+    static RubyWorkerPool pool;
+    return pool;
+  }
+
+  RubyWorkerPool::RubyWorkerPool()
+    : m_starting(0), m_maxWorkers(0), m_maxJobsPerWorker(50)
+  {
+    const char *workers = std::getenv("OPENSTUDIO_RUBY_WORKERS");
+    if (workers)
+    {
+      m_maxWorkers = std::max(0, std::atoi(workers));
+    }
+  }
+
+  RubyWorkerPool::~RubyWorkerPool()
+  {
+    for (const auto &worker : m_workers)
+    {
+      stopWorker(worker);
+    }
+  }
+
+  void RubyWorkerPool::setMaxWorkers(int t_maxWorkers)
+  {
+    {
+      QMutexLocker l(&m_mutex);
+      m_maxWorkers = std::max(0, t_maxWorkers);
+    }
+
+    if (t_maxWorkers <= 0)
+    {
+      shutdown();
+    }
+  }
+
+  int RubyWorkerPool::maxWorkers() const
+  {
+    QMutexLocker l(&m_mutex);
+    return m_maxWorkers;
+  }
+
+  void RubyWorkerPool::setMaxJobsPerWorker(int t_maxJobs)
+  {
+    QMutexLocker l(&m_mutex);
+    m_maxJobsPerWorker = std::max(0, t_maxJobs);
+  }
+
+  int RubyWorkerPool::maxJobsPerWorker() const
+  {
+    QMutexLocker l(&m_mutex);
+    return m_maxJobsPerWorker;
+  }
+
+  bool RubyWorkerPool::canRun(const ToolInfo &t_tool, const std::vector<std::string> &t_parameters) const
+  {
+#ifdef Q_OS_WIN
+    return false;
+#else
+    if (maxWorkers() == 0 || t_tool.name != "ruby")
+    {
+      return false;
+    }
+
+    // interpreter options, only load path additions can be applied inside of a worker
+    auto itr = t_parameters.begin();
+    while (itr != t_parameters.end() && !itr->empty() && (*itr)[0] == '-')
+    {
+      if (*itr == "-I")
+      {
+        ++itr;
+        if (itr == t_parameters.end())
+        {
+          return false;
+        }
+      } else if (itr->compare(0, 2, "-I") != 0) {
+        return false;
+      }
+      ++itr;
+    }
+
+    // there must be a script to run
+    return itr != t_parameters.end() && !itr->empty();
+#endif
+  }
+
+  boost::optional<int> RubyWorkerPool::acquire(const ToolInfo &t_tool, std::string &t_token)
+  {
+    QMutexLocker l(&m_mutex);
+
+    while (m_maxWorkers > 0)
+    {
+      // prefer an idle worker for this interpreter
+      for (auto itr = m_workers.begin(); itr != m_workers.end(); )
+      {
+        if (!itr->busy && itr->ruby == t_tool.localBinPath)
+        {
+          if (!workerAlive(*itr))
+          {
+            // exited on its own, e.g. after growing past the memory limit
+            itr = m_workers.erase(itr);
+            continue;
+          }
+          itr->busy = true;
+          t_token = itr->token;
+          return itr->port;
+        }
+        ++itr;
+      }
+
+      // make room by stopping an idle worker for a different interpreter
+      if (static_cast<int>(m_workers.size()) + m_starting >= m_maxWorkers)
+      {
+        auto idle = std::find_if(m_workers.begin(), m_workers.end(), [](const Worker &t_worker) { return !t_worker.busy; });
+        if (idle != m_workers.end())
+        {
+          stopWorker(*idle);
+          m_workers.erase(idle);
+        }
+      }
+
+      if (static_cast<int>(m_workers.size()) + m_starting < m_maxWorkers)
+      {
+        ++m_starting;
+        int maxJobs = m_maxJobsPerWorker;
+        l.unlock();
+        boost::optional<Worker> worker = startWorker(t_tool.localBinPath, maxJobs);
+        l.relock();
+        --m_starting;
+
+        if (!worker)
+        {
+          m_available.wakeAll();
+          return boost::none;
+        }
+
+        worker->busy = true;
+        m_workers.push_back(*worker);
+        t_token = worker->token;
+        return worker->port;
+      }
+
+      m_available.wait(&m_mutex);
+    }
+
+    return boost::none;
+  }
+
+  void RubyWorkerPool::release(int t_port, bool t_ok)
+  {
+    QMutexLocker l(&m_mutex);
+
+    auto itr = std::find_if(m_workers.begin(), m_workers.end(), [t_port](const Worker &t_worker) { return t_worker.port == t_port; });
+    if (itr != m_workers.end())
+    {
+      ++itr->jobs;
+      itr->busy = false;
+
+      if (!t_ok || m_maxWorkers == 0)
+      {
+        stopWorker(*itr);
+        m_workers.erase(itr);
+      } else if (m_maxJobsPerWorker > 0 && itr->jobs >= m_maxJobsPerWorker) {
+        // the worker exits by itself after its last job
+        LOG(Debug, "Retiring ruby worker " << itr->pid << " after " << itr->jobs << " jobs");
+        m_workers.erase(itr);
+      }
+    }
+
+    m_available.wakeAll();
+  }
+
+  void RubyWorkerPool::shutdown()
+  {
+    QMutexLocker l(&m_mutex);
+
+    for (auto itr = m_workers.begin(); itr != m_workers.end(); )
+    {
+      if (!itr->busy)
+      {
+        stopWorker(*itr);
+        itr = m_workers.erase(itr);
+      } else {
+        ++itr;
+      }
+    }
+
+    m_available.wakeAll();
+  }
+
+  boost::optional<RubyWorkerPool::Worker> RubyWorkerPool::startWorker(const openstudio::path &t_ruby, int t_maxJobs) const
+  {
+    openstudio::path script = getOpenStudioRubyScriptsPath() / openstudio::toPath("openstudio/runmanager/rubyscripts/MeasureWorker.rb");
+    openstudio::path portFile = openstudio::tempDir() / openstudio::toPath("RubyWorker-" + removeBraces(createUUID()) + ".port");
+
+    if (!boost::filesystem::exists(script))
+    {
+      LOG(Warn, "Unable to find ruby worker script: " << openstudio::toString(script));
+      return boost::none;
+    }
+
+    QStringList args;
+    args << "-I" << openstudio::toQString(getOpenStudioRubyIncludePath());
+    args << openstudio::toQString(script);
+    args << "--portFile=" + openstudio::toQString(portFile);
+    args << QString("--maxJobs=%1").arg(t_maxJobs);
+    // the worker is detached, so it has to find out by itself when this process goes away
+    args << QString("--parentPid=%1").arg(QCoreApplication::applicationPid());
+
+    Worker worker;
+    worker.ruby = t_ruby;
+    worker.pid = 0;
+    worker.port = 0;
+    worker.jobs = 0;
+    worker.busy = false;
+
+    LOG(Info, "Starting ruby worker: " << openstudio::toString(t_ruby) << " " << openstudio::toString(script));
+
+    if (!QProcess::startDetached(openstudio::toQString(t_ruby), args, openstudio::toQString(openstudio::tempDir()), &worker.pid))
+    {
+      LOG(Warn, "Unable to start ruby worker: " << openstudio::toString(t_ruby));
+      return boost::none;
+    }
+
+    // loading the bindings takes a few seconds
+    QElapsedTimer timer;
+    timer.start();
+    while (timer.elapsed() < 60000 && workerAlive(worker))
+    {
+      // the worker writes the port and its token to the file, readable only by this user, then
+      // renames it into place
+      QFile file(openstudio::toQString(portFile));
+      if (file.open(QIODevice::ReadOnly))
+      {
+        QStringList lines = QString(file.readAll()).split('\n', QString::SkipEmptyParts);
+        file.close();
+        file.remove();
+
+        bool ok = false;
+        if (lines.size() == 2)
+        {
+          worker.port = lines[0].trimmed().toInt(&ok);
+          worker.token = toString(lines[1].trimmed());
+        }
+
+        if (ok && worker.port > 0 && !worker.token.empty())
+        {
+          LOG(Info, "Ruby worker " << worker.pid << " listening on port " << worker.port);
+          return worker;
+        }
+        break;
+      }
+
+      QThread::msleep(50);
+    }
+
+    LOG(Warn, "Ruby worker " << worker.pid << " did not start, running ruby jobs in separate processes");
+    stopWorker(worker);
+    return boost::none;
+  }
+
+  void RubyWorkerPool::stopWorker(const Worker &t_worker)
+  {
+#ifndef Q_OS_WIN
+    if (t_worker.pid > 0)
+    {
+      ::kill(static_cast<pid_t>(t_worker.pid), SIGTERM);
+    }
+#endif
+  }
+
+  bool RubyWorkerPool::workerAlive(const Worker &t_worker)
+  {
+#ifndef Q_OS_WIN
+    return t_worker.pid > 0 && ::kill(static_cast<pid_t>(t_worker.pid), 0) == 0;
+#else
+    return false;
+#endif
+  }
+
+}
+}
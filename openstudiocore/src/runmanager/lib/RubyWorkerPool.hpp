@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+
+#ifndef RUNMANAGER_LIB_RUBYWORKERPOOL_HPP
+#define RUNMANAGER_LIB_RUBYWORKERPOOL_HPP
+
+#include "RunManagerAPI.hpp"
+#include "ToolInfo.hpp"
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/Path.hpp"
+
+#include <boost/optional.hpp>
+
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace runmanager {
+
+  /// Pool of long lived ruby processes used by LocalProcess to run ruby tool invocations.
+  ///
+  /// Each worker runs rubyscripts/MeasureWorker.rb, which loads the OpenStudio bindings once and then
+  /// forks a child for every job it is handed over a local socket. The child changes into the job's
+  /// output directory and runs the script with the job's arguments, so outputs and logs are the same as
+  /// with a separate ruby process, without paying for interpreter start up and `require 'openstudio'`
+  /// per job. Jobs never run in the worker process itself, so its memory does not grow with the jobs
+  /// it has run, and a worker exits by itself once the process that started it is gone.
+  ///
+  /// The pool is disabled until setMaxWorkers is given a positive count, or the OPENSTUDIO_RUBY_WORKERS
+  /// environment variable is set to one. It relies on fork and is not available on Windows.
+  class RUNMANAGER_API RubyWorkerPool
+  {
+    public:
+      static RubyWorkerPool &instance();
+
+      ~RubyWorkerPool();
+
+      /// Sets the maximum number of workers, 0 disables the pool and stops idle workers
+      void setMaxWorkers(int t_maxWorkers);
+      int maxWorkers() const;
+
+      /// Workers are replaced after running this many jobs, 0 for no limit
+      void setMaxJobsPerWorker(int t_maxJobs);
+      int maxJobsPerWorker() const;
+
+      /// \returns true if executing t_tool with t_parameters can be handed to a worker. Only ruby
+      ///          invocations whose interpreter options are all -I are accepted.
+      bool canRun(const ToolInfo &t_tool, const std::vector<std::string> &t_parameters) const;
+
+      /// Checks out an idle worker for t_tool, starting one if the pool is not full and waiting for one
+      /// to be released otherwise. t_token is set to the secret the worker expects as the first line
+      /// sent on each connection, it rejects connections that do not send it.
+      /// \returns the local port the worker listens on, or none if no worker could be started
+      boost::optional<int> acquire(const ToolInfo &t_tool, std::string &t_token);
+
+      /// Returns the worker listening on t_port to the pool. Workers that failed, or that have run
+      /// their maximum number of jobs, are shut down.
+      void release(int t_port, bool t_ok);
+
+      /// Stops all idle workers, busy workers are stopped when they are released
+      void shutdown();
+
+    private:
+      REGISTER_LOGGER("openstudio.runmanager.RubyWorkerPool");
+
+      struct Worker
+      {
+        openstudio::path ruby;
+        qint64 pid;
+        int port;
+        std::string token;
+        int jobs;
+        bool busy;
+      };
+
+      RubyWorkerPool();
+
+      // explicitly unimplemented
+      RubyWorkerPool(const RubyWorkerPool &);
+      RubyWorkerPool &operator=(const RubyWorkerPool &);
+
+      /// Launches MeasureWorker.rb and waits for it to report its port and token, called without the lock held
+      boost::optional<Worker> startWorker(const openstudio::path &t_ruby, int t_maxJobs) const;
+
+      static void stopWorker(const Worker &t_worker);
+
+      static bool workerAlive(const Worker &t_worker);
+
+      mutable QMutex m_mutex;
+      QWaitCondition m_available;
+      std::vector<Worker> m_workers;
+      int m_starting;
+      int m_maxWorkers;
+      int m_maxJobsPerWorker;
+  };
+
+}
+}
+
+#endif // RUNMANAGER_LIB_RUBYWORKERPOOL_HPP
@@ -30,7 +30,13 @@
 #include "Job.hpp"
 #include "Workflow.hpp"
 #include "WorkItem.hpp"
+#include "../../model/RunPeriod.hpp"
+#include "../../model/RunPeriod_Impl.hpp"
+#include "../../isomodel/ForwardTranslator.hpp"
 #include <boost/filesystem.hpp>
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
 #include <QCryptographicHash>
 #include "../../utilities/core/ApplicationPathHelpers.hpp"
 
@@ -38,7 +44,7 @@ namespace openstudio {
   namespace runmanager {
 
     SimulationEngine::SimulationEngine(const openstudio::path &t_cacheFolder, size_t t_numVariables)
-      : m_numVariables(t_numVariables), m_folder(validateFolder(t_cacheFolder)), 
+      : m_numVariables(t_numVariables), m_shortRunPeriodDays(28), m_folder(validateFolder(t_cacheFolder)), 
         m_runManager(m_folder / openstudio::toPath("run.db"), false, true)
     {
       LOG(Info, "Starting SimulationEngine: " << openstudio::toString(t_cacheFolder));
@@ -79,6 +85,60 @@ namespace openstudio {
       m_runManager.setPaused(false);
     }
 
+    void SimulationEngine::setShortRunPeriodDays(int t_days)
+    {
+      if (t_days < 0)
+      {
+        throw std::range_error("shortened run period days cannot be negative");
+      }
+
+      m_shortRunPeriodDays = t_days;
+    }
+
+    int SimulationEngine::shortRunPeriodDays() const
+    {
+      return m_shortRunPeriodDays;
+    }
+
+    double SimulationEngine::shortenRunPeriod(openstudio::model::RunPeriod &t_runPeriod, int t_days)
+    {
+      if (t_days <= 0)
+      {
+        throw std::range_error("shortened run period days must be positive");
+      }
+
+      // EnergyPlus simulates 365 day years unless told otherwise, count days in a non leap year
+      const int year = 2009;
+      boost::gregorian::date begin(year, t_runPeriod.getBeginMonth(), 1);
+      begin += boost::gregorian::days(std::min(t_runPeriod.getBeginDayOfMonth(), static_cast<int>(begin.end_of_month().day())) - 1);
+      if (t_runPeriod.getBeginMonth() == 2 && t_runPeriod.getBeginDayOfMonth() == 29)
+      {
+        // February 29th does not exist, the period starts with the next day that does
+        begin += boost::gregorian::days(1);
+      }
+
+      boost::gregorian::date end(year, t_runPeriod.getEndMonth(), 1);
+      end += boost::gregorian::days(std::min(t_runPeriod.getEndDayOfMonth(), static_cast<int>(end.end_of_month().day())) - 1);
+      if (end < begin)
+      {
+        // wraps around the end of the year
+        end = boost::gregorian::date(year + 1, end.month(), end.day());
+      }
+
+      int totalDays = (end - begin).days() + 1;
+
+      if (totalDays <= t_days)
+      {
+        throw std::runtime_error("run period is already no longer than the shortened run period");
+      }
+
+      boost::gregorian::date shortEnd = begin + boost::gregorian::days(t_days - 1);
+      t_runPeriod.setEndMonth(shortEnd.month());
+      t_runPeriod.setEndDayOfMonth(shortEnd.day());
+
+      return static_cast<double>(totalDays) / t_days;
+    }
+
     openstudio::path SimulationEngine::validateFolder(const openstudio::path &t_folder)
     {
       if (boost::filesystem::exists(t_folder))
@@ -148,6 +208,22 @@ namespace openstudio {
         m_simulationIds[t_simulationId] = std::make_pair(t_variables, t_discreteVariables);
       }
 
+      // The monthly ISO model is cheap enough to run in process, so an estimate is available before
+      // any EnergyPlus job has started
+      runISOModel(t_model, t_variables, t_discreteVariables, t_weatherFile);
+
+      // Shortened run period, queued first so it finishes well ahead of the annual runs
+      boost::optional<openstudio::runmanager::Job> shortRun;
+      if (m_shortRunPeriodDays > 0)
+      {
+        try {
+          shortRun = createShortRunPeriodJob(basePath, t_model, t_variables, t_discreteVariables, t_simulationId, t_weatherFile);
+          connectSignals(*shortRun);
+        } catch (const std::exception &e) {
+          LOG(Info, "Not running shortened run period simulation: " << e.what());
+        }
+      }
+
       // estimation
       openstudio::runmanager::Job estimation = createEstimationJob(basePath, t_model, t_variables, t_discreteVariables, t_simulationId, t_weatherFile);
       connectSignals(estimation);
@@ -160,6 +236,10 @@ namespace openstudio {
       openstudio::runmanager::Job radianceRun = createRadianceJob(basePath, t_model, t_variables, t_discreteVariables, t_simulationId, t_weatherFile);
       connectSignals(radianceRun);
 
+      if (shortRun)
+      {
+        m_runManager.enqueue(*shortRun, true);
+      }
       m_runManager.enqueue(estimation, true);
       m_runManager.enqueue(fullrun, true);
       m_runManager.enqueue(radianceRun, true);
@@ -207,20 +287,80 @@ namespace openstudio {
         }
       } catch (...) { /* no simulation id */ }
 
+      // shortened run periods are scaled up to the length of the run period they stand in for
+      double scale = 1.0;
+      JobParams params = t_job.jobParams();
+      if (params.has("simulationEngineRunPeriodScale"))
+      {
+        scale = boost::lexical_cast<double>(params.get("simulationEngineRunPeriodScale").children.at(0).value);
+      }
+
       openstudio::path sqlfilePath = getSqlFilePath(t_job);
       SqlFile sql(sqlfilePath); 
 
 
-      getErrorEstimation(discreteVariables).add(sql, runtype, variables); 
+      getErrorEstimation(discreteVariables).add(sql, runtype, variables, scale); 
 
       double confidence = getErrorEstimation(discreteVariables).getConfidence(runtype);
 
+      updateDetails(variables, discreteVariables, SimulationDetails(confidence, sqlfilePath, runtype));
+    }
+
+    void SimulationEngine::updateDetails(const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables,
+        const SimulationDetails &t_details)
+    {
+      SimulationDetails &details = m_details[std::make_pair(t_variables, t_discreteVariables)];
 
-      if (m_details[std::make_pair(variables, discreteVariables)].confidence < confidence)
+      if (details.confidence < t_details.confidence)
       {
-        m_details[std::make_pair(variables, discreteVariables)] = SimulationDetails(confidence, sqlfilePath);
+        details = t_details;
       }
 
+      emit fuelUsesChanged(t_variables, t_discreteVariables, t_details.runType, t_details.confidence);
+    }
+
+    void SimulationEngine::runISOModel(const openstudio::model::Model &t_model, const std::vector<double> &t_variables,
+        const std::vector<int> &t_discreteVariables, const openstudio::path &t_weatherFile)
+    {
+      if (t_weatherFile.empty())
+      {
+        LOG(Info, "No weather file given, not running ISO model");
+        return;
+      }
+
+      try {
+        openstudio::isomodel::ForwardTranslator translator;
+        openstudio::isomodel::UserModel userModel = translator.translateModel(t_model);
+        userModel.setWeatherFilePath(t_weatherFile);
+
+        // every variant shares the climate, only read the weather file once
+        auto itr = m_isoWeather.find(t_weatherFile);
+        if (itr == m_isoWeather.end())
+        {
+          itr = m_isoWeather.insert(std::make_pair(t_weatherFile, userModel.loadWeather())).first;
+        }
+        userModel.setWeatherData(itr->second);
+
+        openstudio::isomodel::ISOResults results = userModel.toSimModel().simulate();
+
+        getErrorEstimation(t_discreteVariables).add(userModel, results, isoModelString(), t_variables);
+
+        double confidence = getErrorEstimation(t_discreteVariables).getConfidence(isoModelString());
+
+        updateDetails(t_variables, t_discreteVariables, SimulationDetails(confidence, openstudio::path(), isoModelString()));
+      } catch (const std::exception &e) {
+        LOG(Warn, "Unable to run ISO model: " << e.what());
+      }
+    }
+
+    openstudio::runmanager::Job SimulationEngine::createShortRunPeriodJob(const openstudio::path &t_path, const openstudio::model::Model &t_model,
+        const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables, 
+        const std::string &t_simulationId,
+        const openstudio::path &t_weatherFile)
+    {
+      return createJob(t_path / openstudio::toPath(shortRunPeriodJobString()), t_model,
+          t_variables, t_discreteVariables, t_simulationId, shortRunPeriodJobString(), true, 1,
+          false, t_weatherFile, m_shortRunPeriodDays);
     }
 
     openstudio::runmanager::Job SimulationEngine::createEstimationJob(const openstudio::path &t_path, const openstudio::model::Model &t_model,
@@ -253,6 +393,16 @@ namespace openstudio {
           true, t_weatherFile);
     }
 
+    std::string SimulationEngine::isoModelString()
+    {
+      return "ISOModelSimulation";
+    }
+
+    std::string SimulationEngine::shortRunPeriodJobString()
+    {
+      return "ShortRunPeriodSimulation";
+    }
+
     std::string SimulationEngine::radianceJobString()
     {
       return "RadianceSimulation";
@@ -315,10 +465,24 @@ namespace openstudio {
     openstudio::runmanager::Job SimulationEngine::createJob(const openstudio::path &t_path, openstudio::model::Model t_model,
         const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables, const std::string &t_simulationId,
         const std::string &t_runType,
-        bool t_estimation, int t_numParallel, bool t_radiance, const openstudio::path &t_weatherFile)
+        bool t_estimation, int t_numParallel, bool t_radiance, const openstudio::path &t_weatherFile,
+        int t_runPeriodDays)
     {
       openstudio::runmanager::ConfigOptions co = m_runManager.getConfigOptions();
 
+      if (t_estimation || t_runPeriodDays > 0)
+      {
+        t_model = openstudio::model::Model(t_model.clone());
+      }
+
+      double runPeriodScale = 1.0;
+      if (t_runPeriodDays > 0)
+      {
+        // the results are scaled back up to the full period when they are loaded
+        openstudio::model::RunPeriod runPeriod = t_model.getUniqueModelObject<openstudio::model::RunPeriod>();
+        runPeriodScale = shortenRunPeriod(runPeriod, t_runPeriodDays);
+      }
+
       openstudio::runmanager::Workflow workflow;
 
       workflow.addJob(openstudio::runmanager::JobType::ModelToIdf);
@@ -342,6 +506,10 @@ namespace openstudio {
       params.append("simulationEngineRunType", t_runType);
       params.append("simulationEngineVariables", toString(t_variables));
       params.append("simulationEngineDiscreteVariables", toString(t_discreteVariables));
+      if (runPeriodScale != 1.0)
+      {
+        params.append("simulationEngineRunPeriodScale", boost::lexical_cast<std::string>(runPeriodScale));
+      }
 
       workflow.add(params);
 
@@ -353,11 +521,6 @@ namespace openstudio {
       openstudio::path osmpath = t_path / openstudio::toPath("model.osm");
       LOG(Debug, "Saving OSM to " << openstudio::toString(osmpath));
 
-      if (t_estimation)
-      {
-        t_model = openstudio::model::Model(t_model.clone());
-      }
-
       t_model.save(osmpath, true);
 
       if (t_numParallel > 1)
@@ -408,6 +571,8 @@ namespace openstudio {
         return itr->second;
       } else {
         ErrorEstimation ee(m_numVariables);
+        ee.setConfidence(isoModelString(), .5);
+        ee.setConfidence(shortRunPeriodJobString(), .6);
         ee.setConfidence(estimationJobString(), .75);
         ee.setConfidence(fullJobString(), .90);
         ee.setConfidence(radianceJobString(), 1.0);
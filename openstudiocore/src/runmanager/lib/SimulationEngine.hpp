@@ -32,6 +32,7 @@
 #include "../../utilities/core/Path.hpp"
 #include "../../utilities/core/UUID.hpp"
 #include <vector>
+#include <memory>
 #include "../../model/Model.hpp"
 #include "../../utilities/core/Logger.hpp"
 #include "RunManager.hpp"
@@ -39,16 +40,24 @@
 #include "ErrorEstimation.hpp"
 
 namespace openstudio {
+  namespace model {
+    class RunPeriod;
+  }
+
   namespace runmanager {
     struct RUNMANAGER_API SimulationDetails
     {
-      SimulationDetails(double t_confidence=0, const openstudio::path &t_sqlFilePath=openstudio::path())
-        : confidence(t_confidence), sqlFilePath(t_sqlFilePath)
+      SimulationDetails(double t_confidence=0, const openstudio::path &t_sqlFilePath=openstudio::path(),
+          const std::string &t_runType=std::string())
+        : confidence(t_confidence), sqlFilePath(t_sqlFilePath), runType(t_runType)
       {
       }
 
       double confidence;
       openstudio::path sqlFilePath;
+
+      /// Fidelity level the details came from, ie "ISOModelSimulation" or "FullSimulation"
+      std::string runType;
         
     };
 
@@ -60,8 +69,35 @@ namespace openstudio {
 
       public:
         /// Create a simulation engine which makes available varying levels of accuracy for a simulation
+        ///
+        /// Each new set of variables is run at increasing levels of fidelity. The ISO monthly model is run
+        /// immediately, then a shortened run period, a parallelized annual run, the full annual run and finally
+        /// an annual run with radiance daylighting are queued in that order. Every result is folded into the
+        /// ErrorEstimation for its discrete variables, which calibrates the cheaper levels against the more
+        /// accurate ones, and fuelUsesChanged is emitted as the estimate is refined.
         SimulationEngine(const openstudio::path &t_cacheFolder, size_t t_numVariables);
 
+        /// Sets the number of days simulated by the shortened run period fidelity level, 0 disables it.
+        /// Only affects simulations queued after the call.
+        void setShortRunPeriodDays(int t_days);
+
+        /// \returns the number of days simulated by the shortened run period fidelity level
+        int shortRunPeriodDays() const;
+
+        /// Shortens t_runPeriod to its first t_days days and returns the factor that scales results of
+        /// the shortened period back up to the original one. Run periods that end before they begin
+        /// wrap around the end of the year. Dates are counted in a non leap year, so February 29th
+        /// is treated as the end of February. Throws if the run period is not longer than t_days.
+        static double shortenRunPeriod(openstudio::model::RunPeriod &t_runPeriod, int t_days);
+
+        /// Creates, but does not enqueue, the shortened run period job for the given variables in
+        /// t_path. The job's "simulationEngineRunPeriodScale" parameter holds the factor its results
+        /// are scaled by. Throws if the model's run period cannot be shortened.
+        openstudio::runmanager::Job createShortRunPeriodJob(const openstudio::path &t_path, const openstudio::model::Model &t_model,
+            const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables,
+            const std::string &t_simulationId,
+            const openstudio::path &t_weatherFile);
+
         /// \returns an estimated FuelUses for the given model / variables. If it's not possible to 
         ///          generate an estimate, an FuelUses with 0 confidence is returned
         openstudio::runmanager::FuelUses fuelUses(const openstudio::model::Model &t_model, const std::vector<double> &t_variables, 
@@ -84,6 +120,13 @@ namespace openstudio {
 
         openstudio::runmanager::SimulationDetails details(const std::string &t_stimulationId) const;
 
+      signals:
+        /// Emitted each time a fidelity level finishes for the given set of variables and the available
+        /// estimate has been refined. t_runType and t_confidence are the run type and confidence of the
+        /// level that just finished
+        void fuelUsesChanged(const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables,
+            const std::string &t_runType, double t_confidence);
+
       private slots:
         void jobTreeChanged(const openstudio::UUID &);
 
@@ -91,6 +134,7 @@ namespace openstudio {
         REGISTER_LOGGER("opendtudio.runmanager.SimulationEngine");
 
         size_t m_numVariables;
+        int m_shortRunPeriodDays;
         openstudio::path m_folder;
         std::map<std::vector<int>, ErrorEstimation> m_errorEstimations;
         RunManager m_runManager;
@@ -99,6 +143,9 @@ namespace openstudio {
 
         std::map<std::string, std::pair<std::vector<double>, std::vector<int> > > m_simulationIds;
 
+        // weather data loaded for the ISO fidelity level, by weather file
+        std::map<openstudio::path, std::shared_ptr<openstudio::isomodel::WeatherData> > m_isoWeather;
+
         static openstudio::path validateFolder(const openstudio::path &t_folder);
         void connectSignals(const openstudio::runmanager::Job &t_job);
         void loadResults(const openstudio::runmanager::Job &t_job);
@@ -109,6 +156,12 @@ namespace openstudio {
 
         void validateNumVariables(const std::vector<double> &t_variables) const;
 
+        void updateDetails(const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables,
+            const SimulationDetails &t_details);
+
+        void runISOModel(const openstudio::model::Model &t_model, const std::vector<double> &t_variables,
+            const std::vector<int> &t_discreteVariables, const openstudio::path &t_weatherFile);
+
         openstudio::runmanager::Job createEstimationJob(const openstudio::path &t_path, const openstudio::model::Model &t_model,
             const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables,
             const std::string &t_simulationId,
@@ -128,8 +181,11 @@ namespace openstudio {
             const std::vector<double> &t_variables, const std::vector<int> &t_discreteVariables,
             const std::string &t_simulationId,
             const std::string &t_runType,
-            bool t_estimation, int t_numParallel, bool t_radiance, const openstudio::path &t_weatherFile);
+            bool t_estimation, int t_numParallel, bool t_radiance, const openstudio::path &t_weatherFile,
+            int t_runPeriodDays = 0);
 
+        static std::string isoModelString();
+        static std::string shortRunPeriodJobString();
         static std::string estimationJobString();
         static std::string fullJobString();
         static std::string radianceJobString();
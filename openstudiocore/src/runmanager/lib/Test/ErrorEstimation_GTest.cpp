@@ -53,6 +53,7 @@
 
 #include <QDir>
 #include <QElapsedTimer>
+#include <limits>
 #include <boost/filesystem.hpp>
 
 using openstudio::Attribute;
@@ -225,6 +226,27 @@ TEST_F(RunManagerTestFixture, LinearApproximationTestSimple)
 
 }
 
+TEST_F(RunManagerTestFixture, LinearApproximationTestTwoVariables)
+{
+  // z = 1 + 2x + 3y, no sample shares a variable with the queries so both slopes are needed
+  LinearApproximation la(2);
+
+  std::vector<double> vals(2, 0);
+  la.addVals(vals, 1);
+  vals[0] = 1;
+  la.addVals(vals, 3);
+  vals[0] = 0;
+  vals[1] = 1;
+  la.addVals(vals, 4);
+
+  vals[0] = 0.5;
+  vals[1] = 0.5;
+  EXPECT_DOUBLE_EQ(3.5, la.approximate(vals));
+  vals[0] = 2;
+  vals[1] = 3;
+  EXPECT_DOUBLE_EQ(14.0, la.approximate(vals));
+}
+
 TEST_F(RunManagerTestFixture, LinearApproximationTestHuge)
 {
   const size_t size = 200;
@@ -276,3 +298,100 @@ TEST_F(RunManagerTestFixture, LinearApproximationTestHuge)
 }
 
 
+
+TEST_F(RunManagerTestFixture, LinearApproximationTestSampleCount)
+{
+  const size_t size = 8;
+
+  LinearApproximation la(size);
+  std::vector<std::vector<double> > points;
+
+  std::vector<double> baseline(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    baseline[i] = i;
+  }
+
+  points.push_back(baseline);
+  la.addVals(baseline, 100);
+
+  // up to 40k samples, the scale of a large parametric analysis
+  size_t levelCounts[] = {10, 160, 1250, 5000};
+  size_t levels = 0;
+
+  for (size_t levelCount : levelCounts)
+  {
+    QElapsedTimer et;
+    et.start();
+
+    // parametric style sweep, each new point moves one variable away from the baseline
+    for (; levels < levelCount; ++levels)
+    {
+      for (size_t i = 0; i < size; ++i)
+      {
+        std::vector<double> vals(baseline);
+        vals[i] += static_cast<double>(levels + 1);
+        points.push_back(vals);
+        la.addVals(vals, 100.0 + (i + 1) * (vals[i] - baseline[i]));
+      }
+    }
+
+    // adding a duplicate point does not grow the sample set
+    la.addVals(baseline, 100);
+    EXPECT_EQ(points.size(), la.numSamples());
+
+    qint64 addtime = et.elapsed();
+    et.restart();
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      std::vector<double> query(baseline);
+      query[i] += levelCount / 2.0 + 0.5;
+
+      std::pair<double, double> distances = la.nearestFurthestNeighborDistances(query);
+
+      double nearest = std::numeric_limits<double>::max();
+      double furthest = 0;
+      for (const auto &point : points)
+      {
+        double distance = 0;
+        for (size_t j = 0; j < size; ++j)
+        {
+          distance += (point[j] - query[j]) * (point[j] - query[j]);
+        }
+        distance = sqrt(distance);
+        nearest = std::min(nearest, distance);
+        furthest = std::max(furthest, distance);
+      }
+
+      EXPECT_DOUBLE_EQ(nearest, distances.first);
+      EXPECT_DOUBLE_EQ(furthest, distances.second);
+      EXPECT_NEAR(100.0 + (i + 1) * (query[i] - baseline[i]), la.approximate(query), 1e-6);
+    }
+
+    LOG_FREE(Info, "LinearApproximationTiming", "Samples " << points.size() << " add " << addtime
+        << "ms queries " << et.elapsed() << "ms");
+  }
+}
+
+TEST_F(RunManagerTestFixture, ErrorEstimationSqlFileScale)
+{
+  openstudio::SqlFile sql(resourcesPath() / openstudio::toPath("energyplus/5ZoneAirCooled/eplusout.sql"));
+  std::vector<double> variables(1, 0.0);
+
+  // a lone source is its own baseline, so no error is applied to what is added
+  openstudio::runmanager::ErrorEstimation unscaledEstimation(1);
+  unscaledEstimation.setConfidence("ShortRun", 1.0);
+  openstudio::runmanager::FuelUses unscaled = unscaledEstimation.add(sql, "ShortRun", variables);
+
+  openstudio::runmanager::ErrorEstimation scaledEstimation(1);
+  scaledEstimation.setConfidence("ShortRun", 1.0);
+  openstudio::runmanager::FuelUses scaled = scaledEstimation.add(sql, "ShortRun", variables, 365.0 / 28.0);
+
+  ASSERT_FALSE(unscaled.data().empty());
+  EXPECT_EQ(unscaled.data().size(), scaled.data().size());
+  for (const auto &use : unscaled.data())
+  {
+    EXPECT_DOUBLE_EQ(use.second * 365.0 / 28.0, scaled.fuelUse(use.first));
+  }
+}
@@ -34,6 +34,7 @@
 #include "../JobFactory.hpp"
 #include "../RunManager.hpp"
 #include "../Workflow.hpp"
+#include "../ParallelEnergyPlus/ParallelEnergyPlus.hpp"
 
 #include "../../../model/Model.hpp"
 
@@ -171,3 +172,65 @@ TEST_F(RunManagerTestFixture, ParallelEnergyPlusJobTest)
 }
 
 
+TEST_F(RunManagerTestFixture, ParallelEnergyPlusPlanTest)
+{
+  {
+    // nothing to gain with a single core, the workflow is left alone
+    openstudio::runmanager::Workflow workflow("modeltoidf->expandobjects->energyplus");
+    EXPECT_DOUBLE_EQ(1.0, workflow.parallelizeEnergyPlus(1, 7, 3.0, 0.05));
+    EXPECT_EQ(openstudio::runmanager::JobType(openstudio::runmanager::JobType::EnergyPlus),
+        workflow.create().children().at(0).children().at(0).jobType());
+  }
+
+  {
+    // runperiod too short to give each partition its lead in days
+    openstudio::runmanager::Workflow workflow("modeltoidf->expandobjects->energyplus");
+    EXPECT_DOUBLE_EQ(1.0, workflow.parallelizeEnergyPlus(4, 7, 3.0, 0.05, 14));
+  }
+
+  {
+    openstudio::runmanager::Workflow workflow("modeltoidf->expandobjects->energyplus");
+    double speedup = workflow.parallelizeEnergyPlus(4, 7, 3.0, 0.05);
+    EXPECT_GT(speedup, 2.0);
+    EXPECT_LT(speedup, 4.0);
+
+    openstudio::runmanager::Job split = workflow.create().children().at(0).children().at(0);
+    EXPECT_EQ(openstudio::runmanager::JobType(openstudio::runmanager::JobType::ParallelEnergyPlusSplit), split.jobType());
+    EXPECT_EQ(4u, split.children().size());
+    ASSERT_TRUE(split.finishedJob());
+    EXPECT_TRUE(openstudio::runmanager::JobParam::hasByValue(split.finishedJob()->params(), "predictedspeedup"));
+  }
+
+  {
+    // when warm-up dominates, splitting is not worth it
+    openstudio::runmanager::Workflow workflow("modeltoidf->expandobjects->energyplus");
+    EXPECT_DOUBLE_EQ(1.0, workflow.parallelizeEnergyPlus(4, 7, 100.0, 0.001));
+  }
+}
+
+TEST_F(RunManagerTestFixture, ParallelEnergyPlusFitCostsTest)
+{
+  // a year split four ways with 7 lead in days: lengths differ by the lead in only, and
+  // timing noise of a few percent swamps the small difference in length
+  std::vector<std::pair<int, double> > partitions;
+  partitions.push_back(std::make_pair(92, 3.0 + 92 * 0.05 + 0.4));
+  partitions.push_back(std::make_pair(98, 3.0 + 98 * 0.05 - 0.3));
+  partitions.push_back(std::make_pair(98, 3.0 + 98 * 0.05 + 0.2));
+  partitions.push_back(std::make_pair(98, 3.0 + 98 * 0.05 - 0.1));
+  EXPECT_FALSE(ParallelEnergyPlus::fitCosts(partitions));
+
+  // identical lengths never fit
+  std::vector<std::pair<int, double> > equal(3, std::make_pair(100, 8.0));
+  EXPECT_FALSE(ParallelEnergyPlus::fitCosts(equal));
+
+  // runs of clearly different lengths recover the cost model despite the same noise
+  std::vector<std::pair<int, double> > runs;
+  runs.push_back(std::make_pair(30, 3.0 + 30 * 0.05 + 0.4));
+  runs.push_back(std::make_pair(90, 3.0 + 90 * 0.05 - 0.3));
+  runs.push_back(std::make_pair(180, 3.0 + 180 * 0.05 + 0.2));
+  runs.push_back(std::make_pair(365, 3.0 + 365 * 0.05 - 0.1));
+  boost::optional<ParallelEnergyPlus::Costs> costs = ParallelEnergyPlus::fitCosts(runs);
+  ASSERT_TRUE(costs);
+  EXPECT_NEAR(0.05, costs->secondsPerDay, 0.005);
+  EXPECT_NEAR(3.0, costs->warmupSeconds, 0.5);
+}
@@ -0,0 +1,198 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTcpSocket>
+
+#include "RunManagerTestFixture.hpp"
+#include <runmanager/Test/ToolBin.hxx>
+#include "../RunManager.hpp"
+#include "../RubyJobUtils.hpp"
+#include "../RubyWorkerPool.hpp"
+
+#include "../../../utilities/core/Application.hpp"
+#include "../../../utilities/core/ApplicationPathHelpers.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+#include <sstream>
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+namespace {
+
+  // runs the same trivial measure t_count times and returns the wall time taken
+  double runRubyJobs(const std::string &t_name, int t_count)
+  {
+    openstudio::runmanager::RunManager rm;
+    openstudio::runmanager::Tools tools
+      = openstudio::runmanager::ConfigOptions::makeTools(energyPlusExePath().parent_path(), openstudio::path(), openstudio::path(),
+          rubyExePath().parent_path(), openstudio::path());
+
+    std::vector<openstudio::runmanager::Job> jobs;
+    for (int i = 0; i < t_count; ++i)
+    {
+      openstudio::runmanager::Workflow wf;
+      openstudio::runmanager::RubyJobBuilder rubyjobbuilder;
+      rubyjobbuilder.setScriptFile(resourcesPath() / openstudio::toPath("runmanager/create_os_result_success.rb"));
+      rubyjobbuilder.setIncludeDir(getOpenStudioRubyIncludePath());
+      rubyjobbuilder.addToWorkflow(wf);
+      wf.add(tools);
+
+      std::stringstream ss;
+      ss << t_name << i;
+      openstudio::path outdir = openstudio::tempDir() / openstudio::toPath(ss.str());
+      boost::filesystem::remove_all(outdir); // Clean up test dir before starting
+      jobs.push_back(wf.create(outdir));
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    rm.enqueue(jobs, true);
+    rm.waitForFinished();
+    qint64 elapsed = timer.elapsed();
+
+    for (const auto &job : jobs)
+    {
+      openstudio::runmanager::JobErrors e = job.errors();
+      EXPECT_EQ(openstudio::ruleset::OSResultValue(openstudio::ruleset::OSResultValue::Success), e.result);
+      EXPECT_EQ(0u, e.allErrors.size());
+    }
+
+    return elapsed / 1000.0;
+  }
+
+}
+
+TEST_F(RunManagerTestFixture, RubyWorkerPool_CanRun)
+{
+  openstudio::runmanager::RubyWorkerPool &pool = openstudio::runmanager::RubyWorkerPool::instance();
+  int maxWorkers = pool.maxWorkers();
+  pool.setMaxWorkers(2);
+
+  openstudio::runmanager::ToolInfo ruby("ruby", openstudio::runmanager::ToolVersion(), rubyExePath());
+  openstudio::runmanager::ToolInfo energyplus("energyplus", openstudio::runmanager::ToolVersion(), energyPlusExePath());
+
+  std::vector<std::string> params;
+  params.push_back("-I");
+  params.push_back("/some/include");
+  params.push_back("-I.");
+  params.push_back("in.rb");
+  params.push_back("--inputPath=in.osm");
+
+#ifdef Q_OS_WIN
+  EXPECT_FALSE(pool.canRun(ruby, params));
+#else
+  EXPECT_TRUE(pool.canRun(ruby, params));
+#endif
+  EXPECT_FALSE(pool.canRun(energyplus, params));
+
+  // other interpreter options need a real ruby process
+  std::vector<std::string> debugParams(params);
+  debugParams.insert(debugParams.begin(), "-d");
+  EXPECT_FALSE(pool.canRun(ruby, debugParams));
+
+  // no script
+  EXPECT_FALSE(pool.canRun(ruby, std::vector<std::string>(params.begin(), params.begin() + 3)));
+
+  pool.setMaxWorkers(0);
+  EXPECT_FALSE(pool.canRun(ruby, params));
+
+  pool.setMaxWorkers(maxWorkers);
+}
+
+TEST_F(RunManagerTestFixture, RubyWorkerPool_Overhead)
+{
+  openstudio::Application::instance().application(false);
+  openstudio::runmanager::RubyWorkerPool &pool = openstudio::runmanager::RubyWorkerPool::instance();
+  int maxWorkers = pool.maxWorkers();
+  const int count = 10;
+
+  pool.setMaxWorkers(0);
+  double separate = runRubyJobs("RubyWorkerPoolSeparate", count);
+  LOG_FREE(Info, "RubyWorkerPool", "Ran " << count << " ruby jobs in separate processes in " << separate << "s");
+
+  pool.setMaxWorkers(2);
+  double pooled = runRubyJobs("RubyWorkerPoolPooled", count);
+  LOG_FREE(Info, "RubyWorkerPool", "Ran " << count << " ruby jobs in pooled workers in " << pooled << "s");
+
+#ifndef Q_OS_WIN
+  // two workers load the bindings once each instead of once per job
+  EXPECT_LT(pooled, separate);
+#endif
+
+  pool.setMaxWorkers(maxWorkers);
+}
+
+#ifndef Q_OS_WIN
+TEST_F(RunManagerTestFixture, RubyWorkerPool_RejectsWrongToken)
+{
+  openstudio::Application::instance().application(false);
+  openstudio::runmanager::RubyWorkerPool &pool = openstudio::runmanager::RubyWorkerPool::instance();
+  int maxWorkers = pool.maxWorkers();
+  pool.setMaxWorkers(1);
+
+  openstudio::runmanager::ToolInfo ruby("ruby", openstudio::runmanager::ToolVersion(), rubyExePath());
+  std::string token;
+  boost::optional<int> port = pool.acquire(ruby, token);
+  ASSERT_TRUE(port);
+  EXPECT_EQ(64u, token.size());
+
+  openstudio::path outdir = openstudio::tempDir() / openstudio::toPath("RubyWorkerPoolRejectsWrongToken");
+  boost::filesystem::remove_all(outdir);
+  boost::filesystem::create_directories(outdir);
+
+  QJsonArray args;
+  args.append(toQString(resourcesPath() / openstudio::toPath("runmanager/create_os_result_success.rb")));
+  QJsonObject request;
+  request["dir"] = toQString(outdir);
+  request["args"] = args;
+
+  // the worker closes the connection without running the job
+  QTcpSocket socket;
+  socket.connectToHost(QHostAddress(QHostAddress::LocalHost), static_cast<quint16>(*port));
+  ASSERT_TRUE(socket.waitForConnected(5000));
+  socket.write(QByteArray(std::string(token.size(), '0').c_str()) + "\n");
+  socket.write(QJsonDocument(request).toJson(QJsonDocument::Compact) + "\n");
+  socket.waitForDisconnected(30000);
+  EXPECT_EQ(QAbstractSocket::UnconnectedState, socket.state());
+  EXPECT_TRUE(socket.readAll().isEmpty());
+  EXPECT_TRUE(boost::filesystem::is_empty(outdir));
+
+  pool.release(*port, true);
+  pool.setMaxWorkers(maxWorkers);
+}
+#endif
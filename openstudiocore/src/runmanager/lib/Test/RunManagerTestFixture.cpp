@@ -27,6 +27,7 @@
  **********************************************************************************************************************/
 
 #include "RunManagerTestFixture.hpp"
+#include "../WeatherFileIndex.hpp"
 
 using openstudio::FileLogSink;
 using openstudio::toPath;
@@ -36,6 +37,9 @@ void RunManagerTestFixture::SetUpTestCase() {
   logFile = FileLogSink(toPath("./RunManagerTestFixture.log"));
   logFile->setLogLevel(Trace);
   openstudio::Logger::instance().standardOutLogger().disable();
+
+  // keep the weather file indexes built by the tests out of the user's cache
+  openstudio::runmanager::WeatherFileIndex::setSharedIndexLocation(openstudio::tempDir() / toPath("RunManagerTestFixtureWeatherFileIndex"));
 }
 
 void RunManagerTestFixture::TearDownTestCase() {
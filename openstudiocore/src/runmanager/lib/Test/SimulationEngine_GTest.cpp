@@ -0,0 +1,200 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+#include <runmanager/Test/ToolBin.hxx>
+#include <resources.hxx>
+
+#include "../SimulationEngine.hpp"
+#include "../JobParam.hpp"
+
+#include "../../../model/Model.hpp"
+#include "../../../model/RunPeriod.hpp"
+#include "../../../model/RunPeriod_Impl.hpp"
+
+#include "../../../utilities/core/Application.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <QElapsedTimer>
+
+#include <algorithm>
+
+namespace {
+
+  openstudio::model::RunPeriod runPeriod(openstudio::model::Model &t_model, int t_beginMonth, int t_beginDay,
+      int t_endMonth, int t_endDay)
+  {
+    openstudio::model::RunPeriod runPeriod = t_model.getUniqueModelObject<openstudio::model::RunPeriod>();
+    runPeriod.setBeginMonth(t_beginMonth);
+    runPeriod.setBeginDayOfMonth(t_beginDay);
+    runPeriod.setEndMonth(t_endMonth);
+    runPeriod.setEndDayOfMonth(t_endDay);
+    return runPeriod;
+  }
+
+  openstudio::path cleanDir(const std::string &t_name)
+  {
+    openstudio::path dir = openstudio::tempDir() / openstudio::toPath(t_name);
+    boost::filesystem::remove_all(dir);
+    return dir;
+  }
+
+}
+
+TEST_F(RunManagerTestFixture, SimulationEngine_ShortenRunPeriod)
+{
+  openstudio::model::Model model;
+
+  // annual
+  openstudio::model::RunPeriod annual = runPeriod(model, 1, 1, 12, 31);
+  EXPECT_DOUBLE_EQ(365.0 / 28.0, openstudio::runmanager::SimulationEngine::shortenRunPeriod(annual, 28));
+  EXPECT_EQ(1, annual.getBeginMonth());
+  EXPECT_EQ(1, annual.getBeginDayOfMonth());
+  EXPECT_EQ(1, annual.getEndMonth());
+  EXPECT_EQ(28, annual.getEndDayOfMonth());
+
+  // a winter period wraps around the end of the year, and so does the shortened period
+  openstudio::model::RunPeriod winter = runPeriod(model, 12, 20, 3, 31);
+  EXPECT_DOUBLE_EQ(102.0 / 28.0, openstudio::runmanager::SimulationEngine::shortenRunPeriod(winter, 28));
+  EXPECT_EQ(12, winter.getBeginMonth());
+  EXPECT_EQ(20, winter.getBeginDayOfMonth());
+  EXPECT_EQ(1, winter.getEndMonth());
+  EXPECT_EQ(16, winter.getEndDayOfMonth());
+
+  // February 29th ends February
+  openstudio::model::RunPeriod leapEnd = runPeriod(model, 1, 1, 2, 29);
+  EXPECT_DOUBLE_EQ(59.0 / 28.0, openstudio::runmanager::SimulationEngine::shortenRunPeriod(leapEnd, 28));
+  EXPECT_EQ(1, leapEnd.getEndMonth());
+  EXPECT_EQ(28, leapEnd.getEndDayOfMonth());
+
+  // and a period starting on it starts on March 1st
+  openstudio::model::RunPeriod leapBegin = runPeriod(model, 2, 29, 12, 31);
+  EXPECT_DOUBLE_EQ(306.0 / 28.0, openstudio::runmanager::SimulationEngine::shortenRunPeriod(leapBegin, 28));
+  EXPECT_EQ(3, leapBegin.getEndMonth());
+  EXPECT_EQ(28, leapBegin.getEndDayOfMonth());
+
+  // periods no longer than the shortened period are left alone
+  openstudio::model::RunPeriod february = runPeriod(model, 2, 1, 2, 29);
+  EXPECT_THROW(openstudio::runmanager::SimulationEngine::shortenRunPeriod(february, 28), std::runtime_error);
+  EXPECT_EQ(2, february.getEndMonth());
+  EXPECT_EQ(29, february.getEndDayOfMonth());
+
+  EXPECT_THROW(openstudio::runmanager::SimulationEngine::shortenRunPeriod(annual, 0), std::range_error);
+}
+
+TEST_F(RunManagerTestFixture, SimulationEngine_ShortRunPeriodJob)
+{
+  openstudio::Application::instance().application(false);
+
+  openstudio::model::Model model = openstudio::model::exampleModel();
+  runPeriod(model, 1, 1, 12, 31);
+
+  openstudio::runmanager::SimulationEngine engine(cleanDir("SimulationEngineShortRunPeriodJob"), 1);
+  EXPECT_EQ(28, engine.shortRunPeriodDays());
+
+  openstudio::path weatherPath = resourcesPath() / openstudio::toPath("runmanager/USA_CO_Golden-NREL.724666_TMY3.epw");
+  openstudio::path outdir = cleanDir("SimulationEngineShortRunPeriodJobOut");
+
+  std::vector<double> variables(1, 0.0);
+  std::vector<int> discreteVariables(1, 1);
+  openstudio::runmanager::Job job = engine.createShortRunPeriodJob(outdir, model, variables, discreteVariables, "shortrun", weatherPath);
+
+  openstudio::runmanager::JobParams params = job.jobParams();
+  EXPECT_EQ("ShortRunPeriodSimulation", params.get("simulationEngineRunType").children.at(0).value);
+  EXPECT_EQ("shortrun", params.get("simulationEngineSimulationId").children.at(0).value);
+  ASSERT_TRUE(params.has("simulationEngineRunPeriodScale"));
+  EXPECT_DOUBLE_EQ(365.0 / 28.0, boost::lexical_cast<double>(params.get("simulationEngineRunPeriodScale").children.at(0).value));
+
+  // the saved model is shortened, the caller's model is not
+  boost::optional<openstudio::model::Model> saved = openstudio::model::Model::load(outdir / openstudio::toPath("model.osm"));
+  ASSERT_TRUE(saved);
+  openstudio::model::RunPeriod savedRunPeriod = saved->getUniqueModelObject<openstudio::model::RunPeriod>();
+  EXPECT_EQ(1, savedRunPeriod.getEndMonth());
+  EXPECT_EQ(28, savedRunPeriod.getEndDayOfMonth());
+
+  openstudio::model::RunPeriod originalRunPeriod = model.getUniqueModelObject<openstudio::model::RunPeriod>();
+  EXPECT_EQ(12, originalRunPeriod.getEndMonth());
+  EXPECT_EQ(31, originalRunPeriod.getEndDayOfMonth());
+
+  // a run period that is already short enough gets no shortened job
+  runPeriod(model, 1, 1, 1, 28);
+  EXPECT_THROW(engine.createShortRunPeriodJob(cleanDir("SimulationEngineShortRunPeriodJobOut2"), model, variables,
+        discreteVariables, "shortrun2", weatherPath), std::runtime_error);
+}
+
+TEST_F(RunManagerTestFixture, SimulationEngine_FuelUsesChangedOrder)
+{
+  openstudio::Application::instance().application(false);
+
+  openstudio::model::Model model = openstudio::model::exampleModel();
+  runPeriod(model, 1, 1, 12, 31);
+
+  openstudio::runmanager::SimulationEngine engine(cleanDir("SimulationEngineFuelUsesChangedOrder"), 1);
+
+  std::vector<std::string> runTypes;
+  QObject::connect(&engine, &openstudio::runmanager::SimulationEngine::fuelUsesChanged,
+      [&runTypes](const std::vector<double> &, const std::vector<int> &, const std::string &t_runType, double) {
+        runTypes.push_back(t_runType);
+      });
+
+  openstudio::path weatherPath = resourcesPath() / openstudio::toPath("runmanager/USA_CO_Golden-NREL.724666_TMY3.epw");
+  std::vector<double> variables(1, 0.0);
+  std::vector<int> discreteVariables(1, 1);
+  engine.fuelUses(model, variables, discreteVariables, "order", weatherPath);
+
+  // the ISO model runs in process, before any EnergyPlus job is queued
+  ASSERT_EQ(1u, runTypes.size());
+  EXPECT_EQ("ISOModelSimulation", runTypes[0]);
+  EXPECT_EQ("ISOModelSimulation", engine.details(variables, discreteVariables).runType);
+
+  QElapsedTimer timer;
+  timer.start();
+  while (std::find(runTypes.begin(), runTypes.end(), "FullSimulation") == runTypes.end() && timer.elapsed() < 1800000)
+  {
+    openstudio::Application::instance().processEvents(100);
+  }
+
+  // the 28 day run finishes ahead of the annual runs
+  auto shortRun = std::find(runTypes.begin(), runTypes.end(), "ShortRunPeriodSimulation");
+  auto estimation = std::find(runTypes.begin(), runTypes.end(), "EstimationSimulation");
+  auto fullRun = std::find(runTypes.begin(), runTypes.end(), "FullSimulation");
+  ASSERT_TRUE(shortRun != runTypes.end());
+  ASSERT_TRUE(fullRun != runTypes.end());
+  EXPECT_TRUE(shortRun < fullRun);
+  if (estimation != runTypes.end())
+  {
+    EXPECT_TRUE(shortRun < estimation);
+    EXPECT_TRUE(estimation < fullRun);
+  }
+
+  // each level refines the estimate, the most confident one is kept
+  EXPECT_LT(0.0, engine.details(variables, discreteVariables).confidence);
+}
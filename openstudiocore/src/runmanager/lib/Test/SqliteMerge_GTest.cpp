@@ -0,0 +1,137 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+
+#include "../ParallelEnergyPlus/SqliteMerge.hpp"
+
+#include "../../../utilities/core/Path.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <sstream>
+
+namespace {
+
+  long long queryInteger(sqlite3 *db, const std::string &sql)
+  {
+    long long result = -1;
+    sqlite3_stmt *stmt = nullptr;
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+      result = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return result;
+  }
+
+  // a partition with the tables SqliteMerge appends to: t_days hourly time steps with one value each,
+  // and one extended data row holding the maximum of the last value
+  void createPartition(const openstudio::path &t_file, int t_firstDay, int t_days)
+  {
+    boost::filesystem::remove(t_file);
+
+    sqlite3 *db = nullptr;
+    ASSERT_EQ(SQLITE_OK, sqlite3_open(openstudio::toString(t_file).c_str(), &db));
+
+    std::stringstream sql;
+    sql << "CREATE TABLE Time (TimeIndex INTEGER PRIMARY KEY, Month INTEGER, Day INTEGER, Hour INTEGER, Minute INTEGER, "
+      << "Dst INTEGER, Interval INTEGER, IntervalType INTEGER, SimulationDays INTEGER, DayType TEXT, "
+      << "EnvironmentPeriodIndex INTEGER, WarmupFlag INTEGER);"
+      << "CREATE TABLE ReportData (ReportDataIndex INTEGER PRIMARY KEY, TimeIndex INTEGER, "
+      << "ReportDataDictionaryIndex INTEGER, Value REAL);"
+      << "CREATE TABLE ReportExtendedData (ReportExtendedDataIndex INTEGER PRIMARY KEY, ReportDataIndex INTEGER, "
+      << "MaxValue REAL, MaxMonth INTEGER, MaxDay INTEGER, MaxHour INTEGER, MaxStartMinute INTEGER, MaxMinute INTEGER, "
+      << "MinValue REAL, MinMonth INTEGER, MinDay INTEGER, MinHour INTEGER, MinStartMinute INTEGER, MinMinute INTEGER);"
+      << "CREATE INDEX rdTI ON ReportData (TimeIndex ASC);"
+      << "BEGIN;";
+    for (int day = 1; day <= t_days; ++day)
+    {
+      sql << "INSERT INTO Time VALUES (" << day << ", 1, " << (t_firstDay + day - 1) << ", 24, 0, 0, 60, 1, " << day
+        << ", 'Monday', 1, 0);"
+        << "INSERT INTO ReportData VALUES (" << day << ", " << day << ", 1, " << (t_firstDay + day - 1) << ");";
+    }
+    sql << "INSERT INTO ReportExtendedData VALUES (1, " << t_days << ", " << (t_firstDay + t_days - 1)
+      << ", 1, " << (t_firstDay + t_days - 1) << ", 24, 0, 60, 0, 1, 1, 1, 0, 60);"
+      << "COMMIT;";
+    EXPECT_EQ(SQLITE_OK, sqlite3_exec(db, sql.str().c_str(), nullptr, nullptr, nullptr));
+
+    sqlite3_close(db);
+  }
+
+}
+
+TEST_F(RunManagerTestFixture, SqliteMergeReportExtendedDataTest)
+{
+  openstudio::path dir = openstudio::tempDir() / openstudio::toPath("SqliteMergeReportExtendedDataTest");
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+
+  openstudio::path first = dir / openstudio::toPath("eplusout.sql");
+  openstudio::path second = dir / openstudio::toPath("partition2.sql");
+  openstudio::path third = dir / openstudio::toPath("partition3.sql");
+  createPartition(first, 1, 3);
+  createPartition(second, 4, 4);
+  createPartition(third, 8, 2);
+
+  SqliteMerge merge;
+  merge.loadFile(first);
+  merge.loadFile(second);
+  merge.loadFile(third);
+  merge.mergeFiles();
+
+  // the scratch copy replaced the first partition
+  EXPECT_FALSE(boost::filesystem::exists(dir / openstudio::toPath("eplusout.sql.merging")));
+  EXPECT_TRUE(boost::filesystem::exists(dir / openstudio::toPath("final.sql")));
+
+  sqlite3 *db = nullptr;
+  ASSERT_EQ(SQLITE_OK, sqlite3_open(openstudio::toString(first).c_str(), &db));
+
+  EXPECT_EQ(9, queryInteger(db, "select count(*) from Time"));
+  EXPECT_EQ(9, queryInteger(db, "select count(*) from ReportData"));
+  EXPECT_EQ(3, queryInteger(db, "select count(*) from ReportExtendedData"));
+  EXPECT_EQ(9, queryInteger(db, "select max(SimulationDays) from Time"));
+
+  // every extended data row points at the value it summarizes, which was the last of its partition.
+  // Remapping against the ReportData table after the partition's values had been appended to it
+  // left these pointing past the end of the table.
+  EXPECT_EQ(0, queryInteger(db, "select count(*) from ReportExtendedData where ReportDataIndex not in "
+                                "(select ReportDataIndex from ReportData)"));
+  EXPECT_EQ(3, queryInteger(db, "select ReportDataIndex from ReportExtendedData where ReportExtendedDataIndex = 1"));
+  EXPECT_EQ(7, queryInteger(db, "select ReportDataIndex from ReportExtendedData where ReportExtendedDataIndex = 2"));
+  EXPECT_EQ(9, queryInteger(db, "select ReportDataIndex from ReportExtendedData where ReportExtendedDataIndex = 3"));
+  EXPECT_EQ(0, queryInteger(db, "select count(*) from ReportExtendedData e, ReportData d "
+                                "where e.ReportDataIndex = d.ReportDataIndex and d.Value != e.MaxValue"));
+
+  // values still line up with their time steps, and the dropped index was rebuilt
+  EXPECT_EQ(0, queryInteger(db, "select count(*) from ReportData d, Time t where d.TimeIndex = t.TimeIndex and d.Value != t.Day"));
+  EXPECT_EQ(1, queryInteger(db, "select count(*) from sqlite_master where type = 'index' and name = 'rdTI'"));
+
+  sqlite3_close(db);
+}
@@ -631,6 +631,59 @@ TEST_F(RunManagerTestFixture, BCLMeasureRubyScriptEPWPath)
 }
 
 
+TEST_F(RunManagerTestFixture, BCLMeasureRubyScriptIntermediateModel)
+{
+  openstudio::Application::instance().application(false);
+  openstudio::path dir = resourcesPath() / toPath("/runmanager/DummyMeasureEPW");
+  openstudio::path osm = resourcesPath() / toPath("/runmanager/SimpleModel.osm");
+  openstudio::path epw = resourcesPath() / toPath("/runmanager/USA_CO_Golden-NREL.724666_TMY3.epw");
+
+  boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+  ASSERT_TRUE(measure);
+
+  openstudio::runmanager::RunManager rm(openstudio::tempDir() / openstudio::toPath("BCLMeasureRubyScriptIntermediateModel.db"), true, true);
+  openstudio::runmanager::Workflow wf;
+  openstudio::path outdir = openstudio::tempDir() / openstudio::toPath("BCLMeasureRubyScriptIntermediateModel");
+
+  // only the first measure asks for its model to be written out
+  openstudio::runmanager::RubyJobBuilder first(*measure, std::vector<openstudio::ruleset::OSArgument>());
+  first.setIncludeDir(getOpenStudioRubyIncludePath());
+  first.setSaveIntermediateModel();
+
+  openstudio::runmanager::RubyJobBuilder second(*measure, std::vector<openstudio::ruleset::OSArgument>());
+  second.setIncludeDir(getOpenStudioRubyIncludePath());
+
+  wf.addJob(first.toWorkItem());
+  wf.addJob(second.toWorkItem());
+
+  openstudio::runmanager::Tools tools 
+    = openstudio::runmanager::ConfigOptions::makeTools(energyPlusExePath().parent_path(), openstudio::path(), openstudio::path(), 
+        rubyExePath().parent_path(), openstudio::path());
+
+  wf.add(tools);
+
+  boost::filesystem::remove_all(outdir); // Clean up test dir before starting
+
+  openstudio::runmanager::Job j = wf.create(outdir, osm, epw);
+  openstudio::runmanager::JobFactory::optimizeJobTree(j);
+  EXPECT_TRUE(j.children().empty());
+
+  rm.enqueue(j, true);
+  rm.setPaused(false);
+  rm.waitForFinished();
+
+  EXPECT_TRUE(j.errors().succeeded());
+
+  openstudio::path jobdir = j.outdir();
+  EXPECT_TRUE(boost::filesystem::exists(jobdir / openstudio::toPath("mergedjob-0/out.osm")));
+  EXPECT_FALSE(boost::filesystem::exists(jobdir / openstudio::toPath("mergedjob-1/out.osm")));
+  EXPECT_TRUE(boost::filesystem::exists(jobdir / openstudio::toPath("out.osm")));
+
+  // the final model is still the last osm reported by the job
+  EXPECT_EQ(jobdir / openstudio::toPath("out.osm"), openstudio::runmanager::Files(j.outputFiles()).getLastByExtension("osm").fullPath);
+}
+
+
 TEST_F(RunManagerTestFixture, RelocateDaylightSimPath)
 {
   using namespace openstudio;
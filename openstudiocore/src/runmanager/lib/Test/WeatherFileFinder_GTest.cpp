@@ -35,7 +35,13 @@
 #include "../RunManager.hpp"
 #include "../Workflow.hpp"
 #include "../WeatherFileFinder.hpp"
+#include "../WeatherFileIndex.hpp"
 #include <QDir>
+#include <QElapsedTimer>
+#include <boost/filesystem.hpp>
+#include <ctime>
+#include <fstream>
+#include <sstream>
 #include "../../../utilities/core/Application.hpp"
 #include "../../../utilities/core/System.hpp"
 
@@ -125,3 +131,126 @@ TEST_F(RunManagerTestFixture, WeatherFileFinderNoEPWDirCompletedPath)
   openstudio::path p = openstudio::runmanager::WeatherFileFinder::find(openstudio::runmanager::JobParams(), boost::optional<std::string>(), boost::optional<std::string>(openstudio::toString(resourcesPath() / openstudio::toPath("runmanager/USA_FL_Tampa.Intl.AP.722110_TMY3.epw"))));
   EXPECT_EQ(resourcesPath() / openstudio::toPath("runmanager/USA_FL_Tampa.Intl.AP.722110_TMY3.epw"), p);
 }
+
+TEST_F(RunManagerTestFixture, WeatherFileFinderEPWDirWithWmoInLocationName)
+{
+  // a WMO number in the location name wins over the name tokens
+  openstudio::runmanager::JobParams params;
+  params.append("epwdir", openstudio::toString(resourcesPath() / openstudio::toPath("runmanager")));
+  openstudio::path p = openstudio::runmanager::WeatherFileFinder::find(params, boost::optional<std::string>("USA CA Station 722110"), boost::optional<std::string>());
+
+  EXPECT_EQ(resourcesPath() / openstudio::toPath("runmanager/USA_FL_Tampa.Intl.AP.722110_TMY3.epw"), p);
+}
+
+TEST_F(RunManagerTestFixture, WeatherFileFinderEPWDirWithSiteLocation)
+{
+  // no name match, the nearest station to the site is used
+  openstudio::runmanager::JobParams params;
+  params.append("epwdir", openstudio::toString(resourcesPath() / openstudio::toPath("runmanager")));
+  openstudio::path p = openstudio::runmanager::WeatherFileFinder::find(params, boost::optional<std::string>("Oakland"), boost::optional<std::string>(),
+      boost::optional<double>(37.8), boost::optional<double>(-122.27));
+
+  EXPECT_EQ(resourcesPath() / openstudio::toPath("runmanager/USA_CA_San.Francisco.Intl.AP.724940_TMY3.epw"), p);
+
+  // too far from any station
+  p = openstudio::runmanager::WeatherFileFinder::find(params, boost::optional<std::string>("Oakland"), boost::optional<std::string>(),
+      boost::optional<double>(0), boost::optional<double>(0));
+  EXPECT_TRUE(p.empty());
+}
+
+TEST_F(RunManagerTestFixture, WeatherFileIndex)
+{
+  openstudio::path epwdir = resourcesPath() / openstudio::toPath("runmanager");
+  openstudio::path indexFile = openstudio::tempDir() / openstudio::toPath("WeatherFileIndexTest.txt");
+  boost::filesystem::remove(indexFile);
+
+  openstudio::runmanager::WeatherFileIndex index(epwdir, indexFile);
+  EXPECT_TRUE(index.entries().empty());
+  EXPECT_TRUE(index.update());
+  EXPECT_FALSE(index.update());
+  ASSERT_EQ(3u, index.entries().size());
+  EXPECT_TRUE(boost::filesystem::exists(indexFile));
+
+  boost::optional<openstudio::runmanager::WeatherFileIndex::Entry> tampa = index.findByWmo("722110");
+  ASSERT_TRUE(tampa);
+  EXPECT_EQ("722110", tampa->wmoNumber);
+  EXPECT_EQ("USA", tampa->country);
+  EXPECT_TRUE(tampa->hasLocation);
+  EXPECT_FALSE(tampa->checksum.empty());
+  EXPECT_EQ(openstudio::toPath("USA_FL_Tampa.Intl.AP.722110_TMY3.epw"), tampa->path.filename());
+  EXPECT_FALSE(index.findByWmo("000000"));
+
+  std::vector<openstudio::runmanager::WeatherFileIndex::Entry> byName = index.findByName("USA FL Tampa", 3);
+  ASSERT_EQ(1u, byName.size());
+  EXPECT_EQ(tampa->path, byName[0].path);
+  EXPECT_TRUE(index.findByName("Nowhere At All", 1).empty());
+
+  boost::optional<openstudio::runmanager::WeatherFileIndex::Entry> nearest = index.findNearest(39.7, -105.2);
+  ASSERT_TRUE(nearest);
+  EXPECT_EQ(openstudio::toPath("USA_CO_Golden-NREL.724666_TMY3.epw"), nearest->path.filename());
+  EXPECT_FALSE(index.findNearest(0, 0, 100));
+
+  // a second index loads the saved entries and finds nothing to reread
+  openstudio::runmanager::WeatherFileIndex reloaded(epwdir, indexFile);
+  EXPECT_EQ(3u, reloaded.entries().size());
+  ASSERT_TRUE(reloaded.findByWmo("722110"));
+  EXPECT_EQ(tampa->checksum, reloaded.findByWmo("722110")->checksum);
+  EXPECT_FALSE(reloaded.update());
+
+  QElapsedTimer et;
+  et.start();
+  for (int i = 0; i < 1000; ++i)
+  {
+    index.findByName("USA FL Tampa", 3);
+    index.findByWmo("724940");
+    index.findNearest(30 + (i % 20), -120 + (i % 40));
+  }
+  LOG_FREE(Info, "WeatherFileIndexTiming", "1000 name, WMO and nearest lookups took " << et.elapsed() << "ms");
+
+  boost::filesystem::remove(indexFile);
+}
+
+TEST_F(RunManagerTestFixture, WeatherFileIndexInPlaceEdit)
+{
+  openstudio::path dir = openstudio::tempDir() / openstudio::toPath("WeatherFileIndexInPlaceEdit");
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+  openstudio::path epw = dir / openstudio::toPath("Weather.epw");
+  boost::filesystem::copy_file(resourcesPath() / openstudio::toPath("runmanager/USA_FL_Tampa.Intl.AP.722110_TMY3.epw"), epw);
+
+  // times well before the scan, so that the directory time alone would say nothing changed
+  std::time_t past = std::time(nullptr) - 3600;
+  boost::filesystem::last_write_time(epw, past);
+  boost::filesystem::last_write_time(dir, past);
+
+  openstudio::runmanager::WeatherFileIndex index(dir);
+  EXPECT_TRUE(index.updateIfChanged());
+  EXPECT_FALSE(index.updateIfChanged());
+  ASSERT_TRUE(index.findByWmo("722110"));
+
+  // change the WMO number in place, keeping the size of the file and the time of the directory
+  std::string contents;
+  {
+    std::ifstream ifs(openstudio::toString(epw), std::ios_base::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    contents = ss.str();
+  }
+  size_t pos = contents.find("722110");
+  ASSERT_NE(std::string::npos, pos);
+  ASSERT_LT(pos, contents.find('\n'));
+  contents.replace(pos, 6, "999999");
+  {
+    std::ofstream ofs(openstudio::toString(epw), std::ios_base::binary | std::ios_base::trunc);
+    ofs << contents;
+  }
+  boost::filesystem::last_write_time(epw, past + 60);
+  boost::filesystem::last_write_time(dir, past);
+
+  EXPECT_TRUE(index.updateIfChanged());
+  EXPECT_FALSE(index.findByWmo("722110"));
+  EXPECT_TRUE(index.findByWmo("999999"));
+  EXPECT_FALSE(index.updateIfChanged());
+
+  boost::filesystem::remove_all(dir);
+}
@@ -27,14 +27,14 @@
  **********************************************************************************************************************/
 
 #include "WeatherFileFinder.hpp"
+#include "WeatherFileIndex.hpp"
 #include <boost/regex.hpp>
 #include "../../utilities/idf/IdfFile.hpp"
 #include <boost/lexical_cast.hpp>
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/Version_FieldEnums.hxx>
 #include <utilities/idd/Site_Location_FieldEnums.hxx>
-#include <QFileInfo>
-#include <QDir>
+#include <limits>
 
 
 namespace openstudio {
@@ -45,6 +45,19 @@ namespace runmanager {
       ToolVersion &t_version,
       boost::optional<std::string> &t_filelocationname,
       boost::optional<std::string> &t_weatherfilename)
+  {
+    boost::optional<double> latitude;
+    boost::optional<double> longitude;
+    extractDetails(t_idffile, t_version, t_filelocationname, t_weatherfilename, latitude, longitude);
+  }
+
+  void WeatherFileFinder::extractDetails(
+      const IdfFile &t_idffile,
+      ToolVersion &t_version,
+      boost::optional<std::string> &t_filelocationname,
+      boost::optional<std::string> &t_weatherfilename,
+      boost::optional<double> &t_latitude,
+      boost::optional<double> &t_longitude)
   {
     IdfObjectVector versionObjects = t_idffile.getObjectsByType(IddObjectType::Version);
     if(versionObjects.size() == 1){
@@ -78,6 +91,9 @@ namespace runmanager {
         LOG(Debug, "Location name field from IDF: " << *locationname);
         t_filelocationname = locationname;
       }
+
+      t_latitude = locationObjects[0].getDouble(Site_LocationFields::Latitude, true);
+      t_longitude = locationObjects[0].getDouble(Site_LocationFields::Longitude, true);
     }
 
     std::string header = t_idffile.header();
@@ -101,6 +117,20 @@ namespace runmanager {
   openstudio::path WeatherFileFinder::find(const JobParams &t_params,
       const boost::optional<std::string> &t_filelocationname,
       const boost::optional<std::string> &t_weatherfilename)
+  {
+    return find(t_params, t_filelocationname, t_weatherfilename, boost::none, boost::none);
+  }
+
+  double WeatherFileFinder::maxStationDistance()
+  {
+    return 100.0;
+  }
+
+  openstudio::path WeatherFileFinder::find(const JobParams &t_params,
+      const boost::optional<std::string> &t_filelocationname,
+      const boost::optional<std::string> &t_weatherfilename,
+      const boost::optional<double> &t_latitude,
+      const boost::optional<double> &t_longitude)
   {
     openstudio::path epwdir;
 
@@ -166,39 +196,70 @@ namespace runmanager {
 
       // We did not have an epw set, so let's try to find one
       try {
-        QDir dir(openstudio::toQString(epwdir), "*.epw");
-        QFileInfoList files = dir.entryInfoList();
-
-        std::set<std::string> desiredname = getNameComponents(*t_filelocationname);
-
-        openstudio::path bestmatch;
-        size_t matchsize = 0;
-
-        for (QFileInfoList::const_iterator itr = files.begin();
-            itr != files.end();
-            ++itr)
+        // with no epwdir the current directory is searched
+        openstudio::path searchdir = boost::filesystem::absolute(epwdir);
+        if (!boost::filesystem::is_directory(searchdir))
         {
-          std::set<std::string> foundname = getNameComponents(openstudio::toString(itr->fileName()));
+          throw std::runtime_error("epwdir is not a directory");
+        }
 
-          std::vector<std::string> matches;
-          std::set_intersection(desiredname.begin(), desiredname.end(), foundname.begin(), foundname.end(),
-              std::back_inserter(matches));
+        std::shared_ptr<WeatherFileIndex> index = WeatherFileIndex::sharedIndex(searchdir);
+        index->updateIfChanged();
 
-          if (matches.size() > matchsize)
+        // a WMO station number in the location name identifies the station exactly
+        boost::regex wmoRegex("\\b(\\d{6})\\b");
+        for (boost::sregex_iterator itr(t_filelocationname->begin(), t_filelocationname->end(), wmoRegex), end;
+             itr != end;
+             ++itr)
+        {
+          boost::optional<WeatherFileIndex::Entry> entry = index->findByWmo((*itr)[1]);
+          if (entry)
           {
-            matchsize = matches.size();
-            bestmatch = openstudio::toPath(itr->absoluteFilePath());
+            LOG(Info, "Adding epw matching WMO number " << (*itr)[1] << ": " << toString(entry->path));
+            return entry->path;
           }
         }
 
-        if (matchsize > 2)
+        std::vector<WeatherFileIndex::Entry> matches = index->findByName(*t_filelocationname, 3);
+
+        if (!matches.empty())
         {
+          // several stations can share the best name match, prefer the one closest to the site if it is known
+          openstudio::path bestmatch = matches.front().path;
+          if (t_latitude && t_longitude && matches.size() > 1)
+          {
+            double bestDistance = std::numeric_limits<double>::max();
+            for (const auto &match : matches)
+            {
+              if (match.hasLocation)
+              {
+                double distance = WeatherFileIndex::distance(*t_latitude, *t_longitude, match.latitude, match.longitude);
+                if (distance < bestDistance)
+                {
+                  bestDistance = distance;
+                  bestmatch = match.path;
+                }
+              }
+            }
+          }
+
           LOG(Info, "Adding best match epw from the list found: " << toString(bestmatch));
           return bestmatch;
         } else {
-          LOG(Info, "No best match epw file found, continuing with no epw set");
+          LOG(Info, "No best match epw file found by name");
+        }
+
+        if (t_latitude && t_longitude)
+        {
+          boost::optional<WeatherFileIndex::Entry> nearest = index->findNearest(*t_latitude, *t_longitude, maxStationDistance());
+          if (nearest)
+          {
+            LOG(Info, "Adding nearest epw station: " << toString(nearest->path));
+            return nearest->path;
+          }
         }
 
+        LOG(Info, "No best match epw file found, continuing with no epw set");
       } catch (const std::exception &) {
         LOG(Info, "No EPw file set and no epwdir provided. We are continuing, but EnergyPlus will likely fail");
       }
@@ -211,26 +272,6 @@ namespace runmanager {
     return openstudio::path();
   }
 
-  /// Return an ordered set of name parts for a weather name
-  std::set<std::string> WeatherFileFinder::getNameComponents(const std::string &name)
-  {
-    std::string upper = boost::to_upper_copy(name);
-
-    boost::regex re("[A-Z]+");
-    boost::sregex_token_iterator i(upper.begin(), upper.end(), re);
-    boost::sregex_token_iterator j;
-
-    std::set<std::string> ret;
-
-    while (i != j)
-    {
-      ret.insert(*i);
-      ++i;
-    }
-
-    return ret;
-  }
-
 
 }
 }
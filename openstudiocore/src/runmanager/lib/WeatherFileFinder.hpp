@@ -51,6 +51,24 @@ namespace runmanager {
           const boost::optional<std::string> &t_filelocationname,
           const boost::optional<std::string> &t_weatherfilename);
 
+      /// Returns the path to the weather file that should be used for the EnergyPlus simulation
+      ///
+      /// The epwdir is searched through a WeatherFileIndex shared by every job in the process. A WMO number in the
+      /// location name is matched first, then name tokens from the file names and EPW headers. Ties between equally
+      /// good name matches go to the station closest to the site, and if no name matches the nearest station
+      /// within 100 km is used.
+      ///
+      /// \param[in] t_params Checked for epwdir param to look for weather file search path
+      /// \param[in] t_filelocationname Location name returned from extractDetails
+      /// \param[in] t_weatherfilename Weather file name returned from extractDetails
+      /// \param[in] t_latitude Site latitude returned from extractDetails
+      /// \param[in] t_longitude Site longitude returned from extractDetails
+      static openstudio::path find(const JobParams &t_params,
+          const boost::optional<std::string> &t_filelocationname,
+          const boost::optional<std::string> &t_weatherfilename,
+          const boost::optional<double> &t_latitude,
+          const boost::optional<double> &t_longitude);
+
       /// Extracts the details of the IDF needed for simulation and weather file finding
       ///
       /// \param[in] t_idffile IDF to extract details form
@@ -63,9 +81,25 @@ namespace runmanager {
           boost::optional<std::string> &t_filelocationname,
           boost::optional<std::string> &t_weatherfilename);
 
+      /// Extracts the details of the IDF needed for simulation and weather file finding, including the site location
+      ///
+      /// \param[in] t_idffile IDF to extract details form
+      /// \param[out] t_version ToolVersion information extracted from IdfFile
+      /// \param[out] t_filelocationname Weather file location name if provided in the IDf
+      /// \param[out] t_weatherfilename Weather file name, if provided by the IDF
+      /// \param[out] t_latitude Site:Location latitude, if provided by the IDF
+      /// \param[out] t_longitude Site:Location longitude, if provided by the IDF
+      static void extractDetails(
+          const IdfFile &t_idffile,
+          ToolVersion &t_version,
+          boost::optional<std::string> &t_filelocationname,
+          boost::optional<std::string> &t_weatherfilename,
+          boost::optional<double> &t_latitude,
+          boost::optional<double> &t_longitude);
+
     private:
-          /// Return an ordered set of name parts for a weather name
-      static std::set<std::string> getNameComponents(const std::string &name);
+      /// Furthest a station found by location alone may be from the site, in km
+      static double maxStationDistance();
 
       REGISTER_LOGGER("openstudio.runmanager.WeatherFileFinder");
 
@@ -0,0 +1,558 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+#include "WeatherFileIndex.hpp"
+#include "../../utilities/core/Checksum.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace openstudio {
+namespace runmanager {
+
+  namespace {
+    const char *indexHeader()
+    {
+      return "OpenStudio weather file index 1";
+    }
+
+    std::string sanitize(std::string t_value)
+    {
+      std::replace(t_value.begin(), t_value.end(), '\t', ' ');
+      std::replace(t_value.begin(), t_value.end(), '\n', ' ');
+      std::replace(t_value.begin(), t_value.end(), '\r', ' ');
+      return t_value;
+    }
+
+    bool entryOrder(const WeatherFileIndex::Entry *t_lhs, const WeatherFileIndex::Entry *t_rhs)
+    {
+      // same order as QDir's default sort of the directory listing
+      QString lhs = openstudio::toQString(t_lhs->path.filename());
+      QString rhs = openstudio::toQString(t_rhs->path.filename());
+      int comparison = lhs.compare(rhs, Qt::CaseInsensitive);
+      if (comparison == 0)
+      {
+        return lhs < rhs;
+      }
+      return comparison < 0;
+    }
+
+    QMutex &sharedIndexMutex()
+    {
+      static QMutex mutex;
+      return mutex;
+    }
+
+    // empty for the user's cache directory, guarded by sharedIndexMutex
+    openstudio::path &sharedIndexLocation()
+    {
+      static openstudio::path location;
+      return location;
+    }
+  }
+
+  WeatherFileIndex::WeatherFileIndex(const openstudio::path &t_directory, const openstudio::path &t_indexFile)
+    : m_directory(t_directory), m_indexFile(t_indexFile), m_directoryModified(-1), m_lastScan(-1)
+  {
+    if (!m_indexFile.empty())
+    {
+      load();
+      buildLookups();
+    }
+  }
+
+  openstudio::path WeatherFileIndex::directory() const
+  {
+    return m_directory;
+  }
+
+  bool WeatherFileIndex::updateIfChanged()
+  {
+    {
+      QMutexLocker lock(&m_mutex);
+
+      qint64 modified = QFileInfo(openstudio::toQString(m_directory)).lastModified().toMSecsSinceEpoch();
+
+      // modification times can be as coarse as 2 seconds, so a change that landed just before the last scan
+      // might not have moved the directory time
+      if (m_lastScan >= 0 && modified == m_directoryModified && m_lastScan - modified > 2000)
+      {
+        // a file edited in place does not change the directory, so the indexed files are checked as well
+        bool filesChanged = false;
+        for (const auto &entry : m_entries)
+        {
+          QFileInfo file(openstudio::toQString(entry.second.path));
+          if (!file.exists() || file.size() != entry.second.size
+              || file.lastModified().toMSecsSinceEpoch() != entry.second.lastModified)
+          {
+            filesChanged = true;
+            break;
+          }
+        }
+
+        if (!filesChanged)
+        {
+          return false;
+        }
+      }
+    }
+
+    return update();
+  }
+
+  bool WeatherFileIndex::update()
+  {
+    QMutexLocker lock(&m_mutex);
+
+    m_lastScan = QDateTime::currentMSecsSinceEpoch();
+    m_directoryModified = QFileInfo(openstudio::toQString(m_directory)).lastModified().toMSecsSinceEpoch();
+
+    QDir dir(openstudio::toQString(m_directory), "*.epw");
+    QFileInfoList files = dir.entryInfoList(QDir::Files);
+
+    bool changed = false;
+    std::set<std::string> found;
+
+    for (const auto &file : files)
+    {
+      std::string name = openstudio::toString(file.fileName());
+      found.insert(name);
+
+      qint64 size = file.size();
+      qint64 lastModified = file.lastModified().toMSecsSinceEpoch();
+      openstudio::path filePath = openstudio::toPath(file.absoluteFilePath());
+
+      auto itr = m_entries.find(name);
+      if (itr != m_entries.end() && itr->second.size == size && itr->second.lastModified == lastModified)
+      {
+        // unchanged, the path is refreshed in case the index was loaded from another location
+        itr->second.path = filePath;
+        continue;
+      }
+
+      Entry entry;
+      entry.path = filePath;
+      entry.size = size;
+      entry.lastModified = lastModified;
+      if (!readHeader(entry))
+      {
+        LOG(Warn, "Unable to read LOCATION header of weather file " << openstudio::toString(filePath) << ", indexing by file name only");
+      }
+
+      m_entries[name] = entry;
+      changed = true;
+    }
+
+    for (auto itr = m_entries.begin(); itr != m_entries.end();)
+    {
+      if (found.count(itr->first) == 0)
+      {
+        itr = m_entries.erase(itr);
+        changed = true;
+      } else {
+        ++itr;
+      }
+    }
+
+    // the lookups hold pointers into m_entries, and paths may have been refreshed
+    buildLookups();
+
+    if (changed && !m_indexFile.empty())
+    {
+      save();
+    }
+
+    return changed;
+  }
+
+  bool WeatherFileIndex::readHeader(Entry &t_entry)
+  {
+    try {
+      t_entry.checksum = openstudio::checksum(t_entry.path);
+    } catch (const std::exception &) {
+      return false;
+    }
+
+    std::ifstream ifs(openstudio::toString(t_entry.path));
+    std::string line;
+    if (!std::getline(ifs, line))
+    {
+      return false;
+    }
+
+    // LOCATION, city, stateProvinceRegion, country, dataSource, wmoNumber, latitude, longitude, timeZone, elevation
+    std::vector<std::string> split;
+    boost::split(split, line, boost::is_any_of(","));
+    if (split.size() < 8 || !boost::iequals(boost::trim_copy(split[0]), "LOCATION"))
+    {
+      return false;
+    }
+
+    t_entry.city = sanitize(boost::trim_copy(split[1]));
+    t_entry.stateProvinceRegion = sanitize(boost::trim_copy(split[2]));
+    t_entry.country = sanitize(boost::trim_copy(split[3]));
+    t_entry.wmoNumber = sanitize(boost::trim_copy(split[5]));
+
+    try {
+      t_entry.latitude = boost::lexical_cast<double>(boost::trim_copy(split[6]));
+      t_entry.longitude = boost::lexical_cast<double>(boost::trim_copy(split[7]));
+    } catch (const boost::bad_lexical_cast &) {
+      return false;
+    }
+
+    t_entry.hasLocation = true;
+    return true;
+  }
+
+  void WeatherFileIndex::load()
+  {
+    std::ifstream ifs(openstudio::toString(m_indexFile));
+    std::string line;
+
+    if (!std::getline(ifs, line) || line != indexHeader())
+    {
+      return;
+    }
+
+    while (std::getline(ifs, line))
+    {
+      std::vector<std::string> split;
+      boost::split(split, line, boost::is_any_of("\t"));
+      if (split.size() != 11)
+      {
+        LOG(Warn, "Skipping malformed line in weather file index " << openstudio::toString(m_indexFile));
+        continue;
+      }
+
+      try {
+        Entry entry;
+        entry.path = m_directory / openstudio::toPath(split[0]);
+        entry.size = boost::lexical_cast<qint64>(split[1]);
+        entry.lastModified = boost::lexical_cast<qint64>(split[2]);
+        entry.checksum = split[3];
+        entry.hasLocation = (split[4] == "1");
+        entry.wmoNumber = split[5];
+        entry.latitude = boost::lexical_cast<double>(split[6]);
+        entry.longitude = boost::lexical_cast<double>(split[7]);
+        entry.city = split[8];
+        entry.stateProvinceRegion = split[9];
+        entry.country = split[10];
+        m_entries[split[0]] = entry;
+      } catch (const boost::bad_lexical_cast &) {
+        LOG(Warn, "Skipping malformed line in weather file index " << openstudio::toString(m_indexFile));
+      }
+    }
+  }
+
+  void WeatherFileIndex::save() const
+  {
+    // write to a temporary file first so that a concurrent reader never sees a partial index
+    openstudio::path tempFile = m_indexFile;
+    tempFile += openstudio::toPath(".tmp");
+
+    {
+      std::ofstream ofs(openstudio::toString(tempFile), std::ios_base::trunc);
+      if (!ofs)
+      {
+        LOG(Info, "Unable to write weather file index " << openstudio::toString(m_indexFile));
+        return;
+      }
+
+      ofs << indexHeader() << "\n";
+      ofs.precision(17);
+      for (const auto &entry : m_entries)
+      {
+        ofs << entry.first << "\t" << entry.second.size << "\t" << entry.second.lastModified << "\t"
+          << entry.second.checksum << "\t" << (entry.second.hasLocation ? "1" : "0") << "\t"
+          << entry.second.wmoNumber << "\t" << entry.second.latitude << "\t" << entry.second.longitude << "\t"
+          << entry.second.city << "\t" << entry.second.stateProvinceRegion << "\t" << entry.second.country << "\n";
+      }
+    }
+
+    boost::system::error_code ec;
+    boost::filesystem::rename(tempFile, m_indexFile, ec);
+    if (ec)
+    {
+      LOG(Info, "Unable to write weather file index " << openstudio::toString(m_indexFile) << ": " << ec.message());
+      boost::filesystem::remove(tempFile, ec);
+    }
+  }
+
+  void WeatherFileIndex::buildLookups()
+  {
+    m_byToken.clear();
+    m_byWmo.clear();
+    m_byLatitude.clear();
+    m_order.clear();
+
+    std::vector<const Entry *> sorted;
+    sorted.reserve(m_entries.size());
+    for (const auto &entry : m_entries)
+    {
+      sorted.push_back(&entry.second);
+    }
+    std::sort(sorted.begin(), sorted.end(), &entryOrder);
+
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+      const Entry *entry = sorted[i];
+      m_order[entry] = i;
+
+      std::set<std::string> tokens = nameTokens(openstudio::toString(entry->path.filename()));
+      if (entry->hasLocation)
+      {
+        std::set<std::string> locationTokens = nameTokens(entry->city + " " + entry->stateProvinceRegion + " " + entry->country);
+        tokens.insert(locationTokens.begin(), locationTokens.end());
+
+        if (!entry->wmoNumber.empty())
+        {
+          m_byWmo[entry->wmoNumber].push_back(entry);
+        }
+
+        m_byLatitude.push_back(std::make_pair(entry->latitude, entry));
+      }
+
+      for (const auto &token : tokens)
+      {
+        m_byToken[token].push_back(entry);
+      }
+    }
+
+    std::stable_sort(m_byLatitude.begin(), m_byLatitude.end(),
+        [](const std::pair<double, const Entry *> &t_lhs, const std::pair<double, const Entry *> &t_rhs) {
+          return t_lhs.first < t_rhs.first;
+        });
+  }
+
+  std::vector<WeatherFileIndex::Entry> WeatherFileIndex::entries() const
+  {
+    QMutexLocker lock(&m_mutex);
+
+    std::vector<Entry> result;
+    for (const auto &entry : m_entries)
+    {
+      result.push_back(entry.second);
+    }
+    return result;
+  }
+
+  std::vector<WeatherFileIndex::Entry> WeatherFileIndex::findByName(const std::string &t_name, size_t t_minMatches) const
+  {
+    QMutexLocker lock(&m_mutex);
+
+    std::map<const Entry *, size_t> counts;
+    for (const auto &token : nameTokens(t_name))
+    {
+      auto itr = m_byToken.find(token);
+      if (itr != m_byToken.end())
+      {
+        for (const auto &entry : itr->second)
+        {
+          ++counts[entry];
+        }
+      }
+    }
+
+    size_t best = 0;
+    for (const auto &count : counts)
+    {
+      best = std::max(best, count.second);
+    }
+
+    std::vector<const Entry *> matches;
+    if (best >= t_minMatches && best > 0)
+    {
+      for (const auto &count : counts)
+      {
+        if (count.second == best)
+        {
+          matches.push_back(count.first);
+        }
+      }
+    }
+
+    std::sort(matches.begin(), matches.end(),
+        [this](const Entry *t_lhs, const Entry *t_rhs) { return m_order.at(t_lhs) < m_order.at(t_rhs); });
+
+    std::vector<Entry> result;
+    for (const auto &match : matches)
+    {
+      result.push_back(*match);
+    }
+    return result;
+  }
+
+  boost::optional<WeatherFileIndex::Entry> WeatherFileIndex::findByWmo(const std::string &t_wmoNumber) const
+  {
+    QMutexLocker lock(&m_mutex);
+
+    auto itr = m_byWmo.find(boost::trim_copy(t_wmoNumber));
+    if (itr != m_byWmo.end() && !itr->second.empty())
+    {
+      return *itr->second.front();
+    }
+
+    return boost::none;
+  }
+
+  boost::optional<WeatherFileIndex::Entry> WeatherFileIndex::findNearest(double t_latitude, double t_longitude, double t_maxDistance) const
+  {
+    QMutexLocker lock(&m_mutex);
+
+    // km per degree of latitude, the latitude difference alone bounds the distance from below
+    const double kmPerDegree = 6371.0 * 3.14159265358979323846 / 180.0;
+
+    const Entry *best = nullptr;
+    double bestDistance = t_maxDistance;
+
+    auto start = std::lower_bound(m_byLatitude.begin(), m_byLatitude.end(), t_latitude,
+        [](const std::pair<double, const Entry *> &t_lhs, double t_value) { return t_lhs.first < t_value; });
+
+    auto consider = [&](const std::pair<double, const Entry *> &t_candidate) {
+      double d = distance(t_latitude, t_longitude, t_candidate.second->latitude, t_candidate.second->longitude);
+      if (d < bestDistance || (d == bestDistance && best && m_order.at(t_candidate.second) < m_order.at(best)))
+      {
+        bestDistance = d;
+        best = t_candidate.second;
+      }
+    };
+
+    // walk outwards from the query latitude in both directions until the band is wider than the best distance
+    for (auto itr = start; itr != m_byLatitude.end() && (itr->first - t_latitude) * kmPerDegree <= bestDistance; ++itr)
+    {
+      consider(*itr);
+    }
+
+    for (auto itr = start; itr != m_byLatitude.begin();)
+    {
+      --itr;
+      if ((t_latitude - itr->first) * kmPerDegree > bestDistance)
+      {
+        break;
+      }
+      consider(*itr);
+    }
+
+    if (best)
+    {
+      return *best;
+    }
+
+    return boost::none;
+  }
+
+  double WeatherFileIndex::distance(double t_latitude1, double t_longitude1, double t_latitude2, double t_longitude2)
+  {
+    const double radiansPerDegree = 3.14159265358979323846 / 180.0;
+    double dlat = (t_latitude2 - t_latitude1) * radiansPerDegree;
+    double dlon = (t_longitude2 - t_longitude1) * radiansPerDegree;
+    double a = std::sin(dlat / 2) * std::sin(dlat / 2)
+      + std::cos(t_latitude1 * radiansPerDegree) * std::cos(t_latitude2 * radiansPerDegree) * std::sin(dlon / 2) * std::sin(dlon / 2);
+    return 2 * 6371.0 * std::asin(std::min(1.0, std::sqrt(a)));
+  }
+
+  std::set<std::string> WeatherFileIndex::nameTokens(const std::string &t_name)
+  {
+    std::set<std::string> tokens;
+    std::string token;
+
+    for (char c : t_name)
+    {
+      if (c >= 'a' && c <= 'z')
+      {
+        token += static_cast<char>(c - 'a' + 'A');
+      } else if (c >= 'A' && c <= 'Z') {
+        token += c;
+      } else if (!token.empty()) {
+        tokens.insert(token);
+        token.clear();
+      }
+    }
+
+    if (!token.empty())
+    {
+      tokens.insert(token);
+    }
+
+    return tokens;
+  }
+
+  std::shared_ptr<WeatherFileIndex> WeatherFileIndex::sharedIndex(const openstudio::path &t_directory)
+  {
+    static std::map<openstudio::path, std::shared_ptr<WeatherFileIndex> > indexes;
+
+    QMutexLocker lock(&sharedIndexMutex());
+
+    auto itr = indexes.find(t_directory);
+    if (itr == indexes.end())
+    {
+      // the index lives in the user's cache rather than next to the weather files, which may not be writable
+      openstudio::path cacheDir = sharedIndexLocation();
+      if (cacheDir.empty())
+      {
+        QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+        cacheDir = (cacheLocation.isEmpty() ? openstudio::tempDir() : openstudio::toPath(cacheLocation))
+          / openstudio::toPath("WeatherFileIndex");
+      }
+
+      openstudio::path indexFile;
+      boost::system::error_code ec;
+      boost::filesystem::create_directories(cacheDir, ec);
+      if (!ec)
+      {
+        QByteArray hash = QCryptographicHash::hash(openstudio::toQString(t_directory).toUtf8(), QCryptographicHash::Sha1);
+        indexFile = cacheDir / openstudio::toPath(std::string(hash.toHex().data()) + ".txt");
+      } else {
+        LOG(Info, "Unable to create weather file index cache " << openstudio::toString(cacheDir) << ", the index will not be saved");
+      }
+
+      itr = indexes.insert(std::make_pair(t_directory, std::make_shared<WeatherFileIndex>(t_directory, indexFile))).first;
+    }
+
+    return itr->second;
+  }
+
+  void WeatherFileIndex::setSharedIndexLocation(const openstudio::path &t_directory)
+  {
+    QMutexLocker lock(&sharedIndexMutex());
+    sharedIndexLocation() = t_directory;
+  }
+
+}
+}
@@ -0,0 +1,148 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+#ifndef RUNMANAGER_LIB_WEATHERFILEINDEX_HPP
+#define RUNMANAGER_LIB_WEATHERFILEINDEX_HPP
+
+#include "RunManagerAPI.hpp"
+#include "../../utilities/core/Path.hpp"
+#include "../../utilities/core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <QMutex>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace runmanager {
+
+  /// Index of the EPW files in a directory, with the station details from each file's LOCATION header.
+  ///
+  /// The index can be saved to a file of its own and is brought up to date incrementally: only files that are
+  /// new or whose size or modification time changed are read again. sharedIndex saves it in the user's cache
+  /// directory, as the weather file directory may not be writable. Lookups by name token, WMO number and
+  /// nearest latitude / longitude are answered from in memory tables.
+  class RUNMANAGER_API WeatherFileIndex
+  {
+    public:
+      struct RUNMANAGER_API Entry
+      {
+        Entry()
+          : size(0), lastModified(0), latitude(0), longitude(0), hasLocation(false)
+        {
+        }
+
+        openstudio::path path;
+        qint64 size;
+        qint64 lastModified; ///< ms since epoch
+        std::string checksum;
+        std::string city;
+        std::string stateProvinceRegion;
+        std::string country;
+        std::string wmoNumber;
+        double latitude;
+        double longitude;
+        bool hasLocation; ///< true if the LOCATION header could be read
+      };
+
+      /// Creates an index of the *.epw files in t_directory. If t_indexFile is not empty the index is loaded from
+      /// it and saved back to it whenever it changes. The directory is not scanned until update is called
+      WeatherFileIndex(const openstudio::path &t_directory, const openstudio::path &t_indexFile = openstudio::path());
+
+      /// Scans the directory, reading the headers of files that are new or changed and dropping removed files
+      /// \returns true if the index changed
+      bool update();
+
+      /// Calls update only if the directory, or the size or modification time of an indexed file, has changed
+      /// since the last scan
+      bool updateIfChanged();
+
+      openstudio::path directory() const;
+
+      std::vector<Entry> entries() const;
+
+      /// \returns the entries sharing the most upper case name tokens with t_name, using tokens from both the
+      ///          file name and the LOCATION header. Only entries with at least t_minMatches tokens in common
+      ///          are returned. Ties are in file name order
+      std::vector<Entry> findByName(const std::string &t_name, size_t t_minMatches = 1) const;
+
+      /// \returns the first entry, in file name order, with the given WMO station number
+      boost::optional<Entry> findByWmo(const std::string &t_wmoNumber) const;
+
+      /// \returns the entry closest to the given location, within t_maxDistance km
+      boost::optional<Entry> findNearest(double t_latitude, double t_longitude,
+          double t_maxDistance = std::numeric_limits<double>::max()) const;
+
+      /// Great circle distance in km
+      static double distance(double t_latitude1, double t_longitude1, double t_latitude2, double t_longitude2);
+
+      /// Upper case alphabetic tokens of a weather file or location name
+      static std::set<std::string> nameTokens(const std::string &t_name);
+
+      /// Index shared by every caller in the process for t_directory, saved in the user's cache directory
+      /// unless setSharedIndexLocation has been called
+      static std::shared_ptr<WeatherFileIndex> sharedIndex(const openstudio::path &t_directory);
+
+      /// Saves the indexes returned by later calls to sharedIndex in t_directory instead of the user's cache
+      /// directory. Indexes that are already shared keep their location
+      static void setSharedIndexLocation(const openstudio::path &t_directory);
+
+    private:
+      REGISTER_LOGGER("openstudio.runmanager.WeatherFileIndex");
+
+      mutable QMutex m_mutex;
+
+      openstudio::path m_directory;
+      openstudio::path m_indexFile;
+      qint64 m_directoryModified;
+      qint64 m_lastScan;
+
+      // by file name, which also gives the file name order used to break ties
+      std::map<std::string, Entry> m_entries;
+
+      // lookup tables, rebuilt from m_entries when it changes
+      std::map<std::string, std::vector<const Entry *> > m_byToken;
+      std::map<std::string, std::vector<const Entry *> > m_byWmo;
+      std::vector<std::pair<double, const Entry *> > m_byLatitude;
+      std::map<const Entry *, size_t> m_order;
+
+      static bool readHeader(Entry &t_entry);
+      void load();
+      void save() const;
+      void buildLookups();
+  };
+
+}
+}
+
+#endif // RUNMANAGER_LIB_WEATHERFILEINDEX_HPP
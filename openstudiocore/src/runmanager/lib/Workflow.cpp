@@ -29,6 +29,7 @@
 #include "Workflow.hpp"
 #include "WorkItem.hpp"
 #include "RubyJobUtils.hpp"
+#include "ParallelEnergyPlus/ParallelEnergyPlus.hpp"
 #include <QCryptographicHash>
 
 #include "../../ruleset/OSArgument.hpp"
@@ -37,6 +38,8 @@
 #include "../../utilities/core/ApplicationPathHelpers.hpp"
 #include "../../utilities/bcl/BCLMeasure.hpp"
 
+#include <boost/lexical_cast.hpp>
+
 namespace openstudio {
 namespace runmanager {
 
@@ -911,6 +914,25 @@ namespace runmanager {
 
 
   void Workflow::parallelizeEnergyPlus(int t_numSplits, int t_offset)
+  {
+    parallelizeEnergyPlus(t_numSplits, t_offset, boost::none);
+  }
+
+  double Workflow::parallelizeEnergyPlus(int t_numCores, int t_offset, double t_warmupSeconds, double t_secondsPerDay,
+      int t_totalDays)
+  {
+    ParallelEnergyPlus::Plan plan = ParallelEnergyPlus::plan(t_totalDays, t_numCores, t_offset,
+        ParallelEnergyPlus::Costs(t_warmupSeconds, t_secondsPerDay));
+
+    if (plan.numPartitions > 1)
+    {
+      parallelizeEnergyPlus(plan.numPartitions, plan.offset, plan.predictedSpeedup);
+    }
+
+    return plan.predictedSpeedup;
+  }
+
+  void Workflow::parallelizeEnergyPlus(int t_numSplits, int t_offset, const boost::optional<double> &t_predictedSpeedup)
   {
     try {
       std::vector<WorkItem> workitems = toWorkItems();
@@ -930,6 +952,11 @@ namespace runmanager {
           parallelep.m_job->params.append(workItem.params);
           parallelep.m_job->files.append(workItem.files);
           parallelep.m_job->tools.append(workItem.tools);
+          if (t_predictedSpeedup && parallelep.m_job->finishedJob)
+          {
+            // reported by the join job next to the speedup it measured
+            parallelep.m_job->finishedJob->params.append("predictedspeedup", boost::lexical_cast<std::string>(*t_predictedSpeedup));
+          }
           newwf.addWorkflow(parallelep);
         }
       }
@@ -425,9 +425,27 @@ namespace runmanager {
       /// \param[in] t_offset 
       void parallelizeEnergyPlus(int t_numSplits, int t_offset);
 
+      /// Swaps out any EnergyPlusJob with an equivalent ParallelEnergyPlus job, choosing the number of
+      /// runperiods to split into from the available cores and the expected cost of each EnergyPlus run.
+      /// EnergyPlus jobs are left alone if splitting is not predicted to be faster.
+      ///
+      /// The cost estimates can be taken from the log of a previous ParallelEnergyPlus run, which fits them
+      /// to the measured run times of its partitions.
+      ///
+      /// \param[in] t_numCores number of EnergyPlus runs that may execute at once
+      /// \param[in] t_offset number of days to precalculate in each split runperiod
+      /// \param[in] t_warmupSeconds fixed time of an EnergyPlus run spent on setup, sizing and warm-up
+      /// \param[in] t_secondsPerDay time an EnergyPlus run spends on each simulated day
+      /// \param[in] t_totalDays number of days in the runperiod
+      /// \returns the predicted speedup
+      double parallelizeEnergyPlus(int t_numCores, int t_offset, double t_warmupSeconds, double t_secondsPerDay,
+          int t_totalDays = 365);
+
     private:
       REGISTER_LOGGER("openstudio.runmanager.Workflow");
 
+      void parallelizeEnergyPlus(int t_numSplits, int t_offset, const boost::optional<double> &t_predictedSpeedup);
+
       std::shared_ptr<WorkflowJob> getLastJob(const std::shared_ptr<Workflow::WorkflowJob> &t_job);
       std::shared_ptr<WorkflowJob> getLastJob();
       std::shared_ptr<WorkflowJob> getFirstJob() const;
@@ -28,8 +28,15 @@
 
 #include "Checksum.hpp"
 
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <ctime>
 #include <ios>
+#include <map>
 #include <sstream>
+#include <vector>
 
 #include <boost/crc.hpp> 
 #include <boost/filesystem/fstream.hpp>
@@ -48,6 +55,28 @@ namespace openstudio {
 
       return result;
     }
+
+    struct ChecksumCacheEntry
+    {
+      boost::uintmax_t fileSize;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
+
+    // files written this recently may still change without their size or time stamp changing, do not cache them
+    static const std::time_t checksumCacheRacyWindow = 2;
+
+    QMutex& checksumCacheMutex()
+    {
+      static QMutex mutex;
+      return mutex;
+    }
+
+    std::map<path, ChecksumCacheEntry>& checksumCache()
+    {
+      static std::map<path, ChecksumCacheEntry> cache;
+      return cache;
+    }
   }
 
   /// return 8 character hex checksum of string
@@ -61,19 +90,18 @@ namespace openstudio {
   std::string checksum(std::istream& is)
   {
     boost::crc_32_type  crc;
+
+    // read in large blocks and strip ignored characters in place rather than copying each block to a string
+    const std::streamsize n = 65536;
+    std::vector<char> buffer(static_cast<size_t>(n));
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
+      is.read(&buffer[0], n);
       std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
 
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
+      auto begin = buffer.begin();
+      auto end = std::remove_if(begin, begin + static_cast<std::ptrdiff_t>(readSize), openstudio::detail::checksumIgnore);
       
-      crc.process_bytes(str.c_str(), stringSize);
+      crc.process_bytes(&buffer[0], static_cast<size_t>(end - begin));
     } while ( is );
     
     std::stringstream ss;
@@ -99,4 +127,53 @@ namespace openstudio {
     return result;
   }
 
+  std::string cachedChecksum(const path& p)
+  {
+    boost::system::error_code ec;
+    path key = boost::filesystem::system_complete(p, ec);
+    if (ec || !boost::filesystem::is_regular_file(key, ec)){
+      return checksum(p);
+    }
+
+    boost::uintmax_t fileSize = boost::filesystem::file_size(key, ec);
+    if (ec){
+      return checksum(p);
+    }
+
+    std::time_t lastWriteTime = boost::filesystem::last_write_time(key, ec);
+    if (ec){
+      return checksum(p);
+    }
+
+    {
+      QMutexLocker lock(&detail::checksumCacheMutex());
+      auto it = detail::checksumCache().find(key);
+      if (it != detail::checksumCache().end()){
+        if ((it->second.fileSize == fileSize) && (it->second.lastWriteTime == lastWriteTime)){
+          return it->second.checksum;
+        }
+        detail::checksumCache().erase(it);
+      }
+    }
+
+    std::string result = checksum(key);
+
+    if (lastWriteTime < (std::time(nullptr) - detail::checksumCacheRacyWindow)){
+      QMutexLocker lock(&detail::checksumCacheMutex());
+      detail::ChecksumCacheEntry entry;
+      entry.fileSize = fileSize;
+      entry.lastWriteTime = lastWriteTime;
+      entry.checksum = result;
+      detail::checksumCache()[key] = entry;
+    }
+
+    return result;
+  }
+
+  void clearChecksumCache()
+  {
+    QMutexLocker lock(&detail::checksumCacheMutex());
+    detail::checksumCache().clear();
+  }
+
 } // openstudio
@@ -46,6 +46,13 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /// return 8 character hex checksum of file contents, same as checksum(const path&) but results are
+  /// cached by path, file size, and last write time so unchanged files are not read again
+  UTILITIES_API std::string cachedChecksum(const path& p);
+
+  /// remove all entries from the cache used by cachedChecksum
+  UTILITIES_API void clearChecksumCache();
+
 } // openstudio
 
 
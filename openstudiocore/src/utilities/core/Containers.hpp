@@ -36,7 +36,9 @@
 
 #include <vector>
 #include <set>
+#include <map>
 #include <string>
+#include <memory>
 
 namespace openstudio {
 
@@ -93,6 +95,139 @@ std::vector< std::vector<T> > castArray (const std::vector< std::vector<U> >& or
   return result;
 }
 
+/** Vector whose elements are shared with its copies until they are individually overwritten.
+ *  Copying only copies a reference to the base storage. A copy that is modified while the base
+ *  is still shared records the new values per element, so changing one element of a copy of a
+ *  large vector does not copy the rest. Once overrides make up a quarter of the elements, or the
+ *  base is no longer shared, the vector folds them back into storage of its own. Const access
+ *  never modifies the storage. */
+template <typename T>
+class SharedBaseVector {
+ public:
+  typedef std::vector<T> vector_type;
+  typedef typename vector_type::size_type size_type;
+
+  SharedBaseVector() : m_size(0) {}
+
+  SharedBaseVector(const vector_type& values)
+    : m_size(values.size())
+  {
+    if (!values.empty()) {
+      m_base = std::make_shared<vector_type>(values);
+    }
+  }
+
+  size_type size() const { return m_size; }
+
+  bool empty() const { return (m_size == 0); }
+
+  const T& operator[](size_type index) const {
+    if (!m_overrides.empty()) {
+      typename std::map<size_type,T>::const_iterator it = m_overrides.find(index);
+      if (it != m_overrides.end()) {
+        return it->second;
+      }
+    }
+    return (*m_base)[index];
+  }
+
+  const T& back() const { return (*this)[m_size - 1]; }
+
+  vector_type toVector() const {
+    if (m_overrides.empty() && m_base && (m_base->size() == m_size)) {
+      return *m_base;
+    }
+    vector_type result;
+    result.reserve(m_size);
+    for (size_type i = 0; i < m_size; ++i) {
+      result.push_back((*this)[i]);
+    }
+    return result;
+  }
+
+  /** Returns true if this vector and other still read from the same base storage. */
+  bool sharesBaseWith(const SharedBaseVector& other) const {
+    return (m_base && (m_base == other.m_base));
+  }
+
+  /** Returns the number of elements stored separately from the shared base. */
+  size_type numOverrides() const { return m_overrides.size(); }
+
+  void set(size_type index, const T& value) {
+    if (isShared()) {
+      m_overrides[index] = value;
+      foldIfLarge();
+    }
+    else {
+      ownedBase()[index] = value;
+    }
+  }
+
+  void push_back(const T& value) {
+    if (isShared()) {
+      m_overrides[m_size] = value;
+      ++m_size;
+      foldIfLarge();
+    }
+    else {
+      ownedBase().push_back(value);
+      ++m_size;
+    }
+  }
+
+  void pop_back() { resize(m_size - 1); }
+
+  void resize(size_type n) {
+    if (n == m_size) {
+      return;
+    }
+    if (isShared()) {
+      if (n < m_size) {
+        m_overrides.erase(m_overrides.lower_bound(n),m_overrides.end());
+      }
+      else {
+        for (size_type i = m_size; i < n; ++i) {
+          m_overrides[i] = T();
+        }
+      }
+      m_size = n;
+      foldIfLarge();
+    }
+    else {
+      ownedBase().resize(n);
+      m_size = n;
+    }
+  }
+
+ private:
+  bool isShared() const {
+    return (m_base && (m_base.use_count() > 1));
+  }
+
+  void foldIfLarge() {
+    if (4 * m_overrides.size() > m_size) {
+      ownedBase();
+    }
+  }
+
+  // makes the base exclusive to this vector, with no overrides and exactly m_size elements
+  vector_type& ownedBase() {
+    if (!m_base) {
+      m_base = std::make_shared<vector_type>();
+    }
+    else if (isShared() || !m_overrides.empty()) {
+      m_base = std::make_shared<vector_type>(toVector());
+      m_overrides.clear();
+    }
+    m_base->resize(m_size);
+    return *m_base;
+  }
+
+  std::shared_ptr<vector_type> m_base;
+  std::map<size_type,T> m_overrides;
+  size_type m_size;
+};
+
 } // openstudio
 
 #endif // UTILITIES_CORE_CONTAINERS_HPP
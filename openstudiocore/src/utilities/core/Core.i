@@ -7,6 +7,10 @@
 
 %ignore openstudio::detail;
 
+// out parameters
+%ignore openstudio::stringToInteger;
+%ignore openstudio::stringToDouble;
+
 %{
   #include <utilities/core/StringHelpers.hpp>
   #include <utilities/core/FileReference.hpp>
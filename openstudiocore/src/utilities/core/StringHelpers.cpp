@@ -36,7 +36,9 @@
 
 #include <cmath> 
 #include <iomanip>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
 
 namespace openstudio {
 
@@ -299,4 +301,128 @@ std::vector <std::string> splitString(const std::string &string, char delimiter)
   return results;
 }
 
+static bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+int stringToInteger(const std::string &string, bool *ok)
+{
+  const char *p = string.c_str();
+  while (isSpace(*p)) {
+    ++p;
+  }
+
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  const long long limit = negative ? -static_cast<long long>(std::numeric_limits<int>::min()) : std::numeric_limits<int>::max();
+  long long value = 0;
+  const char *digits = p;
+  while (*p >= '0' && *p <= '9') {
+    value = value * 10 + (*p - '0');
+    if (value > limit) {
+      *ok = false;
+      return 0;
+    }
+    ++p;
+  }
+
+  *ok = (p != digits);
+  if (!*ok) {
+    return 0;
+  }
+  return static_cast<int>(negative ? -value : value);
+}
+
+double stringToDouble(const std::string &string, bool *ok)
+{
+  // Powers of ten that are exact in a double, so a mantissa of at most 2^53 combined with one of
+  // them by a single multiplication or division is correctly rounded
+  static const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  const char *p = string.c_str();
+  while (isSpace(*p)) {
+    ++p;
+  }
+
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  unsigned long long mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool anyDigits = false;
+  for (; *p >= '0' && *p <= '9'; ++p) {
+    anyDigits = true;
+    if (mantissa != 0 || *p != '0') {
+      mantissa = mantissa * 10 + (*p - '0');
+      ++numDigits;
+    }
+  }
+  if (*p == '.') {
+    for (++p; *p >= '0' && *p <= '9'; ++p) {
+      anyDigits = true;
+      if (mantissa != 0 || *p != '0') {
+        mantissa = mantissa * 10 + (*p - '0');
+        ++numDigits;
+      }
+      --exponent;
+    }
+  }
+  if (anyDigits && (*p == 'e' || *p == 'E')) {
+    const char *e = p + 1;
+    bool negativeExponent = false;
+    if (*e == '-' || *e == '+') {
+      negativeExponent = (*e == '-');
+      ++e;
+    }
+    if (*e >= '0' && *e <= '9') {
+      int exponentValue = 0;
+      for (; *e >= '0' && *e <= '9'; ++e) {
+        if (exponentValue < 10000) {
+          exponentValue = exponentValue * 10 + (*e - '0');
+        }
+      }
+      exponent += negativeExponent ? -exponentValue : exponentValue;
+      p = e;
+    }
+  }
+
+  if (anyDigits && numDigits <= 15 && *p != 'x' && *p != 'X') {
+    double value = static_cast<double>(mantissa);
+    if (mantissa == 0) {
+      exponent = 0;
+    }
+    if (exponent >= 0 && exponent <= 22) {
+      *ok = true;
+      value *= powersOfTen[exponent];
+      return negative ? -value : value;
+    } else if (exponent < 0 && exponent >= -22) {
+      *ok = true;
+      value /= powersOfTen[-exponent];
+      return negative ? -value : value;
+    }
+  }
+
+  // Anything outside of the fast path (hex, inf, nan, very long mantissas or large exponents) gets the full conversion
+  double value = 0;
+  *ok = true;
+  try {
+    value = std::stod(string);
+  } catch (const std::invalid_argument) {
+    *ok = false;
+  } catch (const std::out_of_range) {
+    *ok = false;
+  }
+  return value;
+}
+
 } // openstudio
@@ -122,6 +122,17 @@ namespace openstudio {
    *  a vector with the input string as the only element. */
   UTILITIES_API std::vector <std::string> splitString(const std::string & string, char delimiter);
 
+  /** Locale independent replacement for std::stoi. Leading whitespace is skipped and conversion stops
+   *  at the first character that is not part of the number. Sets *ok to false and returns 0 if there
+   *  are no digits or the value does not fit in an int. */
+  UTILITIES_API int stringToInteger(const std::string& string, bool* ok);
+
+  /** Locale independent replacement for std::stod. Leading whitespace is skipped and conversion stops
+   *  at the first character that is not part of the number. Decimal strings with at most 15 significant
+   *  digits and small exponents are converted exactly without the C library, anything else falls back
+   *  to std::stod. Sets *ok to false and returns 0 if std::stod would throw. */
+  UTILITIES_API double stringToDouble(const std::string& string, bool* ok);
+
 }
 
 #endif // UTILITIES_CORE_STRINGHELPERS_HPP
@@ -40,15 +40,22 @@
 #include <boost/numeric/ublas/lu.hpp> 
 
 #include <cassert>
+#include <fstream>
+
+#if defined(_WINDOWS)
+  #define _WIN32_WINNT 0x0500
+  #include <windows.h>
+  #include <psapi.h>
+#elif defined(__APPLE__)
+  #include <mach/mach.h>
+#else
+  #include <unistd.h>
+#endif
 
 namespace openstudio{
 
 #ifdef _WINDOWS
 
-  #define _WIN32_WINNT 0x0500
-
-  #include <windows.h>
-
   /// return the amount of time that the system has been idle
   boost::optional<Time> System::systemIdleTime()
   {
@@ -115,6 +122,44 @@ namespace openstudio{
     openstudio::Application::instance().processEvents(); // process any outstanding events
   }
 
+#if defined(_WINDOWS)
+
+  boost::optional<unsigned long long> System::residentSetSize()
+  {
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))){
+      return static_cast<unsigned long long>(counters.WorkingSetSize);
+    }
+    return boost::none;
+  }
+
+#elif defined(__APPLE__)
+
+  boost::optional<unsigned long long> System::residentSetSize()
+  {
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS){
+      return static_cast<unsigned long long>(info.resident_size);
+    }
+    return boost::none;
+  }
+
+#else
+
+  boost::optional<unsigned long long> System::residentSetSize()
+  {
+    // second field of statm is the number of resident pages
+    std::ifstream statm("/proc/self/statm");
+    unsigned long long totalPages(0), residentPages(0);
+    if (statm >> totalPages >> residentPages){
+      return residentPages * static_cast<unsigned long long>(sysconf(_SC_PAGESIZE));
+    }
+    return boost::none;
+  }
+
+#endif
+
   unsigned System::numberOfProcessors()
   {
     unsigned numberOfProcessors = boost::thread::hardware_concurrency();
@@ -48,6 +48,9 @@ namespace openstudio {
     /// Returns the number of processors on this computer
     static unsigned numberOfProcessors();
 
+    /// Returns the resident set size of this process in bytes, if it can be determined
+    static boost::optional<unsigned long long> residentSetSize();
+
     /// Utility for testing exception handling within the system
     static void testExceptions1();
     static void testExceptions2();
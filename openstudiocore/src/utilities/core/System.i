@@ -5,6 +5,9 @@
   #include <utilities/core/System.hpp>
 %}
 
+// no binding for optional unsigned long long
+%ignore openstudio::System::residentSetSize;
+
 %include <utilities/core/System.hpp>
 
 #endif //UTILITIES_CORE_SYSTEM_I
@@ -34,6 +34,10 @@
 
 #include <resources.hxx>
 
+#include <boost/filesystem/fstream.hpp>
+
+#include <ctime>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
@@ -124,3 +128,66 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart,itEnd,*it) == itEnd);
   }
 }
+
+TEST(Checksum, CachedPaths)
+{
+  openstudio::clearChecksumCache();
+
+  path p = resourcesPath() / toPath("utilities/Checksum/Checksum.txt");
+  EXPECT_EQ(checksum(p), openstudio::cachedChecksum(p));
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+
+  p = resourcesPath() / toPath("utilities/Checksum/Checksum2.txt");
+  EXPECT_EQ("17B88D3A", openstudio::cachedChecksum(p));
+
+  p = resourcesPath() / toPath("utilities/Checksum/");
+  EXPECT_EQ("00000000", openstudio::cachedChecksum(p));
+
+  p = resourcesPath() / toPath("utilities/Checksum/NotAFile.txt");
+  EXPECT_EQ("00000000", openstudio::cachedChecksum(p));
+
+  // a file that changes size is read again
+  p = toPath("CachedChecksum.txt");
+  {
+    boost::filesystem::ofstream ofs(p, std::ios_base::binary | std::ios_base::trunc);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+  {
+    boost::filesystem::ofstream ofs(p, std::ios_base::binary | std::ios_base::trunc);
+    ofs << "Hi there\nGoodbye";
+  }
+  EXPECT_EQ("17B88D3A", openstudio::cachedChecksum(p));
+
+  // a file written more than two seconds ago is served from the cache as long as its size and
+  // time stamp are unchanged, so rewriting it in place with the same size and time stamp is not seen
+  std::time_t lastWriteTime = std::time(nullptr) - 60;
+  {
+    boost::filesystem::ofstream ofs(p, std::ios_base::binary | std::ios_base::trunc);
+    ofs << "Hi there";
+  }
+  boost::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+  {
+    boost::filesystem::ofstream ofs(p, std::ios_base::binary | std::ios_base::trunc);
+    ofs << "Hi thar!";
+  }
+  boost::filesystem::last_write_time(p, lastWriteTime);
+  std::string uncached = checksum(p);
+  EXPECT_NE("1AD514BA", uncached);
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+
+  // a new time stamp invalidates the entry
+  boost::filesystem::last_write_time(p, lastWriteTime + 1);
+  EXPECT_EQ(uncached, openstudio::cachedChecksum(p));
+
+  // as does clearing the cache
+  openstudio::clearChecksumCache();
+  boost::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ(uncached, openstudio::cachedChecksum(p));
+
+  boost::filesystem::remove(p);
+  EXPECT_EQ("00000000", openstudio::cachedChecksum(p));
+
+  openstudio::clearChecksumCache();
+}
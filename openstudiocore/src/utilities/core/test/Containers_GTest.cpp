@@ -33,6 +33,7 @@
 #include <resources.hxx>
 
 using openstudio::StringVector;
+using openstudio::SharedBaseVector;
 using openstudio::eraseEmptyElements;
 
 TEST(Containers,StringVector)
@@ -49,3 +50,49 @@ TEST(Containers,StringVector)
   EXPECT_EQ("Guten Tag",sv[1]);
   EXPECT_EQ("Bonjour",sv[2]);
 }
+
+TEST(Containers,SharedBaseVector)
+{
+  StringVector values(12,"value");
+  SharedBaseVector<std::string> original(values);
+  SharedBaseVector<std::string> copy(original);
+  EXPECT_TRUE(copy.sharesBaseWith(original));
+
+  // changing one element of a shared vector only stores that element
+  copy.set(0,"handle");
+  EXPECT_TRUE(copy.sharesBaseWith(original));
+  EXPECT_EQ(1u,copy.numOverrides());
+  EXPECT_EQ("handle",copy[0]);
+  EXPECT_EQ("value",original[0]);
+  EXPECT_EQ("value",copy[1]);
+
+  // shrinking and growing a shared vector must not expose stale base elements
+  copy.resize(10);
+  copy.push_back("pushed");
+  copy.resize(12);
+  ASSERT_EQ(12u,copy.size());
+  EXPECT_EQ("pushed",copy[10]);
+  EXPECT_EQ("",copy[11]);
+  EXPECT_EQ("value",original[11]);
+  EXPECT_EQ(12u,original.size());
+
+  // once a quarter of the elements differ, the copy stores its own base
+  copy.set(1,"a");
+  EXPECT_FALSE(copy.sharesBaseWith(original));
+  EXPECT_EQ(0u,copy.numOverrides());
+  StringVector expected(12,"value");
+  expected[0] = "handle";
+  expected[1] = "a";
+  expected[10] = "pushed";
+  expected[11] = "";
+  EXPECT_TRUE(expected == copy.toVector());
+  EXPECT_TRUE(values == original.toVector());
+
+  // an unshared vector is modified in place
+  SharedBaseVector<std::string> single(values);
+  single.set(3,"three");
+  single.pop_back();
+  EXPECT_EQ(0u,single.numOverrides());
+  EXPECT_EQ(11u,single.size());
+  EXPECT_EQ("three",single[3]);
+}
@@ -37,7 +37,11 @@
 
 #include <QTextStream>
 
+#include <clocale>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <random>
 
 using std::string;
 using namespace openstudio;
@@ -387,3 +391,124 @@ TEST(String, StringSplit)
 
 }
 
+
+// std::stod and std::stoi in the "C" locale are the reference for the locale independent conversions
+std::string randomNumberString(std::mt19937& generator)
+{
+  static const char* const signs[] = {"", "", "-", "+"};
+  static const char* const spaces[] = {"", "", " ", "\t "};
+  static const char* const suffixes[] = {"", "", "", ",", "abc", " 1", "x", ".", "e", "e+"};
+  auto digits = [&generator](int maxLength) {
+    std::string result;
+    for (int i = std::uniform_int_distribution<int>(0, maxLength)(generator); i > 0; --i) {
+      result += static_cast<char>('0' + std::uniform_int_distribution<int>(0, 9)(generator));
+    }
+    return result;
+  };
+
+  std::string result = spaces[generator() % 4];
+  result += signs[generator() % 4];
+  result += digits(20);
+  if (generator() % 2) {
+    result += "." + digits(20);
+  }
+  if (generator() % 3 == 0) {
+    result += (generator() % 2) ? "e" : "E";
+    result += signs[generator() % 4];
+    result += digits(3);
+  }
+  result += suffixes[generator() % 10];
+  return result;
+}
+
+void expectSameAsStod(const std::string& string)
+{
+  bool expectedOk = true;
+  double expected = 0;
+  try {
+    expected = std::stod(string);
+  } catch (const std::exception&) {
+    expectedOk = false;
+  }
+
+  bool ok = false;
+  double value = stringToDouble(string, &ok);
+  EXPECT_EQ(expectedOk, ok) << "'" << string << "'";
+  if (expectedOk && ok) {
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(value)) << "'" << string << "'";
+    } else {
+      // bitwise, so the sign of zero and the last bit of rounding count
+      EXPECT_EQ(0, std::memcmp(&expected, &value, sizeof(double))) << "'" << string << "' " << expected << " " << value;
+    }
+  }
+}
+
+void expectSameAsStoi(const std::string& string)
+{
+  bool expectedOk = true;
+  int expected = 0;
+  try {
+    expected = std::stoi(string);
+  } catch (const std::exception&) {
+    expectedOk = false;
+  }
+
+  bool ok = false;
+  int value = stringToInteger(string, &ok);
+  EXPECT_EQ(expectedOk, ok) << "'" << string << "'";
+  if (expectedOk && ok) {
+    EXPECT_EQ(expected, value) << "'" << string << "'";
+  }
+}
+
+TEST(String, StringToDouble)
+{
+  std::vector<std::string> strings = {
+    "0", "-0", "+0", "0.0", "-0.0", ".5", "5.", ".", "-", "+", "", " ", "abc", "-.e1",
+    "1", "-1", "+1", "  12.5", "\t-3.25", "12.5abc", "1,5", "1.5,2", "1 000",
+    "1e10", "1E10", "1e+10", "1e-10", "-2.5e-3", "1e", "1e+", "1e-", "1ex", "e5",
+    "1e22", "1e23", "1e-22", "1e-23", "123456789012345e7", "123456789012345e-22",
+    "1e308", "1.7976931348623157e308", "1e309", "-1e309", "1e-300", "2.2250738585072014e-308",
+    "4.9e-324", "1e-400", "1e99999999999",
+    "123456789012345", "1234567890123456", "12345678901234567", "9007199254740993",
+    "0.1234567890123456789", "3.141592653589793238462643383279", "99999999999999999999",
+    "000000000000000000001.5", "0.000000000000000000001", "1.000000000000000000001",
+    "0x10", "0X1p4", "inf", "-inf", "infinity", "nan", "NAN(123)",
+    "-9999", "99.9", "999999", "9999.", "-99.0"};
+  for (const std::string& string : strings) {
+    expectSameAsStod(string);
+  }
+
+  std::mt19937 generator(20161019);
+  for (int i = 0; i < 200000; ++i) {
+    expectSameAsStod(randomNumberString(generator));
+  }
+
+  // the decimal separator does not follow the locale, where std::stod would
+  std::string oldLocale = std::setlocale(LC_NUMERIC, nullptr);
+  if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "fr_FR.UTF-8")) {
+    bool ok = false;
+    EXPECT_DOUBLE_EQ(1.5, stringToDouble("1.5", &ok));
+    EXPECT_TRUE(ok);
+    EXPECT_DOUBLE_EQ(1.0, stringToDouble("1,5", &ok));
+    EXPECT_TRUE(ok);
+    std::setlocale(LC_NUMERIC, oldLocale.c_str());
+  }
+}
+
+TEST(String, StringToInteger)
+{
+  std::vector<std::string> strings = {
+    "0", "-0", "+0", "-", "+", "", " ", "abc", "1", "-1", "+1", "  12", "\t-3", "12abc", "1,5", "1.5", "1e3",
+    "2147483647", "-2147483648", "2147483648", "-2147483649", "00000000000000000002147483647",
+    "99999999999999999999", "-99999999999999999999", "0x10", "- 1", "+-1", "1999", "-9999"};
+  for (const std::string& string : strings) {
+    expectSameAsStoi(string);
+  }
+
+  std::mt19937 generator(20161019);
+  for (int i = 0; i < 200000; ++i) {
+    expectSameAsStoi(randomNumberString(generator));
+  }
+}
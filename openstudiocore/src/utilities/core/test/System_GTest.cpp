@@ -30,6 +30,8 @@
 
 #include "../System.hpp"
 
+#include <vector>
+
 using openstudio::System;
 using openstudio::Time;
 
@@ -45,6 +47,19 @@ TEST(System, IdleTime)
   #endif
 }
 
+TEST(System, ResidentSetSize)
+{
+  boost::optional<unsigned long long> before = System::residentSetSize();
+  ASSERT_TRUE(before);
+  EXPECT_GT(*before, 0u);
+
+  // touch 64 MB, resident size should grow by at least half of it
+  std::vector<char> buffer(64*1024*1024, 1);
+  boost::optional<unsigned long long> after = System::residentSetSize();
+  ASSERT_TRUE(after);
+  EXPECT_GT(*after, *before + buffer.size()/2);
+}
+
 TEST(System, ExceptionHandling)
 {
   System::testExceptions1();
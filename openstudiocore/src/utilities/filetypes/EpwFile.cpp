@@ -38,10 +38,13 @@
 #include <QStringList>
 #include <QFile>
 #include <QTextStream>
+#include <QtConcurrentMap>
 
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <fstream>
+#include <sstream>
 
 namespace openstudio{
 
@@ -950,35 +953,6 @@ boost::optional<std::string> EpwDataPoint::toWthString() const
   return boost::optional<std::string>(string);
 }
 
-// Local convenience functions
-static int stringToInteger(const std::string &string, bool *ok)
-{
-  int value = 0;
-  *ok = true;
-  try {
-    value = std::stoi(string);
-  } catch (const std::invalid_argument) {
-    *ok = false;
-  } catch (const std::out_of_range) {
-    *ok = false;
-  }
-  return value;
-}
-
-static double stringToDouble(const std::string &string, bool *ok)
-{
-  double value = 0;
-  *ok = true;
-  try {
-    value = std::stod(string);
-  } catch (const std::invalid_argument) {
-    *ok = false;
-  } catch (const std::out_of_range) {
-    *ok = false;
-  }
-  return value;
-}
-
 Date EpwDataPoint::date() const
 {
   return Date(MonthOfYear(m_month), m_day); // , m_year);
@@ -2336,6 +2310,26 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
   return true;
 }
 
+namespace {
+
+// The fields of one EPW data line that are needed once all of the lines have been converted
+struct EpwRecord
+{
+  enum Status {Ok, Insufficient, Unreadable, UnreadableTime, Unparsed};
+
+  EpwRecord()
+    : status(Ok), year(0), month(0), day(0), minute(0)
+  {}
+
+  Status status;
+  int year;
+  int month;
+  int day;
+  int minute;
+};
+
+}
+
 bool EpwFile::parse(bool storeData)
 {
   if (!boost::filesystem::exists(m_path) || !boost::filesystem::is_regular_file(m_path)){
@@ -2346,23 +2340,42 @@ bool EpwFile::parse(bool storeData)
   // set checksum
   m_checksum = openstudio::checksum(m_path);
 
-  // open file
-  std::ifstream ifs(openstudio::toString(m_path));
+  // read the whole file into one buffer and split it into lines, the data lines are then parsed in chunks
+  std::string buffer;
+  {
+    std::ifstream ifs(openstudio::toString(m_path));
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    buffer = ss.str();
+  }
 
-  // read line by line
-  std::string line;
+  std::vector<std::pair<const char *, const char *> > lines;
+  lines.reserve(buffer.size() / 100 + 8);
+  {
+    const char *p = buffer.data();
+    const char *bufferEnd = p + buffer.size();
+    while (p < bufferEnd) {
+      const char *lineEnd = static_cast<const char *>(memchr(p, '\n', bufferEnd - p));
+      if (!lineEnd) {
+        lineEnd = bufferEnd;
+      }
+      lines.push_back(std::make_pair(p, lineEnd));
+      p = lineEnd + 1;
+    }
+  }
 
   bool result = true;
 
   // read first 8 lines
   for(unsigned i = 0; i < 8; ++i) {
 
-    if(!std::getline(ifs, line)) {
+    if(i >= lines.size()) {
       LOG(Error, "Could not read line " << i+1 << " of EPW file '" << m_path << "'");
-      ifs.close();
       return false;
     }
 
+    std::string line(lines[i].first, lines[i].second);
+
     switch(i) {
       case 0:
         result = result && parseLocation(line);
@@ -2388,31 +2401,122 @@ bool EpwFile::parse(bool storeData)
   }
 
   if (!result){
-    ifs.close();
     LOG(Error, "Failed to parse EPW file header '" << m_path << "'");
     return false;
   }
 
-  // read rest of file
+  OS_ASSERT((60 % m_recordsPerHour) == 0);
+  int minutesPerRecord = 60/m_recordsPerHour;
+
+  // Convert the data lines. This is independent for every line, so it is split into chunks that are
+  // converted concurrently; everything that depends on the order of the lines is checked afterwards
+  size_t numRecords = lines.size() - 8;
+  std::vector<EpwRecord> records(numRecords);
+  size_t firstPoint = m_data.size();
+  if (storeData) {
+    m_data.resize(firstPoint + numRecords);
+  }
+
+  auto parseRecords = [&](const std::pair<size_t, size_t> &chunk) {
+    std::vector<std::string> strings;
+    for (size_t i = chunk.first; i < chunk.second; ++i) {
+      EpwRecord &record = records[i];
+
+      // split the line exactly as splitString would, reusing the field strings
+      const char *p = lines[i + 8].first;
+      const char *lineEnd = lines[i + 8].second;
+      size_t numFields = 0;
+      if (p != lineEnd) {
+        while (true) {
+          const char *fieldEnd = static_cast<const char *>(memchr(p, ',', lineEnd - p));
+          if (!fieldEnd) {
+            fieldEnd = lineEnd;
+          }
+          if (numFields == strings.size()) {
+            strings.push_back(std::string());
+          }
+          strings[numFields++].assign(p, fieldEnd);
+          if (fieldEnd == lineEnd) {
+            break;
+          }
+          p = fieldEnd + 1;
+        }
+      }
+      strings.resize(numFields);
+
+      if (numFields < 5) {
+        record.status = EpwRecord::Insufficient;
+        continue;
+      }
+
+      bool ok = true;
+      bool fieldOk;
+      record.year = stringToInteger(strings[0], &fieldOk);
+      ok = ok && fieldOk;
+      record.month = stringToInteger(strings[1], &fieldOk);
+      ok = ok && fieldOk;
+      record.day = stringToInteger(strings[2], &fieldOk);
+      ok = ok && fieldOk;
+      if (!ok) {
+        record.status = EpwRecord::Unreadable;
+        continue;
+      }
+
+      if (storeData) {
+        int hour = stringToInteger(strings[3], &fieldOk);
+        ok = ok && fieldOk;
+        record.minute = stringToInteger(strings[4], &fieldOk);
+        ok = ok && fieldOk;
+        if (!ok) {
+          record.status = EpwRecord::UnreadableTime;
+          continue;
+        }
+
+        // the minute is computed from the position of the record in the file
+        int currentMinute = 0;
+        if (m_recordsPerHour != 1) {
+          currentMinute = static_cast<int>(((i + 1) * minutesPerRecord) % 60);
+        }
+
+        boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(record.year, record.month, record.day, hour, currentMinute, strings);
+        if (pt) {
+          m_data[firstPoint + i] = pt.get();
+        } else {
+          record.status = EpwRecord::Unparsed;
+        }
+      }
+    }
+  };
+
+  const size_t chunkSize = 512;
+  std::vector<std::pair<size_t, size_t> > chunks;
+  for (size_t i = 0; i < numRecords; i += chunkSize) {
+    chunks.push_back(std::make_pair(i, std::min(i + chunkSize, numRecords)));
+  }
+  if (chunks.size() > 1) {
+    QtConcurrent::blockingMap(chunks, parseRecords);
+  } else if (!chunks.empty()) {
+    parseRecords(chunks.front());
+  }
+
+  // check the records in order
   int lineNumber = 8;
   boost::optional<Date> startDate;
   boost::optional<Date> lastDate;
   boost::optional<Date> endDate;
   bool realYear = true;
   bool wrapAround = false;
-  OS_ASSERT((60 % m_recordsPerHour) == 0);
-  int minutesPerRecord = 60/m_recordsPerHour;
   int currentMinute = 0;
-  while(std::getline(ifs, line)) {
+  for (size_t i = 0; i < numRecords; ++i) {
     lineNumber++;
-    std::vector<std::string> strings = splitString(line, ',');
-    if (strings.size() >= 5) {
+    const EpwRecord &record = records[i];
+    if (record.status != EpwRecord::Insufficient) {
       try {
-        int year = std::stoi(strings[0]);
-        int month = std::stoi(strings[1]);
-        int day = std::stoi(strings[2]);
+        if (record.status == EpwRecord::Unreadable) {
+          throw std::invalid_argument("unreadable date");
+        }
 
-        Date date(month, day, year);
+        Date date(record.month, record.day, record.year);
         if (!startDate) {
           startDate = date;
         }
@@ -2437,8 +2541,9 @@ bool EpwFile::parse(bool storeData)
 
         // Store the data if requested
         if (storeData) {
-          int hour = std::stoi(strings[3]);
-          int minutesInFile = std::stoi(strings[4]);
+          if (record.status == EpwRecord::UnreadableTime) {
+            throw std::invalid_argument("unreadable time");
+          }
           // Due to issues with some EPW files, we need to check stuff here
           if (m_recordsPerHour != 1) {
             currentMinute += minutesPerRecord;
@@ -2447,38 +2552,36 @@ bool EpwFile::parse(bool storeData)
             }
           }
           // Check for agreement between the file value and the computed value
-          if (currentMinute != minutesInFile) {
+          if (currentMinute != record.minute) {
             if (m_minutesMatch) { // Warn only once
-              LOG(Error, "Minutes field (" << minutesInFile << ") on line " << lineNumber << " of EPW file '"
+              LOG(Error, "Minutes field (" << record.minute << ") on line " << lineNumber << " of EPW file '"
                 << m_path << "' does not agree with computed value (" << currentMinute << "). Using computed value");
               m_minutesMatch = false;
             }
           }
-          boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
-          if (pt) {
-            m_data.push_back(pt.get());
-          } else {
+          if (record.status == EpwRecord::Unparsed) {
             LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
-            ifs.close();
+            m_data.resize(firstPoint + i);
             return false;
           }
         }
 
       } catch(...) {
         LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
-        ifs.close();
+        if (storeData) {
+          m_data.resize(firstPoint + i);
+        }
         return false;
       }
     } else {
       LOG(Error, "Insufficient weather data on line " << lineNumber << " of EPW file '" << m_path << "'");
-      ifs.close();
+      if (storeData) {
+        m_data.resize(firstPoint + i);
+      }
       return false;
     }
   }
 
-  // close file
-  ifs.close();
-
   if (!startDate) {
     LOG(Error, "Could not find start date in data section of EPW file '" << m_path << "'");
     return false;
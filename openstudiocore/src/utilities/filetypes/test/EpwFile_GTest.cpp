@@ -28,11 +28,16 @@
 
 #include <gtest/gtest.h>
 #include "../EpwFile.hpp"
+#include "../../core/StringHelpers.hpp"
 #include "../../time/Time.hpp"
 #include "../../time/Date.hpp"
 
 #include <resources.hxx>
 
+#include <QElapsedTimer>
+#include <boost/filesystem.hpp>
+#include <fstream>
+
 using namespace openstudio;
 
 TEST(Filetypes, EpwFile)
@@ -380,3 +385,114 @@ TEST(Filetypes, EpwFile_Wrap_AMY)
     ASSERT_TRUE(false);
   }
 }
+
+TEST(Filetypes, EpwFile_ParseBenchmark)
+{
+  // Load every EPW in a directory with its data. The baseline is what the sequential parse paid for
+  // conversion: every numeric field of every record read with std::getline and std::stoi or std::stod.
+  std::vector<path> directories;
+  directories.push_back(resourcesPath() / toPath("utilities/Filetypes"));
+  directories.push_back(resourcesPath() / toPath("runmanager"));
+
+  const size_t flagsIndex = EpwDataField::DataSourceandUncertaintyFlags;
+  unsigned numFiles = 0;
+  size_t numPoints = 0;
+  size_t numFields = 0;
+  qint64 loadTime = 0;
+  qint64 baselineTime = 0;
+  qint64 conversionTime = 0;
+  QElapsedTimer et;
+
+  for (const path &directory : directories) {
+    for (boost::filesystem::directory_iterator itr(directory); itr != boost::filesystem::directory_iterator(); ++itr) {
+      if (itr->path().extension() != toPath(".epw")) {
+        continue;
+      }
+
+      // some of the files are deliberately invalid
+      et.start();
+      boost::optional<EpwFile> epwFile = EpwFile::load(itr->path(), true);
+      loadTime += et.elapsed();
+      if (!epwFile) {
+        continue;
+      }
+      std::vector<EpwDataPoint> data = epwFile->data();
+      ASSERT_FALSE(data.empty());
+      ++numFiles;
+      numPoints += data.size();
+
+      std::vector<std::vector<std::string> > records;
+      std::ifstream ifs(toString(itr->path()));
+      std::string line;
+      for (unsigned i = 0; i < 8; ++i) {
+        std::getline(ifs, line);
+      }
+      for (const EpwDataPoint &pt : data) {
+        ASSERT_TRUE(std::getline(ifs, line));
+        records.push_back(splitString(line, ','));
+
+        // the chunked parse gives the same record as parsing the line on its own
+        boost::optional<EpwDataPoint> expected = EpwDataPoint::fromEpwString(line);
+        ASSERT_TRUE(expected);
+        std::vector<std::string> expectedStrings = expected->toEpwStrings();
+        std::vector<std::string> strings = pt.toEpwStrings();
+        ASSERT_EQ(expectedStrings.size(), strings.size());
+        // the minute is computed from the position of the record rather than read
+        for (size_t j = flagsIndex; j < strings.size(); ++j) {
+          EXPECT_EQ(expectedStrings[j], strings[j]);
+        }
+      }
+
+      std::vector<double> baselineValues;
+      std::vector<bool> baselineOk;
+      et.start();
+      for (const std::vector<std::string> &record : records) {
+        for (size_t j = 0; j < record.size(); ++j) {
+          if (j == flagsIndex) {
+            continue;
+          }
+          bool ok = true;
+          double value = 0;
+          try {
+            value = (j < flagsIndex) ? std::stoi(record[j]) : std::stod(record[j]);
+          } catch (const std::exception&) {
+            ok = false;
+          }
+          baselineValues.push_back(value);
+          baselineOk.push_back(ok);
+        }
+      }
+      baselineTime += et.elapsed();
+
+      std::vector<double> values;
+      std::vector<bool> valuesOk;
+      et.start();
+      for (const std::vector<std::string> &record : records) {
+        for (size_t j = 0; j < record.size(); ++j) {
+          if (j == flagsIndex) {
+            continue;
+          }
+          bool ok = false;
+          double value = (j < flagsIndex) ? stringToInteger(record[j], &ok) : stringToDouble(record[j], &ok);
+          values.push_back(value);
+          valuesOk.push_back(ok);
+        }
+      }
+      conversionTime += et.elapsed();
+
+      ASSERT_EQ(baselineValues.size(), values.size());
+      for (size_t k = 0; k < values.size(); ++k) {
+        EXPECT_EQ(baselineOk[k], valuesOk[k]);
+        if (baselineOk[k] && valuesOk[k]) {
+          EXPECT_EQ(baselineValues[k], values[k]);
+        }
+      }
+      numFields += values.size();
+    }
+  }
+
+  EXPECT_LT(0u, numFiles);
+  LOG_FREE(Info, "EpwFileTiming", "Loaded " << numFiles << " EPW files with " << numPoints << " records in " << loadTime
+           << "ms, converting their " << numFields << " numeric fields took " << baselineTime << "ms with std::stod and std::stoi and "
+           << conversionTime << "ms with stringToDouble and stringToInteger");
+}
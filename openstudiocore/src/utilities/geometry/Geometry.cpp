@@ -72,15 +72,30 @@ namespace openstudio{
     OptionalVector3d result;
     unsigned N = points.size();
     if (N >= 3){
-      Vector3d vec;
+      // accumulate in doubles rather than creating temporary Vector3d objects for each vertex
+      double x0 = points[0].x();
+      double y0 = points[0].y();
+      double z0 = points[0].z();
+      double nx = 0.0;
+      double ny = 0.0;
+      double nz = 0.0;
+      double ax = points[1].x() - x0;
+      double ay = points[1].y() - y0;
+      double az = points[1].z() - z0;
       for (unsigned i = 1; i < N-1; ++i){
-        Vector3d v1 = points[i] - points[0];
-        Vector3d v2 = points[i+1] - points[0];
-        vec += v1.cross(v2);
+        double bx = points[i+1].x() - x0;
+        double by = points[i+1].y() - y0;
+        double bz = points[i+1].z() - z0;
+        nx += (ay*bz - az*by);
+        ny += (az*bx - ax*bz);
+        nz += (ax*by - ay*bx);
+        ax = bx;
+        ay = by;
+        az = bz;
       }
-     result = vec;
-   }
-   return result;
+      result = Vector3d(nx, ny, nz);
+    }
+    return result;
   }
 
   // compute outward normal from Point3dVector
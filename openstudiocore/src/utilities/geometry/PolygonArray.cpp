@@ -0,0 +1,257 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "PolygonArray.hpp"
+#include "Point3d.hpp"
+#include "Vector3d.hpp"
+#include "Transformation.hpp"
+#include "../core/Assert.hpp"
+
+#include <cmath>
+
+namespace openstudio{
+
+  namespace {
+
+    // apply the affine part of a 4x4 transformation to n points, coordinates are updated in place
+    // the loop carries no dependencies between points so the compiler is free to vectorize it
+    void transformPoints(const Matrix& m, double* x, double* y, double* z, unsigned n)
+    {
+      const double m00 = m(0,0), m01 = m(0,1), m02 = m(0,2), m03 = m(0,3);
+      const double m10 = m(1,0), m11 = m(1,1), m12 = m(1,2), m13 = m(1,3);
+      const double m20 = m(2,0), m21 = m(2,1), m22 = m(2,2), m23 = m(2,3);
+
+      for (unsigned i = 0; i < n; ++i){
+        double px = x[i];
+        double py = y[i];
+        double pz = z[i];
+        x[i] = m00*px + m01*py + m02*pz + m03;
+        y[i] = m10*px + m11*py + m12*pz + m13;
+        z[i] = m20*px + m21*py + m22*pz + m23;
+      }
+    }
+
+  }
+
+  PolygonArray::PolygonArray()
+    : m_begin(1, 0u)
+  {}
+
+  void PolygonArray::reserve(unsigned numPolygons, unsigned numPoints)
+  {
+    m_x.reserve(numPoints);
+    m_y.reserve(numPoints);
+    m_z.reserve(numPoints);
+    m_begin.reserve(numPolygons + 1);
+  }
+
+  unsigned PolygonArray::addPolygon(const std::vector<Point3d>& points)
+  {
+    for (const Point3d& point : points){
+      m_x.push_back(point.x());
+      m_y.push_back(point.y());
+      m_z.push_back(point.z());
+    }
+    m_begin.push_back(m_x.size());
+    return numPolygons() - 1;
+  }
+
+  unsigned PolygonArray::numPolygons() const
+  {
+    return m_begin.size() - 1;
+  }
+
+  unsigned PolygonArray::numPoints() const
+  {
+    return m_x.size();
+  }
+
+  std::vector<Point3d> PolygonArray::polygon(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+
+    std::vector<Point3d> result;
+    result.reserve(m_begin[index+1] - m_begin[index]);
+    for (unsigned i = m_begin[index]; i < m_begin[index+1]; ++i){
+      result.push_back(Point3d(m_x[i], m_y[i], m_z[i]));
+    }
+    return result;
+  }
+
+  void PolygonArray::transform(const Transformation& transformation)
+  {
+    if (!m_x.empty()){
+      transformPoints(transformation.matrix(), m_x.data(), m_y.data(), m_z.data(), m_x.size());
+    }
+  }
+
+  void PolygonArray::transform(unsigned index, const Transformation& transformation)
+  {
+    OS_ASSERT(index < numPolygons());
+
+    unsigned begin = m_begin[index];
+    unsigned n = m_begin[index+1] - begin;
+    if (n > 0){
+      transformPoints(transformation.matrix(), m_x.data() + begin, m_y.data() + begin, m_z.data() + begin, n);
+    }
+  }
+
+  // same triangle fan as getNewallVector, in the same order so that results match it exactly
+  void PolygonArray::newall(unsigned index, double& nx, double& ny, double& nz) const
+  {
+    nx = 0.0;
+    ny = 0.0;
+    nz = 0.0;
+
+    unsigned begin = m_begin[index];
+    unsigned end = m_begin[index+1];
+    if (end - begin < 3){
+      return;
+    }
+
+    const double* x = m_x.data();
+    const double* y = m_y.data();
+    const double* z = m_z.data();
+
+    double x0 = x[begin];
+    double y0 = y[begin];
+    double z0 = z[begin];
+
+    for (unsigned i = begin + 1; i < end - 1; ++i){
+      double ax = x[i] - x0;
+      double ay = y[i] - y0;
+      double az = z[i] - z0;
+      double bx = x[i+1] - x0;
+      double by = y[i+1] - y0;
+      double bz = z[i+1] - z0;
+      nx += (ay*bz - az*by);
+      ny += (az*bx - ax*bz);
+      nz += (ax*by - ay*bx);
+    }
+  }
+
+  std::vector<boost::optional<Vector3d> > PolygonArray::newallVectors() const
+  {
+    std::vector<boost::optional<Vector3d> > result(numPolygons());
+    for (unsigned p = 0; p < numPolygons(); ++p){
+      if (m_begin[p+1] - m_begin[p] >= 3){
+        double nx, ny, nz;
+        newall(p, nx, ny, nz);
+        result[p] = Vector3d(nx, ny, nz);
+      }
+    }
+    return result;
+  }
+
+  std::vector<double> PolygonArray::areas() const
+  {
+    std::vector<double> result(numPolygons(), 0.0);
+    for (unsigned p = 0; p < numPolygons(); ++p){
+      double nx, ny, nz;
+      newall(p, nx, ny, nz);
+      result[p] = std::sqrt(nx*nx + ny*ny + nz*nz) / 2.0;
+    }
+    return result;
+  }
+
+  double PolygonArray::totalArea() const
+  {
+    double result = 0.0;
+    for (unsigned p = 0; p < numPolygons(); ++p){
+      double nx, ny, nz;
+      newall(p, nx, ny, nz);
+      result += std::sqrt(nx*nx + ny*ny + nz*nz) / 2.0;
+    }
+    return result;
+  }
+
+  std::vector<boost::optional<Vector3d> > PolygonArray::outwardNormals() const
+  {
+    std::vector<boost::optional<Vector3d> > result(numPolygons());
+    for (unsigned p = 0; p < numPolygons(); ++p){
+      double nx, ny, nz;
+      newall(p, nx, ny, nz);
+      double length = std::sqrt(nx*nx + ny*ny + nz*nz);
+      if (length > 0){
+        result[p] = Vector3d(nx/length, ny/length, nz/length);
+      }
+    }
+    return result;
+  }
+
+  // area weighted average of the centroids of the fan triangles, weights are signed along the Newall vector
+  // so this is exact for concave polygons too and needs no transformation to face coordinates
+  std::vector<boost::optional<Point3d> > PolygonArray::centroids() const
+  {
+    std::vector<boost::optional<Point3d> > result(numPolygons());
+
+    const double* x = m_x.data();
+    const double* y = m_y.data();
+    const double* z = m_z.data();
+
+    for (unsigned p = 0; p < numPolygons(); ++p){
+      unsigned begin = m_begin[p];
+      unsigned end = m_begin[p+1];
+      if (end - begin < 3){
+        continue;
+      }
+
+      double nx, ny, nz;
+      newall(p, nx, ny, nz);
+
+      double x0 = x[begin];
+      double y0 = y[begin];
+      double z0 = z[begin];
+
+      double w = 0.0;
+      double cx = 0.0;
+      double cy = 0.0;
+      double cz = 0.0;
+      for (unsigned i = begin + 1; i < end - 1; ++i){
+        double ax = x[i] - x0;
+        double ay = y[i] - y0;
+        double az = z[i] - z0;
+        double bx = x[i+1] - x0;
+        double by = y[i+1] - y0;
+        double bz = z[i+1] - z0;
+        double wi = (ay*bz - az*by)*nx + (az*bx - ax*bz)*ny + (ax*by - ay*bx)*nz;
+        w += wi;
+        cx += wi*(ax + bx);
+        cy += wi*(ay + by);
+        cz += wi*(az + bz);
+      }
+
+      if (w > 0){
+        result[p] = Point3d(x0 + cx/(3.0*w), y0 + cy/(3.0*w), z0 + cz/(3.0*w));
+      }
+    }
+
+    return result;
+  }
+
+} // openstudio
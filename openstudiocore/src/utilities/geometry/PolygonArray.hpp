@@ -0,0 +1,102 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POLYGONARRAY_HPP
+#define UTILITIES_GEOMETRY_POLYGONARRAY_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <vector>
+#include <boost/optional.hpp>
+
+namespace openstudio{
+
+  // forward declaration
+  class Point3d;
+  class Vector3d;
+  class Transformation;
+
+  /** PolygonArray stores the vertices of many polygons as contiguous x, y and z coordinate arrays.
+   *  Its kernels compute the same quantities as getNewallVector, getArea, getOutwardNormal and getCentroid
+   *  for every polygon in one pass over the arrays, without creating a Point3d or Vector3d per vertex.
+   */
+  class UTILITIES_API PolygonArray{
+  public:
+
+    /// default constructor creates an empty array
+    PolygonArray();
+
+    /// reserve space for numPolygons polygons with numPoints vertices in total
+    void reserve(unsigned numPolygons, unsigned numPoints);
+
+    /// append a polygon, returns its index
+    unsigned addPolygon(const std::vector<Point3d>& points);
+
+    unsigned numPolygons() const;
+
+    unsigned numPoints() const;
+
+    /// get the vertices of the polygon at index
+    std::vector<Point3d> polygon(unsigned index) const;
+
+    /// apply the transformation to every vertex in place
+    void transform(const Transformation& transformation);
+
+    /// apply the transformation to the vertices of the polygon at index in place
+    void transform(unsigned index, const Transformation& transformation);
+
+    /// Newall vector of each polygon, polygons with less than 3 vertices have no Newall vector
+    std::vector<boost::optional<Vector3d> > newallVectors() const;
+
+    /// area of each polygon, 0 for polygons with less than 3 vertices
+    std::vector<double> areas() const;
+
+    /// sum of the areas of all polygons
+    double totalArea() const;
+
+    /// outward normal of each polygon
+    std::vector<boost::optional<Vector3d> > outwardNormals() const;
+
+    /// centroid of each polygon
+    std::vector<boost::optional<Point3d> > centroids() const;
+
+  private:
+
+    void newall(unsigned index, double& nx, double& ny, double& nz) const;
+
+    std::vector<double> m_x;
+    std::vector<double> m_y;
+    std::vector<double> m_z;
+
+    // polygon i has vertices m_begin[i] to m_begin[i+1]-1
+    std::vector<unsigned> m_begin;
+  };
+
+} // openstudio
+
+#endif //UTILITIES_GEOMETRY_POLYGONARRAY_HPP
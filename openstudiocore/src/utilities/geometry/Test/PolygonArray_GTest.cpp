@@ -0,0 +1,229 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../PolygonArray.hpp"
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+#include "../Transformation.hpp"
+
+#include <boost/timer.hpp>
+
+using namespace openstudio;
+
+namespace {
+
+  // n rotated and translated quads, every fifth one is concave
+  std::vector<std::vector<Point3d> > makePolygons(unsigned n)
+  {
+    std::vector<std::vector<Point3d> > result;
+    result.reserve(n);
+    for (unsigned i = 0; i < n; ++i){
+      std::vector<Point3d> points;
+      double w = 1.0 + (i % 7);
+      double h = 2.0 + (i % 3);
+      points.push_back(Point3d(0, h, 0));
+      points.push_back(Point3d(0, 0, 0));
+      points.push_back(Point3d(w, 0, 0));
+      if (i % 5 == 0){
+        points.push_back(Point3d(w/2.0, h/2.0, 0));
+      }
+      points.push_back(Point3d(w, h, 0));
+
+      Transformation t = Transformation::translation(Vector3d(i, 2.0*i, 0.5*i)) *
+                         Transformation::rotation(Vector3d(1, 1, 1), 0.001*i);
+      result.push_back(t*points);
+    }
+    return result;
+  }
+
+}
+
+TEST_F(GeometryFixture, PolygonArray)
+{
+  PolygonArray polygons;
+  EXPECT_EQ(0u, polygons.numPolygons());
+  EXPECT_EQ(0u, polygons.numPoints());
+  EXPECT_EQ(0.0, polygons.totalArea());
+
+  std::vector<Point3d> square;
+  square.push_back(Point3d(0, 1, 0));
+  square.push_back(Point3d(0, 0, 0));
+  square.push_back(Point3d(1, 0, 0));
+  square.push_back(Point3d(1, 1, 0));
+
+  std::vector<Point3d> line;
+  line.push_back(Point3d(0, 0, 0));
+  line.push_back(Point3d(1, 0, 0));
+
+  EXPECT_EQ(0u, polygons.addPolygon(square));
+  EXPECT_EQ(1u, polygons.addPolygon(line));
+  EXPECT_EQ(2u, polygons.numPolygons());
+  EXPECT_EQ(6u, polygons.numPoints());
+  EXPECT_TRUE(pointsEqual(square, polygons.polygon(0)));
+  EXPECT_TRUE(pointsEqual(line, polygons.polygon(1)));
+
+  std::vector<double> areas = polygons.areas();
+  ASSERT_EQ(2u, areas.size());
+  EXPECT_DOUBLE_EQ(1.0, areas[0]);
+  EXPECT_EQ(0.0, areas[1]);
+  EXPECT_DOUBLE_EQ(1.0, polygons.totalArea());
+
+  std::vector<boost::optional<Vector3d> > normals = polygons.outwardNormals();
+  ASSERT_EQ(2u, normals.size());
+  ASSERT_TRUE(normals[0]);
+  EXPECT_TRUE(vectorEqual(Vector3d(0, 0, 1), *normals[0]));
+  EXPECT_FALSE(normals[1]);
+
+  std::vector<boost::optional<Point3d> > centroids = polygons.centroids();
+  ASSERT_EQ(2u, centroids.size());
+  ASSERT_TRUE(centroids[0]);
+  EXPECT_TRUE(pointEqual(Point3d(0.5, 0.5, 0), *centroids[0]));
+  EXPECT_FALSE(centroids[1]);
+
+  // only transform the square
+  polygons.transform(0, Transformation::translation(Vector3d(0, 0, 2)));
+  EXPECT_TRUE(pointEqual(Point3d(0.5, 0.5, 2), *polygons.centroids()[0]));
+  EXPECT_TRUE(pointsEqual(line, polygons.polygon(1)));
+}
+
+TEST_F(GeometryFixture, PolygonArray_MatchesScalar)
+{
+  std::vector<std::vector<Point3d> > polygons = makePolygons(200);
+
+  PolygonArray polygonArray;
+  for (const std::vector<Point3d>& polygon : polygons){
+    polygonArray.addPolygon(polygon);
+  }
+
+  std::vector<boost::optional<Vector3d> > newalls = polygonArray.newallVectors();
+  std::vector<double> areas = polygonArray.areas();
+  std::vector<boost::optional<Vector3d> > normals = polygonArray.outwardNormals();
+  std::vector<boost::optional<Point3d> > centroids = polygonArray.centroids();
+
+  double total = 0.0;
+  for (unsigned i = 0; i < polygons.size(); ++i){
+    boost::optional<Vector3d> newall = getNewallVector(polygons[i]);
+    ASSERT_TRUE(newall);
+    ASSERT_TRUE(newalls[i]);
+    EXPECT_EQ(newall->x(), newalls[i]->x());
+    EXPECT_EQ(newall->y(), newalls[i]->y());
+    EXPECT_EQ(newall->z(), newalls[i]->z());
+
+    boost::optional<double> area = getArea(polygons[i]);
+    ASSERT_TRUE(area);
+    EXPECT_NEAR(*area, areas[i], 1.0e-12);
+    total += *area;
+
+    boost::optional<Vector3d> normal = getOutwardNormal(polygons[i]);
+    ASSERT_TRUE(normal);
+    ASSERT_TRUE(normals[i]);
+    EXPECT_TRUE(vectorEqual(*normal, *normals[i]));
+
+    boost::optional<Point3d> centroid = getCentroid(polygons[i]);
+    ASSERT_TRUE(centroid);
+    ASSERT_TRUE(centroids[i]);
+    EXPECT_TRUE(pointEqual(*centroid, *centroids[i]));
+  }
+  EXPECT_NEAR(total, polygonArray.totalArea(), 1.0e-8);
+
+  Transformation t = Transformation::translation(Vector3d(1, -2, 3)) * Transformation::rotation(Vector3d(0, 0, 1), 0.3);
+  polygonArray.transform(t);
+  for (unsigned i = 0; i < polygons.size(); ++i){
+    std::vector<Point3d> expected = t*polygons[i];
+    std::vector<Point3d> transformed = polygonArray.polygon(i);
+    ASSERT_EQ(expected.size(), transformed.size());
+    for (unsigned j = 0; j < expected.size(); ++j){
+      EXPECT_EQ(expected[j].x(), transformed[j].x());
+      EXPECT_EQ(expected[j].y(), transformed[j].y());
+      EXPECT_EQ(expected[j].z(), transformed[j].z());
+    }
+  }
+}
+
+TEST_F(GeometryFixture, PolygonArray_Performance)
+{
+  unsigned n = 50000;
+  std::vector<std::vector<Point3d> > polygons = makePolygons(n);
+  Transformation t = Transformation::rotation(Vector3d(0, 0, 1), 0.3);
+
+  double scalarArea = 0.0;
+  double scalarTime = 0.0;
+  {
+    boost::timer timer;
+    for (const std::vector<Point3d>& polygon : polygons){
+      scalarArea += getArea(t*polygon).get();
+    }
+    scalarTime = timer.elapsed();
+  }
+
+  double batchArea = 0.0;
+  double batchTime = 0.0;
+  {
+    boost::timer timer;
+    PolygonArray polygonArray;
+    polygonArray.reserve(n, 5*n);
+    for (const std::vector<Point3d>& polygon : polygons){
+      polygonArray.addPolygon(polygon);
+    }
+    polygonArray.transform(t);
+    batchArea = polygonArray.totalArea();
+    batchTime = timer.elapsed();
+  }
+
+  EXPECT_NEAR(scalarArea, batchArea, 1.0e-6 * scalarArea);
+
+  LOG(Info, "Transformed area of " << n << " polygons, scalar: " << scalarTime << "s, PolygonArray: " << batchTime << "s");
+
+  double scalarCentroidTime = 0.0;
+  {
+    boost::timer timer;
+    for (const std::vector<Point3d>& polygon : polygons){
+      EXPECT_TRUE(getCentroid(polygon));
+    }
+    scalarCentroidTime = timer.elapsed();
+  }
+
+  double batchCentroidTime = 0.0;
+  {
+    boost::timer timer;
+    PolygonArray polygonArray;
+    polygonArray.reserve(n, 5*n);
+    for (const std::vector<Point3d>& polygon : polygons){
+      polygonArray.addPolygon(polygon);
+    }
+    std::vector<boost::optional<Point3d> > centroids = polygonArray.centroids();
+    EXPECT_EQ(n, centroids.size());
+    batchCentroidTime = timer.elapsed();
+  }
+
+  LOG(Info, "Centroids of " << n << " polygons, scalar: " << scalarCentroidTime << "s, PolygonArray: " << batchCentroidTime << "s");
+}
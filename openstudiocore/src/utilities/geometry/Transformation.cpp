@@ -371,9 +371,21 @@ namespace openstudio{
   /// apply the transformation to a vector of points
   std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const
   {
-    std::vector<Point3d> result(points.size());
-    for(unsigned i = 0; i < points.size(); ++i){
-      result[i] = (*this)*points[i];
+    // read the coefficients once instead of building a ublas vector for each point,
+    // sums are in the same order as prod so results match operator*(Point3d) exactly
+    const double m00 = m_storage(0,0), m01 = m_storage(0,1), m02 = m_storage(0,2), m03 = m_storage(0,3);
+    const double m10 = m_storage(1,0), m11 = m_storage(1,1), m12 = m_storage(1,2), m13 = m_storage(1,3);
+    const double m20 = m_storage(2,0), m21 = m_storage(2,1), m22 = m_storage(2,2), m23 = m_storage(2,3);
+
+    std::vector<Point3d> result;
+    result.reserve(points.size());
+    for (const Point3d& point : points){
+      double x = point.x();
+      double y = point.y();
+      double z = point.z();
+      result.push_back(Point3d(m00*x + m01*y + m02*z + m03,
+                               m10*x + m11*y + m12*z + m13,
+                               m20*x + m21*y + m22*z + m23));
     }
     return result;
   }
@@ -11,6 +11,7 @@
   #include <utilities/idf/Workspace.hpp>
   #include <utilities/idf/Workspace_Impl.hpp>
   #include <utilities/idf/WorkspaceWatcher.hpp>
+  #include <utilities/idf/WorkspaceBatchEdit.hpp>
   #include <utilities/idf/WorkspaceExtensibleGroup.hpp>
   #include <utilities/idf/WorkspaceObject.hpp>
   #include <utilities/idf/WorkspaceObjectOrder.hpp>
@@ -165,6 +166,9 @@
 %feature("director") WorkspaceWatcher;  
 %include <utilities/idf/WorkspaceWatcher.hpp>
 
+%ignore openstudio::WorkspaceChangeSet;
+%include <utilities/idf/WorkspaceBatchEdit.hpp>
+
 %extend openstudio::IdfObject{
   std::string __str__() const {
     std::ostringstream os;
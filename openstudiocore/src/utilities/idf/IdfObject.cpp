@@ -77,8 +77,8 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()), 
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()), 
-      m_fieldComments(other.fieldComments())
+      m_fields(other.m_fields), 
+      m_fieldComments(other.m_fieldComments)
   {
     if (keepHandle){
       OS_ASSERT(!other.handle().isNull());
@@ -144,8 +144,8 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const Handle& handle,
                                  const std::string& comment, 
                                  const IddObject& iddObject, 
-                                 const StringVector& fields,
-                                 const StringVector& fieldComments) 
+                                 const SharedBaseVector<std::string>& fields,
+                                 const SharedBaseVector<std::string>& fieldComments) 
     : m_handle(handle),    
       m_comment(comment),
       m_iddObject(iddObject),
@@ -410,7 +410,7 @@ namespace detail {
         m_fieldComments.resize(index+1);
       }
       
-      m_fieldComments[index] = makeComment(cmnt);
+      m_fieldComments.set(index,makeComment(cmnt));
 
       m_diffs.push_back(IdfObjectDiff(index, m_fields[index], m_fields[index]));
       
@@ -445,7 +445,7 @@ namespace detail {
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        m_fields.set(i,newName);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       } 
       else { 
@@ -528,7 +528,7 @@ namespace detail {
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields.set(index,value);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -1229,6 +1229,10 @@ namespace detail {
     return true;
   }
 
+  bool IdfObject_Impl::sharesFieldStorageWith(const IdfObject_Impl& other) const {
+    return m_fields.sharesBaseWith(other.m_fields);
+  }
+
   // SERIALIZATION
 
   std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const std::string& text)
@@ -1575,7 +1579,7 @@ namespace detail {
                                   commentRegex::editorCommentWhitespaceOnlyLine()))
           {
             m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
+            m_fieldComments.set(m_fieldComments.size() - 1,commentOrOtherText);
           }
         }
 
@@ -1979,12 +1983,12 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
 
   std::vector<std::string> IdfObject_Impl::fields() const
   {
-    return m_fields;
+    return m_fields.toVector();
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const
   {
-    return m_fieldComments;
+    return m_fieldComments.toVector();
   }
 
   std::string IdfObject_Impl::encodeString(const std::string& value) const
@@ -78,12 +78,13 @@ namespace detail {
     /** Constructor from iddObject. */
     explicit IdfObject_Impl(const IddObject& iddObject, bool fastName=false);
 
-    /** Constructor from underlying data. Used by WorkspaceObject_Impl. */
+    /** Constructor from underlying data. Used by WorkspaceObject_Impl, which passes its own field
+     *  storage so that the new object shares it. */
     IdfObject_Impl(const Handle& handle,
                    const std::string& comment,
                    const IddObject& iddObject,
-                   const StringVector& fields,
-                   const StringVector& fieldComments);
+                   const SharedBaseVector<std::string>& fields,
+                   const SharedBaseVector<std::string>& fieldComments);
 
     virtual ~IdfObject_Impl() {}
 
@@ -332,6 +333,10 @@ namespace detail {
      *  Prerequisite: iddObject()s must be equal. */
     bool objectListFieldsNonConflicting(const IdfObject& other) const;
 
+    /** Returns true if this object still reads its fields from the same storage as other, as
+     *  a clone does until most of its fields are changed. */
+    bool sharesFieldStorageWith(const IdfObject_Impl& other) const;
+
     //@}
     /** @name Serialization */
     //@{
@@ -402,9 +407,9 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
-    std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
+    // idf fields, shared with clones until changed
+    SharedBaseVector<std::string> m_fields;
+    SharedBaseVector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
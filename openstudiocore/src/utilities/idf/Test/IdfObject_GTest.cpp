@@ -202,6 +202,40 @@ TEST_F(IdfFixture, IdfObject_CopyConstructor)
   EXPECT_EQ("New Building", *(building.name()));
 }
 
+TEST_F(IdfFixture, IdfObject_CloneSharesFields)
+{
+  IdfObject building(IddObjectType::OS_Building);
+  unsigned n = building.iddObject().numFields();
+  ASSERT_GT(n, 4u);
+  EXPECT_TRUE(building.setString(n - 1, ""));
+  EXPECT_TRUE(building.setName("Building"));
+
+  // the clone's new handle is stored on its own, all other fields are shared
+  IdfObject clone = building.clone();
+  EXPECT_TRUE(clone.getImpl<detail::IdfObject_Impl>()->sharesFieldStorageWith(
+      *building.getImpl<detail::IdfObject_Impl>()));
+  EXPECT_NE(building.getString(0).get(), clone.getString(0).get());
+  EXPECT_EQ(toString(clone.handle()), clone.getString(0).get());
+  EXPECT_EQ("Building", clone.name().get());
+  EXPECT_EQ(building.numFields(), clone.numFields());
+
+  // changes stay local to each copy
+  EXPECT_TRUE(clone.setName("Clone"));
+  EXPECT_EQ("Building", building.name().get());
+  EXPECT_EQ("Clone", clone.name().get());
+  EXPECT_TRUE(building.setString(n - 1, "Building Story"));
+  EXPECT_EQ("", clone.getString(n - 1).get());
+  EXPECT_EQ("Building Story", building.getString(n - 1).get());
+
+  // resizing a shared object
+  IdfObject clone2 = clone.clone();
+  ASSERT_EQ(n, clone2.numFields());
+  EXPECT_EQ(clone.fields().size(), clone2.fields().size());
+  EXPECT_TRUE(clone2.getImpl<detail::IdfObject_Impl>()->sharesFieldStorageWith(
+      *clone.getImpl<detail::IdfObject_Impl>()));
+  EXPECT_EQ("Clone", clone2.name().get());
+}
+
 TEST_F(IdfFixture, IdfObject_CommentGettersAndSetters) {
   // DEFAULT OBJECT COMMENTS
   IdfObject object(IddObjectType::Zone);
@@ -34,6 +34,7 @@
 #include "../Workspace.hpp"
 #include "../Workspace_Impl.hpp"
 #include "../WorkspaceObject.hpp"
+#include "../WorkspaceBatchEdit.hpp"
 
 #include "../../core/Assert.hpp"
 
@@ -92,4 +93,37 @@ class WorkspaceReciever : public QObject {
 
 };
 
+class WorkspaceBatchChangeReciever : public QObject {
+  Q_OBJECT;
+ public:
+
+  WorkspaceBatchChangeReciever(const Workspace& workspace)
+    : m_numChanges(0), m_numBatchChanges(0)
+  {
+    std::shared_ptr<openstudio::detail::Workspace_Impl> impl = workspace.getImpl<openstudio::detail::Workspace_Impl>();
+    connect(impl.get(), &openstudio::detail::Workspace_Impl::onChange, this, &WorkspaceBatchChangeReciever::change);
+    connect(impl.get(), &openstudio::detail::Workspace_Impl::onBatchChange, this, &WorkspaceBatchChangeReciever::batchChange);
+  }
+
+  unsigned m_numChanges;
+
+  unsigned m_numBatchChanges;
+
+  WorkspaceChangeSet m_changeSet;
+
+ public slots:
+
+  void change()
+  {
+    ++m_numChanges;
+  }
+
+  void batchChange(const openstudio::WorkspaceChangeSet& changeSet)
+  {
+    ++m_numBatchChanges;
+    m_changeSet = changeSet;
+  }
+
+};
+
 #endif // UTILITIES_IDF_TEST_IDFTESTQOBJECTS_HPP
@@ -0,0 +1,157 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+#include "IdfTestQObjects.hpp"
+#include "../WorkspaceBatchEdit.hpp"
+#include "../WorkspaceObjectWatcher.hpp"
+#include "../Workspace.hpp"
+#include "../WorkspaceObject.hpp"
+#include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+TEST_F(IdfFixture,WorkspaceBatchEdit_CoalescesSignals)
+{
+  Workspace workspace(epIdfFile);
+  WorkspaceBatchChangeReciever reciever(workspace);
+
+  WorkspaceObjectVector surfaces = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u,surfaces.size());
+  WorkspaceObject surface = surfaces[0];
+  WorkspaceObjectWatcher surfaceWatcher(surface);
+
+  WorkspaceObjectVector zones = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_TRUE(zones.size() > 1u);
+  OptionalWorkspaceObject oldZone = surface.getTarget(BuildingSurface_DetailedFields::ZoneName);
+  ASSERT_TRUE(oldZone);
+  WorkspaceObject newZone = (zones[0] == *oldZone) ? zones[1] : zones[0];
+
+  WorkspaceObjectVector variables = workspace.getObjectsByType(IddObjectType::Output_Variable);
+  ASSERT_FALSE(variables.empty());
+  Handle removedHandle = variables[0].handle();
+
+  Handle addedHandle;
+  {
+    WorkspaceBatchEdit batchEdit(workspace);
+    {
+      // nested batch edits do not commit
+      WorkspaceBatchEdit nestedBatchEdit(workspace);
+      EXPECT_TRUE(surface.setString(BuildingSurface_DetailedFields::ViewFactortoGround,"0.1"));
+    }
+    EXPECT_TRUE(workspace.getImpl<detail::Workspace_Impl>()->isBatchEditing());
+
+    EXPECT_TRUE(surface.setString(BuildingSurface_DetailedFields::ViewFactortoGround,"0.2"));
+    EXPECT_TRUE(surface.setName("Renamed Ceiling"));
+    EXPECT_TRUE(surface.setPointer(BuildingSurface_DetailedFields::ZoneName,newZone.handle()));
+
+    OptionalWorkspaceObject added = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(added);
+    addedHandle = added->handle();
+    EXPECT_TRUE(added->setName("Batch Zone"));
+
+    EXPECT_TRUE(variables[0].remove().size() > 0u);
+
+    // data is current and objects have signaled onChange, everything else is deferred
+    EXPECT_EQ("Renamed Ceiling",surface.name().get());
+    EXPECT_TRUE(surfaceWatcher.dirty());
+    EXPECT_FALSE(surfaceWatcher.nameChanged());
+    EXPECT_FALSE(surfaceWatcher.dataChanged());
+    EXPECT_FALSE(surfaceWatcher.relationshipChanged());
+    EXPECT_EQ(0u,reciever.m_numChanges);
+    EXPECT_EQ(0u,reciever.m_numBatchChanges);
+  }
+
+  EXPECT_FALSE(workspace.getImpl<detail::Workspace_Impl>()->isBatchEditing());
+  EXPECT_TRUE(surfaceWatcher.dirty());
+  EXPECT_TRUE(surfaceWatcher.nameChanged());
+  EXPECT_TRUE(surfaceWatcher.dataChanged());
+  EXPECT_TRUE(surfaceWatcher.relationshipChanged());
+  EXPECT_EQ(1u,reciever.m_numChanges);
+  EXPECT_EQ(1u,reciever.m_numBatchChanges);
+
+  const WorkspaceChangeSet& changeSet = reciever.m_changeSet;
+  EXPECT_EQ(1u,changeSet.addedObjects.size());
+  EXPECT_EQ(1u,changeSet.addedObjects.count(addedHandle));
+  EXPECT_EQ(1u,changeSet.removedObjects.size());
+  EXPECT_EQ(1u,changeSet.removedObjects.count(removedHandle));
+  EXPECT_EQ(1u,changeSet.modifiedObjects.count(surface.handle()));
+  EXPECT_EQ(0u,changeSet.modifiedObjects.count(addedHandle));
+  EXPECT_EQ(1u,changeSet.relationshipChangedObjects.count(surface.handle()));
+  EXPECT_TRUE(changeSet.failedRemovals.empty());
+
+  // signals are emitted per change again once the batch is committed
+  surfaceWatcher.clearState();
+  EXPECT_TRUE(surface.setString(BuildingSurface_DetailedFields::ViewFactortoGround,"0.3"));
+  EXPECT_TRUE(surfaceWatcher.dirty());
+  EXPECT_EQ(2u,reciever.m_numChanges);
+  EXPECT_EQ(1u,reciever.m_numBatchChanges);
+}
+
+TEST_F(IdfFixture,WorkspaceBatchEdit_NoChanges)
+{
+  Workspace workspace(epIdfFile);
+  WorkspaceBatchChangeReciever reciever(workspace);
+
+  WorkspaceBatchEdit batchEdit(workspace);
+  batchEdit.commit();
+  batchEdit.commit();
+
+  EXPECT_FALSE(workspace.getImpl<detail::Workspace_Impl>()->isBatchEditing());
+  EXPECT_EQ(0u,reciever.m_numChanges);
+  EXPECT_EQ(0u,reciever.m_numBatchChanges);
+}
+
+TEST_F(IdfFixture,WorkspaceBatchEdit_FailedRemoval)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::Final);
+  WorkspaceBatchChangeReciever reciever(workspace);
+
+  WorkspaceObjectVector buildings = workspace.getObjectsByType(IddObjectType::Building);
+  ASSERT_EQ(1u,buildings.size());
+  Handle buildingHandle = buildings[0].handle();
+
+  {
+    WorkspaceBatchEdit batchEdit(workspace);
+    // building is required at StrictnessLevel::Final, removal is rolled back
+    EXPECT_FALSE(workspace.removeObject(buildingHandle));
+    EXPECT_TRUE(workspace.getObject(buildingHandle));
+  }
+
+  // the rollback is reported as a failure, not as a change
+  EXPECT_EQ(0u,reciever.m_numChanges);
+  EXPECT_EQ(1u,reciever.m_numBatchChanges);
+  const WorkspaceChangeSet& changeSet = reciever.m_changeSet;
+  EXPECT_TRUE(changeSet.empty());
+  EXPECT_EQ(1u,changeSet.failedRemovals.size());
+  EXPECT_EQ(1u,changeSet.failedRemovals.count(buildingHandle));
+}
@@ -33,6 +33,7 @@
 #include "../Workspace.hpp"
 #include "../Workspace_Impl.hpp"
 #include "../WorkspaceObject.hpp"
+#include "../WorkspaceObject_Impl.hpp"
 #include "../WorkspaceObjectOrder.hpp"
 #include "../URLSearchPath.hpp"
 #include "../ValidityReport.hpp"
@@ -60,6 +61,7 @@
 #include "../../core/Application.hpp"
 #include "../../core/Path.hpp"
 #include "../../core/Optional.hpp"
+#include "../../core/System.hpp"
 
 #include "../../time/Time.hpp"
 
@@ -539,6 +541,86 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_CloneSharesData) {
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  Workspace clone = workspace.clone();
+
+  WorkspaceObjectVector lights = workspace.getObjectsByType(IddObjectType::Lights);
+  ASSERT_FALSE(lights.empty());
+  WorkspaceObject light = lights[0];
+  OptionalWorkspaceObject zone = light.getTarget(LightsFields::ZoneorZoneListName);
+  ASSERT_TRUE(zone);
+
+  WorkspaceObjectVector cloneLights = clone.getObjectsByType(IddObjectType::Lights);
+  ASSERT_EQ(lights.size(),cloneLights.size());
+  OptionalWorkspaceObject cloneLight = clone.getObjectByTypeAndName(IddObjectType::Lights,light.name().get());
+  ASSERT_TRUE(cloneLight);
+  EXPECT_TRUE(cloneLight->getImpl<detail::WorkspaceObject_Impl>()->sharesFieldStorageWith(
+      *light.getImpl<detail::WorkspaceObject_Impl>()));
+  EXPECT_TRUE(cloneLight->getImpl<detail::WorkspaceObject_Impl>()->sharesPointerDataWith(
+      *light.getImpl<detail::WorkspaceObject_Impl>()));
+
+  // pointers are remapped into the clone when first used
+  OptionalWorkspaceObject cloneZone = cloneLight->getTarget(LightsFields::ZoneorZoneListName);
+  ASSERT_TRUE(cloneZone);
+  EXPECT_TRUE(cloneZone->workspace() == clone);
+  EXPECT_FALSE(cloneZone->handle() == zone->handle());
+  EXPECT_EQ(zone->name().get(),cloneZone->name().get());
+  EXPECT_EQ(zone->name().get(),cloneLight->getString(LightsFields::ZoneorZoneListName).get());
+  EXPECT_EQ(zone->sources().size(),cloneZone->sources().size());
+  for (const WorkspaceObject& source : cloneZone->sources()) {
+    EXPECT_TRUE(source.workspace() == clone);
+  }
+  EXPECT_EQ(light.getTarget(LightsFields::ZoneorZoneListName)->handle(),zone->handle());
+
+  // the original is unaffected by changes to the clone
+  EXPECT_TRUE(cloneZone->setName("Clone Zone"));
+  EXPECT_EQ("Clone Zone",cloneLight->getString(LightsFields::ZoneorZoneListName).get());
+  EXPECT_EQ(zone->name().get(),light.getString(LightsFields::ZoneorZoneListName).get());
+  EXPECT_TRUE(cloneLight->setPointer(LightsFields::ZoneorZoneListName,Handle()));
+  EXPECT_TRUE(light.getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zone->sources().size(),cloneZone->sources().size() + 1u);
+
+  // keeping handles shares the pointer tables outright
+  Workspace snapshot = workspace.clone(true);
+  OptionalWorkspaceObject snapshotLight = snapshot.getObject(light.handle());
+  ASSERT_TRUE(snapshotLight);
+  EXPECT_TRUE(snapshotLight->getImpl<detail::WorkspaceObject_Impl>()->sharesPointerDataWith(
+      *light.getImpl<detail::WorkspaceObject_Impl>()));
+  ASSERT_TRUE(snapshotLight->getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_TRUE(snapshotLight->getTarget(LightsFields::ZoneorZoneListName)->workspace() == snapshot);
+}
+
+TEST_F(IdfFixture, Workspace_Profiling_CloneFanOut) {
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  WorkspaceObjectVector lights = workspace.getObjectsByType(IddObjectType::Lights);
+  ASSERT_FALSE(lights.empty());
+  std::string lightsName = lights[0].name().get();
+  unsigned n = 1000;
+
+  // 1,000 variants that each change one field, all kept alive as in a parametric fan-out
+  std::vector<Workspace> variants;
+  variants.reserve(n);
+  boost::optional<unsigned long long> rssBefore = System::residentSetSize();
+  openstudio::Time start = openstudio::Time::currentTime();
+  for (unsigned i = 0; i < n; ++i) {
+    variants.push_back(workspace.clone());
+    OptionalWorkspaceObject light = variants.back().getObjectByTypeAndName(IddObjectType::Lights,lightsName);
+    ASSERT_TRUE(light);
+    EXPECT_TRUE(light->setDouble(LightsFields::LightingLevel,100.0 + i));
+  }
+  openstudio::Time cloneTime = openstudio::Time::currentTime() - start;
+  boost::optional<unsigned long long> rssAfter = System::residentSetSize();
+
+  EXPECT_EQ(workspace.numObjects(),variants.back().numObjects());
+  LOG(Info,"Created " << n << " variants of a Workspace with " << workspace.numObjects()
+      << " objects in " << cloneTime << " s.");
+  if (rssBefore && rssAfter) {
+    LOG(Info,"Resident memory grew by " << (static_cast<double>(*rssAfter) - static_cast<double>(*rssBefore))/1024.0/n
+        << " KB per variant.");
+  }
+}
+
 TEST_F(IdfFixture,Workspace_Insert) {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -1011,16 +1093,22 @@ TEST_F(IdfFixture,HospitalBaseline) {
   LOG(Info,"Loaded HosptitalBaseline/in.idf into an IdfFile in " << timingResult
       << " s. The file has " << idfFile.objects().size() << " objects.");
 
-  // construct workspace. time.
+  // construct workspace. time and resident memory.
+  boost::optional<unsigned long long> rssBefore = System::residentSetSize();
   start = openstudio::Time::currentTime();
   Workspace ws(idfFile);
   timingResult = openstudio::Time::currentTime() - start;
+  boost::optional<unsigned long long> rssAfter = System::residentSetSize();
 
   // test draft validity
   ValidityReport report = ws.validityReport(StrictnessLevel::Draft);
 
   // report on file
   LOG(Info,"Created Workspace for HospitalBaseline/in.idf in " << timingResult << " s.");
+  if (rssBefore && rssAfter) {
+    LOG(Info,"Resident memory grew by " << (static_cast<double>(*rssAfter) - static_cast<double>(*rssBefore))/1024.0
+        << " KB while creating a Workspace with " << ws.numObjects() << " objects.");
+  }
   if (report.numErrors() > 0) {
     LOG(Info,"HospitalBaseline/in.idf is invalid at draft level. The ValidityReport follows."
         << std::endl << report);
@@ -1031,6 +1119,41 @@ TEST_F(IdfFixture,HospitalBaseline) {
 
 }
 
+TEST_F(IdfFixture,Workspace_Profiling_PerObjectConnections) {
+  openstudio::path p = resourcesPath()/toPath("energyplus/HospitalBaseline/in.idf");
+  OptionalIdfFile oIdfFile = IdfFile::load(p);
+  ASSERT_TRUE(oIdfFile);
+
+  // after: objects notify the workspace directly and have no connections of their own
+  boost::optional<unsigned long long> rssBefore = System::residentSetSize();
+  openstudio::Time start = openstudio::Time::currentTime();
+  Workspace ws(*oIdfFile);
+  openstudio::Time loadTime = openstudio::Time::currentTime() - start;
+  WorkspaceObjectVector objects = ws.objects();
+  boost::optional<unsigned long long> rssLoaded = System::residentSetSize();
+
+  // before: every object had its onChange connected to Workspace_Impl::change, as the model caches
+  // connected to the objects they depend on, so restore that connection to measure what it costs
+  std::shared_ptr<detail::Workspace_Impl> wsImpl = ws.getImpl<detail::Workspace_Impl>();
+  start = openstudio::Time::currentTime();
+  for (const WorkspaceObject& object : objects) {
+    QObject::connect(object.getImpl<detail::WorkspaceObject_Impl>().get(), &detail::WorkspaceObject_Impl::onChange,
+                     wsImpl.get(), &detail::Workspace_Impl::change);
+  }
+  openstudio::Time connectTime = openstudio::Time::currentTime() - start;
+  boost::optional<unsigned long long> rssConnected = System::residentSetSize();
+
+  ASSERT_FALSE(objects.empty());
+  LOG(Info,"Created a Workspace with " << objects.size() << " objects in " << loadTime
+      << " s, connecting each object to the workspace took another " << connectTime << " s.");
+  if (rssBefore && rssLoaded && rssConnected) {
+    LOG(Info,"Resident memory grew by " << (static_cast<double>(*rssLoaded) - static_cast<double>(*rssBefore))/1024.0
+        << " KB while creating the Workspace and by another "
+        << (static_cast<double>(*rssConnected) - static_cast<double>(*rssLoaded))/objects.size()
+        << " bytes per object for the connections.");
+  }
+}
+
 TEST_F(IdfFixture,Workspace_InsertDifferentObjectSameName) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
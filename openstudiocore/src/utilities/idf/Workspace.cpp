@@ -68,6 +68,9 @@ namespace detail {
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_batchEditCommitting(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -78,6 +81,9 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_batchEditCommitting(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -87,6 +93,9 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_batchEditDepth(0),
+    m_batchEditChanged(false),
+    m_batchEditCommitting(false),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -109,6 +118,9 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_batchEditCommitting(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -614,8 +626,10 @@ namespace detail {
 
     // step 2: apply handle map to pointers
     if (!oldNewHandleMap.empty()) {
+      // one copy of the map is kept alive by the objects that have not yet remapped their pointers
+      std::shared_ptr<const HandleMap> sharedHandleMap = std::make_shared<HandleMap>(oldNewHandleMap);
       for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-        ptr->initializeOnClone(oldNewHandleMap);
+        ptr->initializeOnClone(sharedHandleMap);
         emit progressValue(++i);
       }
     }
@@ -1504,7 +1518,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      emit onChange();
+      change();
       return true;
     }
     else {
@@ -1536,7 +1550,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
-      emit onChange();
+      change();
       return true;
     }
     else {
@@ -2297,8 +2311,15 @@ namespace detail {
         source.getImpl<detail::WorkspaceObject_Impl>()->emitChangeSignals();
       }
     }
+    if (m_batchEditDepth > 0) {
+      Handle handle = ptr->handle();
+      if (m_batchChangeSet.addedObjects.erase(handle) == 0) {
+        m_batchChangeSet.removedObjects.insert(handle);
+      }
+      m_batchChangeSet.modifiedObjects.erase(handle);
+    }
+    registerChangeOfObject(*ptr, true);
     ptr->disconnect();
-    disconnect(ptr.get(), &WorkspaceObject_Impl::onChange, this, &Workspace_Impl::change);
   }
 
   void Workspace_Impl::registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,
@@ -2311,10 +2332,19 @@ namespace detail {
   }
 
   void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
-    connect(object.getImpl<WorkspaceObject_Impl>().get(), &WorkspaceObject_Impl::onChange, this, &Workspace_Impl::change);
+    registerChangeOfObject(*object.getImpl<WorkspaceObject_Impl>(), false);
     emit addWorkspaceObject(object, object.iddObject().type(), object.handle());
     emit addWorkspaceObject(object.getImpl<WorkspaceObject_Impl>(), object.iddObject().type(), object.handle());
-    emit onChange();
+    if (m_batchEditDepth > 0) {
+      if (m_batchChangeSet.removedObjects.erase(object.handle()) > 0) {
+        // removed and added back during the batch
+        m_batchChangeSet.modifiedObjects.insert(object.handle());
+      }
+      else {
+        m_batchChangeSet.addedObjects.insert(object.handle());
+      }
+    }
+    change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2338,8 +2368,17 @@ namespace detail {
     // Connect signals
     WorkspaceObject workspaceObject(savedObject.objectImplPtr);
 
-    // emit signals
-    registerAdditionOfObject(workspaceObject);
+    // emit signals, listeners were told the object was being removed
+    emit addWorkspaceObject(workspaceObject, workspaceObject.iddObject().type(), workspaceObject.handle());
+    emit addWorkspaceObject(savedObject.objectImplPtr, workspaceObject.iddObject().type(), workspaceObject.handle());
+
+    // the object was never registered as removed, so this is not an addition or a modification
+    if (m_batchEditDepth > 0) {
+      m_batchChangeSet.failedRemovals.insert(savedObject.handle);
+    }
+    else {
+      emit onChange();
+    }
   }
 
   void Workspace_Impl::restoreObjects(SavedWorkspaceObjectVector& savedObjects) {
@@ -2613,10 +2652,74 @@ namespace detail {
     return result;
   }
 
+  void Workspace_Impl::registerChangeOfObject(WorkspaceObject_Impl&, bool) {
+  }
+
   void Workspace_Impl::change() {
+    if ((m_batchEditDepth > 0) || m_batchEditCommitting) {
+      // coalesced into a single onChange when the batch edit is committed
+      m_batchEditChanged = true;
+      return;
+    }
     emit onChange();
   }
 
+  void Workspace_Impl::beginBatchEdit() {
+    ++m_batchEditDepth;
+  }
+
+  void Workspace_Impl::endBatchEdit() {
+    if (m_batchEditDepth == 0) {
+      LOG(Warn,"Attempt to end a batch edit that was never begun.");
+      return;
+    }
+    --m_batchEditDepth;
+    if (m_batchEditDepth > 0) {
+      return;
+    }
+
+    WorkspaceChangeSet changeSet = m_batchChangeSet;
+    bool changed = m_batchEditChanged || !changeSet.empty();
+    m_batchChangeSet.clear();
+    m_batchEditChanged = false;
+
+    // emit the deferred object signals, once per object
+    m_batchEditCommitting = true;
+    for (const Handle& handle : changeSet.modifiedObjects) {
+      WorkspaceObjectMap::const_iterator it = m_workspaceObjectMap.find(handle);
+      if (it == m_workspaceObjectMap.end()) {
+        continue;
+      }
+      if (it->second->emitBatchedChangeSignals()) {
+        changeSet.relationshipChangedObjects.insert(handle);
+      }
+    }
+    m_batchEditCommitting = false;
+    m_batchEditChanged = false;
+
+    // objects added during the batch are reported as added only
+    for (const Handle& handle : changeSet.addedObjects) {
+      changeSet.modifiedObjects.erase(handle);
+      changeSet.relationshipChangedObjects.erase(handle);
+    }
+
+    if (changed) {
+      emit onChange();
+    }
+    if (changed || !changeSet.failedRemovals.empty()) {
+      emit onBatchChange(changeSet);
+    }
+  }
+
+  bool Workspace_Impl::isBatchEditing() const {
+    return (m_batchEditDepth > 0);
+  }
+
+  void Workspace_Impl::registerBatchModification(const Handle& handle) {
+    m_batchChangeSet.modifiedObjects.insert(handle);
+    m_batchEditChanged = true;
+  }
+
   void Workspace_Impl::createAndAddClonedObjects(
       const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
       std::shared_ptr<detail::Workspace_Impl> cloneImpl,
@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2016, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACEBATCHEDIT_HPP
+#define UTILITIES_IDF_WORKSPACEBATCHEDIT_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Handle.hpp"
+
+#include <memory>
+#include <set>
+
+namespace openstudio {
+
+class Workspace;
+
+namespace detail {
+  class Workspace_Impl;
+}
+
+/** Summary of the changes made to a Workspace during a WorkspaceBatchEdit. Delivered once, when
+ *  the outermost batch edit is committed, by the Workspace_Impl::onBatchChange signal. */
+struct UTILITIES_API WorkspaceChangeSet {
+  /// objects added during the batch that are still in the Workspace
+  std::set<Handle> addedObjects;
+
+  /// objects that were in the Workspace before the batch and have been removed
+  std::set<Handle> removedObjects;
+
+  /// objects whose field data changed, excluding added and removed objects
+  std::set<Handle> modifiedObjects;
+
+  /// objects with at least one pointer field that changed, subset of modifiedObjects
+  std::set<Handle> relationshipChangedObjects;
+
+  /// objects whose removal was attempted during the batch and rolled back, they are unchanged
+  std::set<Handle> failedRemovals;
+
+  bool empty() const;
+
+  void clear();
+};
+
+/** WorkspaceBatchEdit is a scope guard for making many edits to a Workspace (or Model). While
+ *  a batch edit is open, WorkspaceObjects do not emit onNameChange, onDataChange or
+ *  onRelationshipChange per edit, and the Workspace does not emit onChange. Instead the changes
+ *  are accumulated in a WorkspaceChangeSet. When the batch edit is committed (explicitly or on
+ *  destruction), each modified object emits those signals once, the Workspace emits onChange
+ *  once, and the change set is sent to listeners connected to Workspace_Impl::onBatchChange.
+ *
+ *  WorkspaceObject onChange, object addition and object removal signals are still emitted
+ *  immediately, so data cached on objects (e.g. surface areas) stays current inside the batch.
+ *  Batch edits may be nested, only the outermost one commits.
+ *
+ *  \code
+ *  {
+ *    WorkspaceBatchEdit batchEdit(model);
+ *    for (model::Space space : model.getModelObjects<model::Space>()) {
+ *      space.setName("Renamed " + space.name().get());
+ *    }
+ *  } // signals delivered here
+ *  \endcode */
+class UTILITIES_API WorkspaceBatchEdit {
+ public:
+  explicit WorkspaceBatchEdit(const Workspace& workspace);
+
+  /** Commits the batch edit if commit has not already been called. */
+  ~WorkspaceBatchEdit();
+
+  /** Ends this batch edit. If it is the outermost batch edit on the Workspace, emits the
+   *  accumulated signals. Calling commit more than once has no further effect. */
+  void commit();
+
+ private:
+  // noncopyable
+  WorkspaceBatchEdit(const WorkspaceBatchEdit& other);
+  WorkspaceBatchEdit& operator=(const WorkspaceBatchEdit& other);
+
+  std::shared_ptr<detail::Workspace_Impl> m_impl;
+  bool m_committed;
+};
+
+} // openstudio
+
+#endif // UTILITIES_IDF_WORKSPACEBATCHEDIT_HPP
@@ -148,39 +148,74 @@ namespace detail {
     }
   }
 
-  void WorkspaceObject_Impl::initializeOnClone(const HandleMap& oldNewHandleMap) {
+  void WorkspaceObject_Impl::initializeOnClone(const std::shared_ptr<const HandleMap>& handleMap) {
     OS_ASSERT(m_workspace);
+    OS_ASSERT(handleMap);
+    const HandleMap& oldNewHandleMap = *handleMap;
     if (m_sourceData) {
-      SourceData::pointer_set mappedPointers;
-      for (const ForwardPointer& fp : m_sourceData->pointers) {
-        Handle th = openstudio::applyHandleMap(fp.targetHandle,oldNewHandleMap);
-        if (th.isNull() && !fp.targetHandle.isNull() && !oldNewHandleMap.empty()) {
-          // if cloned object is also in this workspace, and fp.targetHandle not in
-          // the map, may be in the workspace
-          OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
-          if (target) {
-            // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
-            th = fp.targetHandle;
+      const SharedSourceData& sourceData = m_sourceData;
+      bool allTargetsCloned = true;
+      for (const ForwardPointer& fp : sourceData->pointers) {
+        if (!fp.targetHandle.isNull() && (oldNewHandleMap.find(fp.targetHandle) == oldNewHandleMap.end())) {
+          allTargetsCloned = false;
+          break;
+        }
+      }
+      if (allTargetsCloned) {
+        // only the reference lists need the new handles now, the table is remapped on first use
+        for (const ForwardPointer& fp : sourceData->pointers) {
+          if (!fp.targetHandle.isNull()) {
+            m_workspace->forwardReferences(m_handle,fp.fieldIndex,oldNewHandleMap.find(fp.targetHandle)->second);
           }
         }
-        mappedPointers.insert(ForwardPointer(fp.fieldIndex,th));
-        if (!th.isNull()) {
-          m_workspace->forwardReferences(m_handle,fp.fieldIndex,th);
+        m_sourceData.setHandleMap(handleMap);
+      }
+      else {
+        SourceData::pointer_set mappedPointers;
+        for (const ForwardPointer& fp : sourceData->pointers) {
+          Handle th = openstudio::applyHandleMap(fp.targetHandle,oldNewHandleMap);
+          if (th.isNull() && !fp.targetHandle.isNull() && !oldNewHandleMap.empty()) {
+            // if cloned object is also in this workspace, and fp.targetHandle not in
+            // the map, may be in the workspace
+            OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
+            if (target) {
+              // need to set reverse pointer
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
+              th = fp.targetHandle;
+            }
+          }
+          mappedPointers.insert(ForwardPointer(fp.fieldIndex,th));
+          if (!th.isNull()) {
+            m_workspace->forwardReferences(m_handle,fp.fieldIndex,th);
+          }
         }
+        m_sourceData->pointers = mappedPointers;
       }
-      m_sourceData->pointers = mappedPointers;
     }
     if (m_targetData) {
-      TargetData::pointer_set mappedPointers;
-      for (const ReversePointer& rp : m_targetData->reversePointers) {
-        Handle sh = openstudio::applyHandleMap(rp.sourceHandle,oldNewHandleMap);
-        if (!sh.isNull()) {
-          mappedPointers.insert(ReversePointer(sh,rp.fieldIndex));
-        }
+      // reverse pointers from sources that were not cloned are dropped either way
+      m_targetData.setHandleMap(handleMap);
+    }
+  }
+
+  SourceData remapHandles(const SourceData& data, const HandleMap& handleMap) {
+    SourceData result;
+    for (const ForwardPointer& fp : data.pointers) {
+      result.pointers.insert(result.pointers.end(),
+                             ForwardPointer(fp.fieldIndex,openstudio::applyHandleMap(fp.targetHandle,handleMap)));
+    }
+    return result;
+  }
+
+  TargetData remapHandles(const TargetData& data, const HandleMap& handleMap) {
+    TargetData result;
+    for (const ReversePointer& rp : data.reversePointers) {
+      Handle sh = openstudio::applyHandleMap(rp.sourceHandle,handleMap);
+      if (!sh.isNull()) {
+        result.reversePointers.insert(ReversePointer(sh,rp.fieldIndex));
       }
-      m_targetData->reversePointers = mappedPointers;
     }
+    return result;
   }
 
   // GETTERS
@@ -735,7 +770,7 @@ namespace detail {
     if (m_handle.isNull()) {
       return false;
     }
-    return m_sourceData;
+    return static_cast<bool>(m_sourceData);
   }
 
   bool WorkspaceObject_Impl::canBeSource(unsigned index,const StringVector& refLists) const {
@@ -758,7 +793,12 @@ namespace detail {
 
   bool WorkspaceObject_Impl::isTarget() const {
     if (m_handle.isNull()) { return false; }
-    return m_targetData;
+    return static_cast<bool>(m_targetData);
+  }
+
+  bool WorkspaceObject_Impl::sharesPointerDataWith(const WorkspaceObject_Impl& other) const {
+    return (m_sourceData.sharesDataWith(other.m_sourceData) ||
+            m_targetData.sharesDataWith(other.m_targetData));
   }
 
   std::vector<std::string> WorkspaceObject_Impl::canBeTarget() const {
@@ -916,6 +956,46 @@ namespace detail {
       return;
     }
 
+    // data derived from many objects is invalidated through the workspace, also during batch edits
+    if (m_workspace) {
+      m_workspace->registerChangeOfObject(*this, false);
+    }
+
+    // onChange is always immediate, data cached on this object and its parents is cleared by it
+    if (m_workspace && m_workspace->isBatchEditing()) {
+      // keep the diffs, the remaining signals are emitted when the batch edit is committed
+      emit onChange();
+      m_workspace->registerBatchModification(m_handle);
+      return;
+    }
+
+    emitDiffSignals();
+
+    emit onChange();
+
+    // notify the workspace directly rather than through a connection on every object, so that
+    // objects only allocate connection lists when something subscribes to their signals
+    if (m_workspace) {
+      m_workspace->change();
+    }
+
+    m_diffs.clear();
+  }
+
+  // PROTECTED
+
+  void WorkspaceObject_Impl::setInitialized() {
+    m_initialized = true;
+  }
+
+  bool WorkspaceObject_Impl::emitBatchedChangeSignals() {
+    bool result = emitDiffSignals();
+    m_diffs.clear();
+    return result;
+  }
+
+  bool WorkspaceObject_Impl::emitDiffSignals() {
+    bool relationshipChange = false;
     bool nameChange = false;
     bool dataChange = false;
 
@@ -944,6 +1024,7 @@ namespace detail {
             oldHandle = workspaceObjectDiff.oldHandle().get();
           }
 
+          relationshipChange = true;
           emit onRelationshipChange(*index, newHandle, oldHandle);
 
         } else if (oIddField && oIddField->isNameField()) {
@@ -962,15 +1043,7 @@ namespace detail {
       emit onDataChange();
     }
 
-    emit onChange();
-
-    m_diffs.clear();
-  }
-
-  // PROTECTED
-
-  void WorkspaceObject_Impl::setInitialized() {
-    m_initialized = true;
+    return relationshipChange;
   }
 
   void WorkspaceObject_Impl::disconnect() {
@@ -36,6 +36,8 @@
 
 #include <QObject>
 
+#include <memory>
+
 namespace openstudio {
 
 // forward declarations
@@ -94,6 +96,83 @@ namespace detail {
   };
   typedef boost::optional<TargetData> OptionalTargetData;
 
+  /** Returns data with every handle replaced by its image under handleMap. Pointers to unmapped
+   *  targets become null, and reverse pointers from unmapped sources are dropped. */
+  UTILITIES_API SourceData remapHandles(const SourceData& data, const HandleMap& handleMap);
+  UTILITIES_API TargetData remapHandles(const TargetData& data, const HandleMap& handleMap);
+
+  /** Optional pointer data that is shared with clones until one of them modifies it. A clone
+   *  with new handles stores the clone's handle map and only applies it when the data is first
+   *  read, so objects in a cloned Workspace that are never visited keep sharing the original
+   *  tables. Access goes through operator-> and get(), as for the boost::optional this replaces;
+   *  non-const access detaches. */
+  template<class T>
+  class SharedPointerData {
+   public:
+    SharedPointerData() {}
+
+    SharedPointerData(const T& data) : m_data(std::make_shared<T>(data)) {}
+
+    SharedPointerData(const SharedPointerData& other)
+      : m_data(other.mappedData())
+    {}
+
+    SharedPointerData& operator=(const SharedPointerData& other) {
+      m_data = other.mappedData();
+      m_handleMap.reset();
+      return *this;
+    }
+
+    SharedPointerData& operator=(const T& data) {
+      m_data = std::make_shared<T>(data);
+      m_handleMap.reset();
+      return *this;
+    }
+
+    explicit operator bool() const { return static_cast<bool>(m_data); }
+
+    const T& get() const { return *mappedData(); }
+
+    T& get() {
+      mappedData();
+      if (m_data.use_count() > 1) {
+        m_data = std::make_shared<T>(*m_data);
+      }
+      return *m_data;
+    }
+
+    const T* operator->() const { return &get(); }
+
+    T* operator->() { return &get(); }
+
+    /** Defers applying handleMap until the data is next accessed. */
+    void setHandleMap(const std::shared_ptr<const HandleMap>& handleMap) {
+      if (m_data) {
+        mappedData();
+        m_handleMap = handleMap;
+      }
+    }
+
+    /** Returns true if this object and other currently share the same table. */
+    bool sharesDataWith(const SharedPointerData& other) const {
+      return (m_data && (m_data == other.m_data));
+    }
+
+   private:
+    const std::shared_ptr<T>& mappedData() const {
+      if (m_handleMap) {
+        m_data = std::make_shared<T>(remapHandles(*m_data,*m_handleMap));
+        m_handleMap.reset();
+      }
+      return m_data;
+    }
+
+    mutable std::shared_ptr<T> m_data;
+    mutable std::shared_ptr<const HandleMap> m_handleMap;
+  };
+  typedef SharedPointerData<SourceData> SharedSourceData;
+  typedef SharedPointerData<TargetData> SharedTargetData;
+
   template<class T>
   typename T::pointer_set::iterator getIteratorAtFieldIndex(
                                                             typename T::pointer_set& pointerSet,
@@ -131,8 +210,9 @@ namespace detail {
     /** Complete construction process by pointing to workspace and replacing name pointers. */
     virtual void initializeOnAdd(bool expectToLosePointers = false);
 
-    /** Complete copy construction process by updating pointer handles. */
-    virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
+    /** Complete copy construction process by updating pointer handles. If every target of this
+     *  object was cloned along with it, the pointer tables are remapped lazily. */
+    virtual void initializeOnClone(const std::shared_ptr<const HandleMap>& oldNewHandleMap);
 
     virtual ~WorkspaceObject_Impl();
 
@@ -249,6 +329,10 @@ namespace detail {
     /** Returns true if another object points to this object. */
     bool isTarget() const;
 
+    /** Returns true if this object still shares its pointer tables with other, as a clone does
+     *  until its pointers are read or changed. */
+    bool sharesPointerDataWith(const WorkspaceObject_Impl& other) const;
+
     /** Returns the reference lists of which this object is a member, if this object has a name. */
     std::vector<std::string> canBeTarget() const;
 
@@ -282,7 +366,9 @@ namespace detail {
     /** @name Signal Helpers */
     //@{
 
-    /** Emits signals after batch update and error checking is complete, clears the diffs */
+    /** Emits signals after batch update and error checking is complete, clears the diffs. If a
+     *  WorkspaceBatchEdit is open on the Workspace, only onChange is emitted. The diffs are kept
+     *  and the remaining signals are emitted when the batch edit is committed. */
     virtual void emitChangeSignals() override;
 
     //@}
@@ -303,6 +389,10 @@ namespace detail {
     /** Denotes that this object has been initialized by Workspace_Impl. */
     void setInitialized();
 
+    /** Emits the onNameChange, onDataChange and onRelationshipChange signals deferred by a
+     *  WorkspaceBatchEdit and clears the diffs. Returns true if a pointer field changed. */
+    bool emitBatchedChangeSignals();
+
     /** Disconnects this object from its workspace. Nullifies m_workspace and m_handle. */
     void disconnect();
 
@@ -338,8 +428,8 @@ namespace detail {
 
     bool                m_initialized;
     Workspace_Impl*     m_workspace;
-    OptionalSourceData  m_sourceData;
-    OptionalTargetData  m_targetData;
+    SharedSourceData    m_sourceData;
+    SharedTargetData    m_targetData;
 
     // SETTER HELPERS
 
@@ -354,6 +444,12 @@ namespace detail {
 
     bool popField();
 
+    // SIGNAL HELPERS
+
+    /** Emits onRelationshipChange, onNameChange and onDataChange for the pending diffs. Returns
+     *  true if a pointer field changed. */
+    bool emitDiffSignals();
+
     // configure logging
     REGISTER_LOGGER("utilities.idf.WorkspaceObject");
   };
@@ -35,6 +35,7 @@
 #include <utilities/idf/WorkspaceObjectOrder.hpp>
 #include <utilities/idf/ValidityEnums.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
+#include <utilities/idf/WorkspaceBatchEdit.hpp>
 
 #include <utilities/idd/IddFileAndFactoryWrapper.hpp>
 
@@ -356,6 +357,34 @@ namespace detail {
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
 
+    //@}
+    /** @name Batch Editing */
+    //@{
+
+    /** Opens a batch edit. Prefer the WorkspaceBatchEdit scope guard over calling this directly.
+     *  Batch edits may be nested. */
+    void beginBatchEdit();
+
+    /** Closes a batch edit. Closing the outermost batch edit emits the deferred object signals,
+     *  onChange, and onBatchChange. */
+    void endBatchEdit();
+
+    /** Returns true if a batch edit is open. */
+    bool isBatchEditing() const;
+
+    /** Records that the object with handle has deferred change signals. Called by
+     *  WorkspaceObject_Impl while a batch edit is open. */
+    void registerBatchModification(const Handle& handle);
+
+    //@}
+    /** @name Change Tracking */
+    //@{
+
+    /** Called with every object that is added, changed, or about to be removed, including while a
+     *  batch edit is open. Derived workspaces override this to invalidate data computed from many
+     *  objects without connecting to each of them. The default does nothing. */
+    virtual void registerChangeOfObject(WorkspaceObject_Impl& object, bool removed);
+
     //@}
     /** @name Object Order */
     //@{
@@ -455,6 +484,9 @@ namespace detail {
     /** Emitted on any change to this Workspace and its contents. */
     void onChange() const;
 
+    /** Emitted once when the outermost WorkspaceBatchEdit is committed, if anything changed. */
+    void onBatchChange(const openstudio::WorkspaceChangeSet& changeSet) const;
+
     /** Send an object being deleted from the workspace. OS_ASSERT(!object.initialized())
      *  should pass, as should OS_ASSERT(object.handle().isNull()). */
     void removeWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
@@ -494,6 +526,12 @@ namespace detail {
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
 
+    // batch edit state
+    unsigned m_batchEditDepth;
+    bool m_batchEditChanged;
+    bool m_batchEditCommitting;
+    WorkspaceChangeSet m_batchChangeSet;
+
     typedef std::map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
@@ -1362,6 +1362,28 @@ int SqlFile::execute(const std::string& statement)
   return result;
 }
 
+boost::optional<double> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                  const std::string& tableName, const std::string& rowName,
+                                                  const std::string& columnName, const std::string& units) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<std::string> SqlFile::tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                        const std::string& tableName, const std::string& rowName,
+                                                        const std::string& columnName, const std::string& units) const
+{
+  boost::optional<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataString(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
 openstudio::OptionalTimeSeries SqlFile::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue)
 {
   openstudio::OptionalTimeSeries result;
@@ -835,6 +835,18 @@ class UTILITIES_API SqlFile {
   /// execute a statement and return the error code, used for create/drop tables
   int execute(const std::string& statement);
 
+  /** Returns the value of the tabular report cell identified by its report name, report for string, table name,
+   *  row name, column name and units. The tabular data is read into an in-memory index on first use, which is
+   *  much faster than a query per cell. */
+  boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                           const std::string& tableName, const std::string& rowName,
+                                           const std::string& columnName, const std::string& units) const;
+
+  /// Returns the text of the tabular report cell, see tabularDataValue.
+  boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                 const std::string& tableName, const std::string& rowName,
+                                                 const std::string& columnName, const std::string& units) const;
+
   void insertTimeSeriesData(const std::string &t_variableType, const std::string &t_indexGroup,
       const std::string &t_timestepType, const std::string &t_keyValue, const std::string &t_variableName,
       const openstudio::ReportingFrequency &t_reportingFrequency, const boost::optional<std::string> &t_scheduleName,
@@ -42,6 +42,8 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
+#include <algorithm>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -60,7 +62,7 @@ namespace openstudio{
     }
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false)
+      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_tabularDataIndexed(false)
     {
       if (boost::filesystem::exists(m_path)){
         m_path = boost::filesystem::canonical(m_path);
@@ -71,7 +73,7 @@ namespace openstudio{
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_path(t_path), m_tabularDataIndexed(false)
     {
       if (boost::filesystem::exists(m_path)){
         m_path = boost::filesystem::canonical(m_path);
@@ -416,6 +418,7 @@ namespace openstudio{
         sqlite3_close(m_db);
         m_connectionOpen = false;
       }
+      clearTabularDataIndex();
       return true;
     }
 
@@ -874,14 +877,7 @@ namespace openstudio{
         boost::algorithm::to_upper_copy(t_fuelType.valueName());
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='J'";
-
-      return execAndReturnFirstDouble(s);
+      return firstTabularDataValue(reportname, std::string("Meter"), boost::none, rowname, columnname, std::string("J"));
     }
     
     //TODO
@@ -896,26 +892,14 @@ namespace openstudio{
         " {AT MAX/MIN}";
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='W'";
-
-      return execAndReturnFirstDouble(s);
+      return firstTabularDataValue(reportname, std::string("Meter"), boost::none, rowname, columnname, std::string("W"));
     }
 
     /// hours simulated
     boost::optional<double> SqlFile_Impl::hoursSimulated() const
     {
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='InputVerificationandResultsSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='General' AND \
-                              RowName='Hours Simulated' AND \
-                              Units='hrs'";
-      boost::optional<double> ret = execAndReturnFirstDouble(s);
+      boost::optional<double> ret = firstTabularDataValue(std::string("InputVerificationandResultsSummary"), std::string("Entire Facility"),
+                                                          std::string("General"), std::string("Hours Simulated"), boost::none, std::string("hrs"));
 
       if (ret) return ret;
 
@@ -938,14 +922,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
       }
 
-      std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      boost::optional<double> d = execAndReturnFirstDouble(s);
+      boost::optional<double> d = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
 
       if (!d) {
         LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -969,14 +946,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -989,14 +959,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
     }
 
 
@@ -1009,24 +972,17 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Source Energy", "Total Energy", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electric') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostTableValue(std::string("Economics Results Summary Report"), std::string("Entire Facility"), "Electric");
       }
       else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Gas') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostTableValue(std::string("Economics Results Summary Report"), std::string("Entire Facility"), "Gas");
       }
       else { 
         // E+ lumps all other fuel types under "Other," so we are forced to use the meters table instead.  
@@ -1064,9 +1020,15 @@ namespace openstudio{
           meterName = "ENERGYTRANSFER:FACILITY";
         }
 
-        auto rowName = execAndReturnFirstString("SELECT RowName FROM tabulardatawithstrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND Value='" + meterName + "'");
+        boost::optional<std::string> rowName;
+        for (unsigned row : findTabularData(std::string("Economics Results Summary Report"), std::string("Entire Facility"), std::string("Tariff Summary"), boost::none, boost::none, boost::none)){
+          if (m_tabularData[row].valueString == meterName){
+            rowName = m_tabularStringValues[m_tabularData[row].rowName];
+            break;
+          }
+        }
         if (rowName){
-          return execAndReturnFirstDouble("SELECT Value FROM tabulardatawithstrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND RowName='" + rowName.get() + "' AND ColumnName='Annual Cost (~~$~~)'");
+          return firstTabularDataValue(std::string("Economics Results Summary Report"), std::string("Entire Facility"), std::string("Tariff Summary"), rowName, std::string("Annual Cost (~~$~~)"), boost::none);
         }
         else {
           return boost::none; // Return an empty optional double, indicating that there is no annual cost for this energy type
@@ -1080,7 +1042,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Total Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Total Building Area", "Area", "m2");
       
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1098,7 +1060,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Net Conditioned Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Net Conditioned Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1226,47 +1188,49 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::economicsEnergyCost() const
     {
-      return execAndReturnFirstDouble("SELECT * from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Total') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+      return annualCostTableValue(std::string("Economics Results Summary Report"), std::string("Entire Facility"), "Total");
     }
 
     OptionalDouble SqlFile_Impl::getElecOrGasUse(bool bGetGas) const
     {
-      boost::optional<std::vector<std::string> > selectedRowNames;
-
-      boost::optional<std::vector<std::string> > qualifiedRowNames;
-      boost::optional<std::vector<std::string> > fuelTypeRowNames;
       OptionalDouble result;
 
       std::string fuelType;
       if(bGetGas){
-        fuelType = "'COMM GAS'";
+        fuelType = "COMM GAS";
       }
       else{
-        fuelType = "'COMM ELECT'";
+        fuelType = "COMM ELECT";
       }
 
-      std::string query("select rowname from tabulardatawithstrings where TableName = 'Tariff Summary' and ColumnName = 'Group' and Value = ");
-      query += fuelType;
-
-      selectedRowNames = execAndReturnVectorOfString("select rowname from tabulardatawithstrings where TableName = 'Tariff Summary' and (ColumnName = 'Selected' and Value = 'Yes')");
-      qualifiedRowNames = execAndReturnVectorOfString("select rowname from tabulardatawithstrings where TableName = 'Tariff Summary' and (ColumnName = 'Qualified' and Value = 'Yes')");
-      fuelTypeRowNames = execAndReturnVectorOfString(query);
+      // row names of the Tariff Summary table whose value in columnName is value
+      auto tariffRowNames = [this](const std::string& columnName, const std::string& value) {
+        std::vector<std::string> rowNames;
+        for (unsigned row : findTabularData(boost::none, boost::none, std::string("Tariff Summary"), boost::none, columnName, boost::none)){
+          if (m_tabularData[row].valueString == value){
+            rowNames.push_back(m_tabularStringValues[m_tabularData[row].rowName]);
+          }
+        }
+        return rowNames;
+      };
 
-      if(!selectedRowNames || !qualifiedRowNames || !fuelTypeRowNames) return result;
+      std::vector<std::string> selectedRowNames = tariffRowNames("Selected", "Yes");
+      std::vector<std::string> qualifiedRowNames = tariffRowNames("Qualified", "Yes");
+      std::vector<std::string> fuelTypeRowNames = tariffRowNames("Group", fuelType);
 
       std::vector<std::string> names;
-      for(unsigned i=0; i<selectedRowNames->size(); i++){
-        for(unsigned j=0; j<qualifiedRowNames->size(); j++){
-          if(selectedRowNames->at(i) == qualifiedRowNames->at(j)){
-            names.push_back(selectedRowNames->at(i));
+      for(unsigned i=0; i<selectedRowNames.size(); i++){
+        for(unsigned j=0; j<qualifiedRowNames.size(); j++){
+          if(selectedRowNames.at(i) == qualifiedRowNames.at(j)){
+            names.push_back(selectedRowNames.at(i));
           }
         }
       }
 
       std::string name;
       for(unsigned i=0; i<names.size(); i++){
-        for(unsigned j=0; j<fuelTypeRowNames->size(); j++){
-          if(names.at(i) == fuelTypeRowNames->at(j)){
+        for(unsigned j=0; j<fuelTypeRowNames.size(); j++){
+          if(names.at(i) == fuelTypeRowNames.at(j)){
             name = names.at(i);
             break;
           }
@@ -1274,10 +1238,7 @@ namespace openstudio{
       }
       if(name.size() == 0) return result;
 
-      query = "SELECT value from tabulardatawithstrings where ReportName = 'Tariff Report' and ReportForString = '";
-      query += name;
-      query +=  "' and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
-      result = execAndReturnFirstDouble(query);
+      result = firstTabularDataValue(std::string("Tariff Report"), name, std::string("Native Variables"), std::string("TotalEnergy"), std::string("Sum"), boost::none);
 
       return result;
     }
@@ -1287,16 +1248,13 @@ namespace openstudio{
     {
       std::string fuelType;
       if(bGetGas){
-        fuelType = "'Gas'";
+        fuelType = "Gas";
       }
       else{
-        fuelType = "'Electric'";
+        fuelType = "Electric";
       }
 
-      std::string query("select value from tabulardatawithstrings where TableName = 'Annual Cost' and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)')) and ColumnName = ");
-      query += fuelType;
-
-      return execAndReturnFirstDouble(query);
+      return annualCostTableValue(boost::none, boost::none, fuelType);
     }
 
     boost::optional<EndUses> SqlFile_Impl::endUses() const
@@ -1307,10 +1265,8 @@ namespace openstudio{
         std::string units = result.getUnitsForFuelType(fuelType);
         for (EndUseCategoryType category : result.categories()){
 
-          std::string query = "SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='" + \
-                               fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-          boost::optional<double> value = execAndReturnFirstDouble(query);
+          boost::optional<double> value = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses",
+                                                           category.valueDescription(), fuelType.valueDescription(), units);
           OS_ASSERT(value);
 
           if (*value != 0.0){
@@ -1326,454 +1282,454 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::electricityHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Natural Gas", "GJ");
     }
     OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Natural Gas", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::naturalGasHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::waterHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const
@@ -2059,10 +2015,198 @@ namespace openstudio{
 
         // must finalize to prevent memory leaks
         sqlite3_finalize(sqlStmtPtr);
+
+        // the statement may have changed the tabular data
+        clearTabularDataIndex();
       }
       return code;
     }
 
+    void SqlFile_Impl::buildTabularDataIndex() const
+    {
+      if (m_tabularDataIndexed){
+        return;
+      }
+      m_tabularDataIndexed = true;
+
+      if (!m_db){
+        return;
+      }
+
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      int code = sqlite3_prepare_v2(m_db, "SELECT ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value FROM tabulardatawithstrings", -1, &sqlStmtPtr, nullptr);
+      if (code != SQLITE_OK){
+        // no tabular data in this file
+        sqlite3_finalize(sqlStmtPtr);
+        return;
+      }
+
+      // interns the text in column i, null is treated as an empty string
+      auto stringId = [&](int i) {
+        const unsigned char* text = sqlite3_column_text(sqlStmtPtr, i);
+        std::string value = text ? columnText(text) : std::string();
+        auto it = m_tabularStrings.find(value);
+        if (it == m_tabularStrings.end()){
+          it = m_tabularStrings.insert(std::make_pair(value, static_cast<int>(m_tabularStringValues.size()))).first;
+          m_tabularStringValues.push_back(value);
+        }
+        return it->second;
+      };
+
+      while ((code = sqlite3_step(sqlStmtPtr)) == SQLITE_ROW){
+        TabularDatum datum;
+        datum.reportName = stringId(0);
+        datum.reportForString = stringId(1);
+        datum.tableName = stringId(2);
+        datum.rowName = stringId(3);
+        datum.columnName = stringId(4);
+        datum.units = stringId(5);
+
+        // copy the text before converting, sqlite3_column_double may invalidate the text pointer
+        const unsigned char* text = sqlite3_column_text(sqlStmtPtr, 6);
+        datum.valueString = text ? columnText(text) : std::string();
+        datum.value = sqlite3_column_double(sqlStmtPtr, 6);
+
+        unsigned index = m_tabularData.size();
+        m_tabularData.push_back(datum);
+
+        std::array<int, 5> cell = {{datum.reportName, datum.reportForString, datum.tableName, datum.rowName, datum.columnName}};
+        m_tabularDataByCell[cell].push_back(index);
+        m_tabularDataByReport[std::make_pair(datum.reportName, datum.reportForString)].push_back(index);
+      }
+
+      sqlite3_finalize(sqlStmtPtr);
+
+      LOG(Debug, "Tabular data index built with " << m_tabularData.size() << " rows");
+    }
+
+    void SqlFile_Impl::clearTabularDataIndex()
+    {
+      m_tabularDataIndexed = false;
+      m_tabularStrings.clear();
+      m_tabularStringValues.clear();
+      m_tabularData.clear();
+      m_tabularDataByCell.clear();
+      m_tabularDataByReport.clear();
+    }
+
+    std::vector<unsigned> SqlFile_Impl::findTabularData(const boost::optional<std::string>& reportName,
+                                                        const boost::optional<std::string>& reportForString,
+                                                        const boost::optional<std::string>& tableName,
+                                                        const boost::optional<std::string>& rowName,
+                                                        const boost::optional<std::string>& columnName,
+                                                        const boost::optional<std::string>& units) const
+    {
+      std::vector<unsigned> result;
+
+      buildTabularDataIndex();
+
+      // convert the strings to ids, -1 matches any value
+      std::array<int, 6> ids;
+      std::array<const boost::optional<std::string>*, 6> strings = {{&reportName, &reportForString, &tableName, &rowName, &columnName, &units}};
+      for (unsigned i = 0; i < 6; ++i){
+        ids[i] = -1;
+        if (*strings[i]){
+          auto it = m_tabularStrings.find(strings[i]->get());
+          if (it == m_tabularStrings.end()){
+            // string does not occur in the tabular data
+            return result;
+          }
+          ids[i] = it->second;
+        }
+      }
+
+      auto matches = [&](unsigned index) {
+        const TabularDatum& datum = m_tabularData[index];
+        return (ids[0] < 0 || ids[0] == datum.reportName) &&
+               (ids[1] < 0 || ids[1] == datum.reportForString) &&
+               (ids[2] < 0 || ids[2] == datum.tableName) &&
+               (ids[3] < 0 || ids[3] == datum.rowName) &&
+               (ids[4] < 0 || ids[4] == datum.columnName) &&
+               (ids[5] < 0 || ids[5] == datum.units);
+      };
+
+      // use the most specific index available for the given strings
+      const std::vector<unsigned>* candidates = nullptr;
+      if (ids[0] >= 0 && ids[1] >= 0 && ids[2] >= 0 && ids[3] >= 0 && ids[4] >= 0){
+        std::array<int, 5> cell = {{ids[0], ids[1], ids[2], ids[3], ids[4]}};
+        auto it = m_tabularDataByCell.find(cell);
+        if (it == m_tabularDataByCell.end()){
+          return result;
+        }
+        candidates = &it->second;
+      }else if (ids[0] >= 0 && ids[1] >= 0){
+        auto it = m_tabularDataByReport.find(std::make_pair(ids[0], ids[1]));
+        if (it == m_tabularDataByReport.end()){
+          return result;
+        }
+        candidates = &it->second;
+      }
+
+      if (candidates){
+        for (unsigned index : *candidates){
+          if (matches(index)){
+            result.push_back(index);
+          }
+        }
+      }else{
+        for (unsigned index = 0; index < m_tabularData.size(); ++index){
+          if (matches(index)){
+            result.push_back(index);
+          }
+        }
+      }
+
+      return result;
+    }
+
+    boost::optional<double> SqlFile_Impl::firstTabularDataValue(const boost::optional<std::string>& reportName,
+                                                                const boost::optional<std::string>& reportForString,
+                                                                const boost::optional<std::string>& tableName,
+                                                                const boost::optional<std::string>& rowName,
+                                                                const boost::optional<std::string>& columnName,
+                                                                const boost::optional<std::string>& units) const
+    {
+      std::vector<unsigned> rows = findTabularData(reportName, reportForString, tableName, rowName, columnName, units);
+      if (rows.empty()){
+        return boost::none;
+      }
+      return m_tabularData[rows.front()].value;
+    }
+
+    boost::optional<double> SqlFile_Impl::annualCostTableValue(const boost::optional<std::string>& reportName,
+                                                               const boost::optional<std::string>& reportForString,
+                                                               const std::string& columnName) const
+    {
+      std::vector<unsigned> rows = findTabularData(reportName, reportForString, std::string("Annual Cost"), std::string("Cost"), columnName, std::string("~~$~~"));
+      std::vector<unsigned> rowsWithUnits = findTabularData(reportName, reportForString, std::string("Annual Cost"), std::string("Cost (~~$~~)"), columnName, boost::none);
+
+      // first matching row in the order of the view
+      rows.insert(rows.end(), rowsWithUnits.begin(), rowsWithUnits.end());
+      if (rows.empty()){
+        return boost::none;
+      }
+      return m_tabularData[*std::min_element(rows.begin(), rows.end())].value;
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                           const std::string& tableName, const std::string& rowName,
+                                                           const std::string& columnName, const std::string& units) const
+    {
+      return firstTabularDataValue(reportName, reportForString, tableName, rowName, columnName, units);
+    }
+
+    boost::optional<std::string> SqlFile_Impl::tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                                 const std::string& tableName, const std::string& rowName,
+                                                                 const std::string& columnName, const std::string& units) const
+    {
+      std::vector<unsigned> rows = findTabularData(reportName, reportForString, tableName, rowName, columnName, units);
+      if (rows.empty()){
+        return boost::none;
+      }
+      return m_tabularData[rows.front()].valueString;
+    }
+
     std::vector<double> SqlFile_Impl::timeSeriesValues(const DataDictionaryItem& dataDictionary)
     {
       std::vector<double> stdValues;
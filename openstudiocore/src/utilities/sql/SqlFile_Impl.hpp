@@ -42,6 +42,8 @@
 
 #include <boost/optional.hpp>
 
+#include <array>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -763,6 +765,16 @@ namespace openstudio{
       // execute a statement and return the error code, used for create/drop tables
       int execute(const std::string& statement);
 
+      // value of the tabular report cell, served from the in-memory tabular data index
+      boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                               const std::string& tableName, const std::string& rowName,
+                                               const std::string& columnName, const std::string& units) const;
+
+      // text of the tabular report cell, served from the in-memory tabular data index
+      boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                     const std::string& tableName, const std::string& rowName,
+                                                     const std::string& columnName, const std::string& units) const;
+
       /// Returns the summary data for each install location and fuel type found in report variables
       std::vector<openstudio::SummaryData> getSummaryData() const;
 
@@ -830,6 +842,48 @@ namespace openstudio{
 
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
+      // one row of the tabulardatawithstrings view, strings are stored as ids into m_tabularStrings
+      struct TabularDatum
+      {
+        int reportName;
+        int reportForString;
+        int tableName;
+        int rowName;
+        int columnName;
+        int units;
+        double value;
+        std::string valueString;
+      };
+
+      // reads the tabulardatawithstrings view into the tabular data index if that has not been done yet
+      void buildTabularDataIndex() const;
+
+      // clears the tabular data index, it is rebuilt on next use
+      void clearTabularDataIndex();
+
+      // returns the indices into m_tabularData of rows matching all of the given strings in the order of the view,
+      // arguments that are not set match any value
+      std::vector<unsigned> findTabularData(const boost::optional<std::string>& reportName,
+                                            const boost::optional<std::string>& reportForString,
+                                            const boost::optional<std::string>& tableName,
+                                            const boost::optional<std::string>& rowName,
+                                            const boost::optional<std::string>& columnName,
+                                            const boost::optional<std::string>& units) const;
+
+      // value of the first row of the tabular data matching all of the given strings
+      boost::optional<double> firstTabularDataValue(const boost::optional<std::string>& reportName,
+                                                    const boost::optional<std::string>& reportForString,
+                                                    const boost::optional<std::string>& tableName,
+                                                    const boost::optional<std::string>& rowName,
+                                                    const boost::optional<std::string>& columnName,
+                                                    const boost::optional<std::string>& units) const;
+
+      // value of the first cost in the Annual Cost table for columnName, EnergyPlus versions differ in whether
+      // the units are part of the row name
+      boost::optional<double> annualCostTableValue(const boost::optional<std::string>& reportName,
+                                                   const boost::optional<std::string>& reportForString,
+                                                   const std::string& columnName) const;
+
       openstudio::path m_path;
       bool m_connectionOpen;
       DataDictionaryTable m_dataDictionary;
@@ -838,6 +892,15 @@ namespace openstudio{
 
       bool m_supportedVersion;
 
+      mutable bool m_tabularDataIndexed;
+      mutable std::map<std::string, int> m_tabularStrings;
+      mutable std::vector<std::string> m_tabularStringValues;
+      mutable std::vector<TabularDatum> m_tabularData;
+      // rows by report name, report for string, table name, row name and column name
+      mutable std::map<std::array<int, 5>, std::vector<unsigned> > m_tabularDataByCell;
+      // rows by report name and report for string
+      mutable std::map<std::pair<int, int>, std::vector<unsigned> > m_tabularDataByReport;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
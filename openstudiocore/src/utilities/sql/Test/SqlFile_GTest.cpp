@@ -41,6 +41,9 @@
 
 #include <QRegularExpression>
 
+#include <boost/lexical_cast.hpp>
+#include <boost/algorithm/string/trim.hpp>
+
 #include <resources.hxx>
 
 #include <iostream>
@@ -64,6 +67,33 @@ TEST_F(SqlFileFixture, SummaryValues)
 }
 
 
+TEST_F(SqlFileFixture, TabularData)
+{
+  // values from the index match a query against the view
+  boost::optional<double> indexed = sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
+  boost::optional<double> queried = sqlFile.execAndReturnFirstDouble("SELECT Value FROM tabulardatawithstrings WHERE ReportName='AnnualBuildingUtilityPerformanceSummary' AND ReportForString='Entire Facility' AND TableName='Site and Source Energy' AND RowName='Net Site Energy' AND ColumnName='Total Energy' AND Units='GJ'");
+  ASSERT_TRUE(indexed);
+  ASSERT_TRUE(queried);
+  EXPECT_EQ(*queried, *indexed);
+  EXPECT_EQ(*queried, *sqlFile.netSiteEnergy());
+
+  boost::optional<std::string> text = sqlFile.tabularDataString("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
+  ASSERT_TRUE(text);
+  EXPECT_NEAR(*indexed, boost::lexical_cast<double>(boost::trim_copy(*text)), 0.01);
+
+  indexed = sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
+  queried = sqlFile.execAndReturnFirstDouble("SELECT Value FROM tabulardatawithstrings WHERE ReportName='AnnualBuildingUtilityPerformanceSummary' AND ReportForString='Entire Facility' AND TableName='End Uses' AND RowName='Heating' AND ColumnName='Electricity' AND Units='GJ'");
+  ASSERT_TRUE(indexed);
+  ASSERT_TRUE(queried);
+  EXPECT_EQ(*queried, *indexed);
+  EXPECT_EQ(*queried, *sqlFile.electricityHeating());
+
+  // cells that do not exist
+  EXPECT_FALSE(sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "kWh"));
+  EXPECT_FALSE(sqlFile.tabularDataValue("NotAReport", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ"));
+  EXPECT_FALSE(sqlFile.tabularDataString("NotAReport", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ"));
+}
+
 TEST_F(SqlFileFixture, EnvPeriods)
 {
   std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
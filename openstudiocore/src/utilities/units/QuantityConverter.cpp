@@ -39,13 +39,59 @@
 #include "FahrenheitUnit.hpp"
 #include "IPUnit.hpp"
 #include "SIUnit.hpp"
+#include "TemperatureUnit.hpp"
+#include "TemperatureUnit_Impl.hpp"
 #include "ThermUnit.hpp"
 #include "WhUnit.hpp"
 
 #include "../core/Assert.hpp"
+#include "../math/FloatCompare.hpp"
+
+#include <QMutex>
+#include <QMutexLocker>
 
 namespace openstudio {
 
+namespace {
+
+  // pretty strings do not change the numbers but are carried through to the result units, and
+  // absolute and relative temperatures convert differently
+  std::string conversionCacheKey(const Unit& units) {
+    std::string result = units.system().valueName() + " " + units.standardString() + " " + units.prettyString();
+    if (OptionalTemperatureUnit temperatureUnit = units.optionalCast<TemperatureUnit>()) {
+      result += temperatureUnit->isAbsolute() ? " abs" : " rel";
+    }
+    return result;
+  }
+
+}
+
+double UnitConversion::apply(double value) const {
+  return factor * value + offset;
+}
+
+std::vector<double> UnitConversion::apply(const std::vector<double>& values) const {
+  std::vector<double> result(values.size());
+  const double f = factor;
+  const double o = offset;
+  const double* in = values.data();
+  double* out = result.data();
+  for (size_t i = 0, n = values.size(); i < n; ++i) {
+    out[i] = f * in[i] + o;
+  }
+  return result;
+}
+
+Vector UnitConversion::apply(const Vector& values) const {
+  Vector result(values.size());
+  const double f = factor;
+  const double o = offset;
+  for (unsigned i = 0, n = values.size(); i < n; ++i) {
+    result[i] = f * values[i] + o;
+  }
+  return result;
+}
+
 boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity &q,
                                                               UnitSystem sys) const
 {
@@ -125,7 +171,95 @@ boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity &or
   return result;
 }
 
+boost::optional<UnitConversion> QuantityConverterSingleton::conversion(
+    const std::string& originalUnits,
+    const std::string& finalUnits) const
+{
+  std::pair<std::string, std::string> key(originalUnits, finalUnits);
+  {
+    QMutexLocker lock(m_conversionCacheMutex.get());
+    auto it = m_stringConversionCache.find(key);
+    if (it != m_stringConversionCache.end()) {
+      return it->second.conversion;
+    }
+  }
+
+  CachedConversion cached;
+  if (originalUnits == finalUnits) {
+    cached.conversion = UnitConversion{1.0, 0.0};
+  }else {
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+    if (originalUnit && finalUnit) {
+      cached = m_resolveConversion(*originalUnit, *finalUnit);
+    }
+  }
+
+  QMutexLocker lock(m_conversionCacheMutex.get());
+  m_stringConversionCache[key] = cached;
+  return cached.conversion;
+}
+
+boost::optional<UnitConversion> QuantityConverterSingleton::conversion(const Unit& originalUnits,
+                                                                       const Unit& targetUnits,
+                                                                       Unit& resultUnits) const
+{
+  std::pair<std::string, std::string> key(conversionCacheKey(originalUnits), conversionCacheKey(targetUnits));
+
+  CachedConversion cached;
+  bool found = false;
+  {
+    QMutexLocker lock(m_conversionCacheMutex.get());
+    auto it = m_unitConversionCache.find(key);
+    if (it != m_unitConversionCache.end()) {
+      cached = it->second;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    cached = m_resolveConversion(originalUnits, targetUnits);
+    QMutexLocker lock(m_conversionCacheMutex.get());
+    m_unitConversionCache[key] = cached;
+  }
+
+  if (cached.conversion) {
+    OS_ASSERT(cached.resultUnits);
+    resultUnits = cached.resultUnits->clone();
+  }
+  return cached.conversion;
+}
+
+QuantityConverterSingleton::CachedConversion QuantityConverterSingleton::m_resolveConversion(
+    const Unit& originalUnits,
+    const Unit& targetUnits) const
+{
+  CachedConversion result;
+
+  // probe the full conversion at a few values to recover factor and offset
+  OptionalQuantity atZero = convert(Quantity(0.0, originalUnits), targetUnits);
+  OptionalQuantity atOne = convert(Quantity(1.0, originalUnits), targetUnits);
+  OptionalQuantity atTen = convert(Quantity(10.0, originalUnits), targetUnits);
+  if (!atZero || !atOne || !atTen) {
+    return result;
+  }
+  OS_ASSERT(atZero->units() == atOne->units());
+  OS_ASSERT(atZero->units() == atTen->units());
+
+  UnitConversion candidate{atOne->value() - atZero->value(), atZero->value()};
+
+  // absolute temperatures with exponents other than one do not convert linearly
+  if (!equal(candidate.apply(10.0), atTen->value(), 1.0E-12)) {
+    return result;
+  }
+
+  result.conversion = candidate;
+  result.resultUnits = atZero->units();
+  return result;
+}
+
 QuantityConverterSingleton::QuantityConverterSingleton()
+  : m_conversionCacheMutex(new QMutex())
 {
   // initialize the quantity converter maps here
 
@@ -512,6 +646,11 @@ boost::optional<double> convert(double original, const std::string& originalUnit
     return original;
   }
 
+  // use the cached factor and offset when the conversion is affine
+  if (boost::optional<UnitConversion> conversion = QuantityConverter::instance().conversion(originalUnits, finalUnits)) {
+    return conversion->apply(original);
+  }
+
   //create the units from the strings
   boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
   boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
@@ -534,6 +673,47 @@ boost::optional<double> convert(double original, const std::string& originalUnit
   return boost::none;
 }
 
+boost::optional<std::vector<double> > convert(const std::vector<double>& original,
+                                              const std::string& originalUnits,
+                                              const std::string& finalUnits)
+{
+  if (boost::optional<UnitConversion> conversion = QuantityConverter::instance().conversion(originalUnits, finalUnits)) {
+    return conversion->apply(original);
+  }
+
+  // fall back on converting one value at a time
+  std::vector<double> result;
+  result.reserve(original.size());
+  for (double value : original) {
+    boost::optional<double> converted = convert(value, originalUnits, finalUnits);
+    if (!converted) {
+      return boost::none;
+    }
+    result.push_back(*converted);
+  }
+  return result;
+}
+
+boost::optional<Vector> convert(const Vector& original,
+                                const std::string& originalUnits,
+                                const std::string& finalUnits)
+{
+  if (boost::optional<UnitConversion> conversion = QuantityConverter::instance().conversion(originalUnits, finalUnits)) {
+    return conversion->apply(original);
+  }
+
+  // fall back on converting one value at a time
+  Vector result(original.size());
+  for (unsigned i = 0, n = original.size(); i < n; ++i) {
+    boost::optional<double> converted = convert(original[i], originalUnits, finalUnits);
+    if (!converted) {
+      return boost::none;
+    }
+    result[i] = *converted;
+  }
+  return result;
+}
+
 boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
   return QuantityConverter::instance().convert(q,sys);
 }
@@ -560,17 +740,25 @@ boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUn
 
 OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits) {
   OSQuantityVector result;
-  Quantity testQuantity(0.0,original.units());
-  OptionalQuantity offset = convert(testQuantity,targetUnits);
-  if (!offset) {
+  Unit resultUnits;
+  boost::optional<UnitConversion> conversion = QuantityConverter::instance().conversion(original.units(), targetUnits, resultUnits);
+  if (conversion) {
+    result = OSQuantityVector(resultUnits, conversion->apply(original.values()));
     return result;
   }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity,targetUnits);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
+
+  // fall back on converting one value at a time
+  std::vector<Quantity> converted;
+  for (double value : original.values()) {
+    OptionalQuantity candidate = convert(Quantity(value,original.units()),targetUnits);
+    if (!candidate) {
+      return result;
+    }
+    converted.push_back(*candidate);
+  }
+  if (!converted.empty()) {
+    result = OSQuantityVector(converted);
+  }
   return result;
 }
 
@@ -34,10 +34,15 @@
 #include "../core/Logger.hpp"
 
 #include "Unit.hpp"
+#include "../data/Vector.hpp"
+
 #include <string>
 #include <map>
+#include <memory>
+#include <vector>
 
 class QDomElement;
+class QMutex;
 
 namespace openstudio {
 
@@ -83,6 +88,23 @@ struct baseUnitConversionFactor {
   double offset;
 };
 
+/** Conversion from one unit to another reduced to value * factor + offset. Obtained from
+ *  QuantityConverterSingleton::conversion, so that many values can be converted without going
+ *  through Unit and Quantity for each one. */
+struct UTILITIES_API UnitConversion {
+  double factor;
+  double offset;
+
+  /** Returns the converted value. */
+  double apply(double value) const;
+
+  /** Returns all values converted in a single pass. */
+  std::vector<double> apply(const std::vector<double>& values) const;
+
+  /** Returns all values converted in a single pass. */
+  Vector apply(const Vector& values) const;
+};
+
 /** Singleton for converting quantities to different \link UnitSystem unit systems \endlink or
  *  to targeted \link Unit units \endlink */
 class UTILITIES_API QuantityConverterSingleton {
@@ -95,6 +117,19 @@ class UTILITIES_API QuantityConverterSingleton {
 
   boost::optional<Quantity> convert(const Quantity &original, const Unit& targetUnits) const;
 
+  /** Returns the conversion from originalUnits to finalUnits as a factor and offset. The unit
+   *  strings are parsed and resolved the first time a pair is requested, later requests are
+   *  served from a cache. Returns boost::none if either string is not a valid unit, or if the
+   *  conversion is not affine. */
+  boost::optional<UnitConversion> conversion(const std::string& originalUnits,
+                                             const std::string& finalUnits) const;
+
+  /** Returns the conversion from originalUnits to targetUnits as a factor and offset, and sets
+   *  resultUnits to the units of the converted values. Cached like the string version. */
+  boost::optional<UnitConversion> conversion(const Unit& originalUnits,
+                                             const Unit& targetUnits,
+                                             Unit& resultUnits) const;
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
@@ -112,6 +147,19 @@ class UTILITIES_API QuantityConverterSingleton {
   boost::optional<Quantity> m_convertToTargetFromSI(const Quantity& original,
                                                     const Unit& targetUnits) const;
 
+  struct CachedConversion {
+    boost::optional<UnitConversion> conversion;
+    boost::optional<Unit> resultUnits;
+  };
+
+  typedef std::map<std::pair<std::string, std::string>, CachedConversion> ConversionCache;
+
+  std::shared_ptr<QMutex> m_conversionCacheMutex;
+  mutable ConversionCache m_stringConversionCache;
+  mutable ConversionCache m_unitConversionCache;
+
+  CachedConversion m_resolveConversion(const Unit& originalUnits, const Unit& targetUnits) const;
+
 };
 
 /** \relates QuantityConverterSingleton */
@@ -120,6 +168,20 @@ typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts all of original from originalUnits to finalUnits in one
+ *  pass. Returns boost::none if the units are invalid or incompatible. 
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<std::vector<double> > convert(const std::vector<double>& original,
+                                                            const std::string& originalUnits, 
+                                                            const std::string& finalUnits);
+
+/** Non-member function that converts all of original from originalUnits to finalUnits in one
+ *  pass. Returns boost::none if the units are invalid or incompatible. 
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<Vector> convert(const Vector& original,
+                                              const std::string& originalUnits, 
+                                              const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
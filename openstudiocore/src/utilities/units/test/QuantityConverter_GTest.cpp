@@ -267,3 +267,55 @@ TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
 TEST_F(UnitsFixture,QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector,UnitSystem(UnitSystem::Wh));
 }
+
+TEST_F(UnitsFixture,QuantityConverter_UnitConversion) {
+  boost::optional<UnitConversion> conversion = QuantityConverter::instance().conversion("m","ft");
+  ASSERT_TRUE(conversion);
+  EXPECT_NEAR(3.28084,conversion->factor,1.0E-5);
+  EXPECT_DOUBLE_EQ(0.0,conversion->offset);
+
+  // second request is served from the cache
+  boost::optional<UnitConversion> cached = QuantityConverter::instance().conversion("m","ft");
+  ASSERT_TRUE(cached);
+  EXPECT_DOUBLE_EQ(conversion->factor,cached->factor);
+  EXPECT_DOUBLE_EQ(conversion->offset,cached->offset);
+
+  conversion = QuantityConverter::instance().conversion("C","F");
+  ASSERT_TRUE(conversion);
+  EXPECT_NEAR(1.8,conversion->factor,1.0E-12);
+  EXPECT_NEAR(32.0,conversion->offset,1.0E-12);
+
+  EXPECT_FALSE(QuantityConverter::instance().conversion("m","s"));
+  EXPECT_FALSE(QuantityConverter::instance().conversion("m","NotAUnit"));
+
+  std::vector<double> values;
+  values.push_back(-40.0);
+  values.push_back(0.0);
+  values.push_back(100.0);
+  boost::optional<std::vector<double> > converted = convert(values,"C","F");
+  ASSERT_TRUE(converted);
+  ASSERT_EQ(3u,converted->size());
+  for (unsigned i = 0; i < 3; ++i) {
+    boost::optional<double> expected = convert(values[i],"C","F");
+    ASSERT_TRUE(expected);
+    EXPECT_NEAR(*expected,(*converted)[i],1.0E-12);
+  }
+  EXPECT_NEAR(-40.0,(*converted)[0],1.0E-12);
+  EXPECT_NEAR(212.0,(*converted)[2],1.0E-12);
+
+  Vector vec = createVector(values);
+  boost::optional<Vector> convertedVec = convert(vec,"C","F");
+  ASSERT_TRUE(convertedVec);
+  ASSERT_EQ(3u,convertedVec->size());
+  EXPECT_NEAR(32.0,(*convertedVec)[1],1.0E-12);
+
+  EXPECT_FALSE(convert(values,"C","m"));
+  EXPECT_FALSE(convert(vec,"C","m"));
+}
+
+TEST_F(UnitsFixture,QuantityConverter_Profiling_UnitConversion) {
+  std::vector<double> values(testOSQuantityVector.values());
+  boost::optional<std::vector<double> > result = convert(values,"J","kWh");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(values.size(),result->size());
+}